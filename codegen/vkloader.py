@@ -61,6 +61,18 @@ def parse_arguments() -> Namespace:
         default=None,
         help="The path where a small .txt will be exported alongside the generated code with information about when/by which extension a function/type was added. If not provided, the timeline will not be exported.",
     )
+    parser.add_argument(
+        "--inline-device-dispatch",
+        action="store_true",
+        default=False,
+        help="If set, the device function wrappers will be emitted as inline functions in the header, so that they can be inlined without LTO. Compiling with VKIT_UNCHECKED_DISPATCH strips them down to the raw call.",
+    )
+    parser.add_argument(
+        "--hot-functions",
+        type=Path,
+        default=None,
+        help="The path to a .txt file listing the device functions to lay out contiguously at the start of the device table, one per line and hottest first. Lines starting with '#' are ignored. If not provided, a default list of the functions used every frame is used.",
+    )
     parser.add_argument("--sdk-version", type=str, default="v1.4.328", help="The version of the vulkan sdk to use.")
     parser.add_argument(
         "-v",
@@ -105,6 +117,65 @@ broken_functions = {
     "vkCmdDispatchGraphIndirectCountAMDX": 298,  # Changed API parameters
 }
 
+# device functions called every frame, hottest first. their pointers are laid out contiguously at the start of the
+# device table so that recording touches as few cache lines of it as possible
+default_hot_functions = [
+    "vkCmdBindPipeline",
+    "vkCmdBindDescriptorSets",
+    "vkCmdBindVertexBuffers",
+    "vkCmdBindVertexBuffers2",
+    "vkCmdBindVertexBuffers2EXT",
+    "vkCmdBindIndexBuffer",
+    "vkCmdBindShadersEXT",
+    "vkCmdPushConstants",
+    "vkCmdPushDescriptorSetKHR",
+    "vkCmdPushDescriptorSetWithTemplateKHR",
+    "vkCmdBindDescriptorBuffersEXT",
+    "vkCmdSetDescriptorBufferOffsetsEXT",
+    "vkCmdDraw",
+    "vkCmdDrawIndexed",
+    "vkCmdDrawIndirect",
+    "vkCmdDrawIndexedIndirect",
+    "vkCmdDrawIndirectCount",
+    "vkCmdDrawIndexedIndirectCount",
+    "vkCmdDrawMeshTasksEXT",
+    "vkCmdDispatch",
+    "vkCmdDispatchIndirect",
+    "vkCmdSetViewport",
+    "vkCmdSetScissor",
+    "vkCmdPipelineBarrier",
+    "vkCmdPipelineBarrier2",
+    "vkCmdPipelineBarrier2KHR",
+    "vkCmdBeginRenderPass",
+    "vkCmdNextSubpass",
+    "vkCmdEndRenderPass",
+    "vkCmdBeginRendering",
+    "vkCmdBeginRenderingKHR",
+    "vkCmdEndRendering",
+    "vkCmdEndRenderingKHR",
+    "vkBeginCommandBuffer",
+    "vkEndCommandBuffer",
+    "vkResetCommandPool",
+    "vkQueueSubmit",
+    "vkQueueSubmit2",
+    "vkQueueSubmit2KHR",
+    "vkAcquireNextImageKHR",
+    "vkQueuePresentKHR",
+    "vkWaitForFences",
+    "vkResetFences",
+    "vkWaitSemaphores",
+    "vkWaitSemaphoresKHR",
+]
+
+
+def load_hot_functions(path: Path | None, /) -> list[str]:
+    if path is None:
+        return default_hot_functions
+
+    with open(path.resolve(), "r") as f:
+        lines = [line.strip() for line in f.readlines()]
+    return [line for line in lines if line and not line.startswith("#")]
+
 
 @dataclass
 class Parameter:
@@ -137,6 +208,7 @@ class Function:
     dispatchable: bool
     available_since: str | None = None
     guards: list[GuardGroup] = field(default_factory=list)
+    extensions: list[str] = field(default_factory=list)
 
     def parse_guards(self) -> str:
         guards = [g.parse_guards() for g in self.guards]
@@ -483,6 +555,8 @@ for extension in root.findall("extensions/extension"):
             if fname in spec_version_req and args.guard_version:
                 guards.and_guards(f"{extname.upper()}_SPEC_VERSION >= {spec_version_req[fname]}")
             functions[fname].guards.append(copy.deepcopy(guards))
+            if extname not in functions[fname].extensions:
+                functions[fname].extensions.append(extname)
             Convoy.verbose(
                 f"Registered availability of function <bold>{fname}</bold> from the <bold>{fname}</bold> extension."
             )
@@ -514,6 +588,19 @@ hpp = CPPGenerator()
 hpp.disclaimer("vkloader.py")
 hpp("#pragma once")
 hpp.include("vkit/vulkan/vulkan.hpp", quotes=True)
+hpp.include("tkit/utils/debug.hpp", quotes=True)
+hpp.spacing()
+hpp("// device functions are resolved on creation. see `DeviceTable`", indent=0)
+hpp("#ifdef VKIT_UNCHECKED_DISPATCH", indent=0)
+hpp("#define VKIT_CHECK_DEVICE_FUNCTION(name)", indent=0)
+hpp("#else", indent=0)
+hpp("#define VKIT_CHECK_DEVICE_FUNCTION(name) \\", indent=0)
+hpp(
+    "    TKIT_ASSERT(this->name, \"[VULKIT][LOADER] The function '\" #name \"' is not available for the instance or device being used, either because VKit::Initialize() was not called or because the feature or extension bound to the function has not been enabled\")",
+    indent=0,
+)
+hpp("#endif", indent=0)
+hpp.spacing()
 
 with hpp.scope("namespace VKit::Vulkan", indent=0):
     hpp.spacing()
@@ -549,21 +636,83 @@ with hpp.scope("namespace VKit::Vulkan", indent=0):
             guard_if_needed(hpp, codefn2, guards, fn)
             hpp.spacing()
 
+    def codefn5(gen: CPPGenerator, fn: Function, /) -> None:
+        gen(fn.as_fn_pointer_declaration(null=True))
+        gen(fn.as_string(vk_prefix=False, no_discard=True, const=True))
+
+    def codefn6(gen: CPPGenerator, fn: Function, /, *, inline: bool) -> None:
+        signature = fn.as_string(vk_prefix=False, semicolon=False, const=True, namespace="DeviceTable")
+        with gen.scope(f"inline {signature}" if inline else signature):
+            pnames = ", ".join(p.name for p in fn.params)
+            gen(f"VKIT_CHECK_DEVICE_FUNCTION({fn.name});")
+            if fn.return_type != "void":
+                gen(f"return this->{fn.name}({pnames});")
+            else:
+                gen(f"this->{fn.name}({pnames});")
+
+    hpp.spacing()
+    with hpp.doc():
+        hpp.brief(
+            "Holds the device level functions. Only the core functions of the device's API version and the functions of its enabled extensions are resolved on creation."
+        )
+        hpp(
+            "`extensions` must also list the enabled instance extensions, as some of them, like `VK_EXT_debug_utils`, provide device level functions. `vkGetDeviceProcAddr()` returns null for any other function, so the rest are left null and never resolved later. The table is immutable after creation and can be shared between threads without synchronization."
+        )
+        hpp("")
+        hpp(
+            "The functions used every frame are laid out first and contiguously, so that recording touches as few cache lines of the table as possible. See `default_hot_functions` in vkloader.py."
+        )
+        hpp("")
+        hpp(
+            "When compiled with VKIT_UNCHECKED_DISPATCH, the wrappers do not assert that the function was resolved."
+        )
+    hot_functions: dict[str, Function] = {}
+    for fname in load_hot_functions(args.hot_functions):
+        fn = functions.get(fname)
+        if fn is None or not fn.is_device_function():
+            Convoy.warning(f"The hot function <bold>{fname}</bold> is not a {vulkan_api} device function. Skipping.")
+            continue
+        hot_functions[fname] = fn
+
     with hpp.scope("struct DeviceTable", closer="};"):
-        hpp("static DeviceTable Create(VkDevice device, const InstanceTable &instanceFuncs);")
+        hpp(
+            "static DeviceTable Create(VkDevice device, const InstanceTable &instanceFuncs, u32 apiVersion, u32 extensionCount, const char *const *extensions);"
+        )
+        hpp.spacing()
+        hpp("// hot functions")
+        for fn in hot_functions.values():
+            guard_if_needed(hpp, codefn5, fn.parse_guards(), fn)
+            hpp.spacing()
+
+        hpp("// cold functions")
         for fn in functions.values():
-            if not fn.is_device_function():
+            if not fn.is_device_function() or fn.name in hot_functions:
                 continue
 
             guards = fn.parse_guards()
-            guard_if_needed(hpp, codefn2, guards, fn)
+            guard_if_needed(hpp, codefn5, guards, fn)
             hpp.spacing()
 
+        hpp("private:", indent=2)
+        hpp("static void loadExtension(DeviceTable &table, const char *extension);")
+        hpp("PFN_vkVoidFunction resolve(const char *name) const;")
+        hpp.spacing()
+        hpp("VkDevice m_Device = VK_NULL_HANDLE;")
+        hpp("PFN_vkGetDeviceProcAddr m_GetDeviceProcAddr = VK_NULL_HANDLE;")
+
+    if args.inline_device_dispatch:
+        hpp.spacing()
+        for fn in functions.values():
+            if not fn.is_device_function():
+                continue
+            guard_if_needed(hpp, codefn6, fn.parse_guards(), fn, inline=True)
+
 
 cpp = CPPGenerator()
 cpp.disclaimer("vkloader.py")
 cpp.include("vkit/core/pch.hpp", quotes=True)
 cpp.include("vkit/vulkan/loader.hpp", quotes=True)
+cpp.include("vkit/core/name_registry.hpp", quotes=True)
 cpp.include("tkit/utils/debug.hpp", quotes=True)
 
 with cpp.scope("namespace VKit::Vulkan", indent=0):
@@ -606,20 +755,65 @@ with cpp.scope("namespace VKit::Vulkan", indent=0):
             )
         cpp("return table;")
 
+    versions: dict[str, list[Function]] = {}
+    extensions: dict[str, list[Function]] = {}
+    for fn in functions.values():
+        if not fn.is_device_function():
+            continue
+        if fn.available_since is not None:
+            versions.setdefault(fn.available_since, []).append(fn)
+        for extname in fn.extensions:
+            extensions.setdefault(extname, []).append(fn)
+
+    def device_load(fn: Function, /) -> str:
+        return f'table.{fn.name} = reinterpret_cast<{fn.as_fn_pointer_type()}>(table.resolve("{fn.name}"));'
+
     cpp.spacing()
-    with cpp.scope("DeviceTable DeviceTable::Create(const VkDevice device, const InstanceTable &instanceFuncs)"):
+    with cpp.scope(
+        "DeviceTable DeviceTable::Create(const VkDevice device, const InstanceTable &instanceFuncs, const u32 apiVersion, const u32 extensionCount, const char *const *extensions)"
+    ):
         cpp("DeviceTable table{};")
-        for fn in functions.values():
-            if not fn.is_device_function():
-                continue
-            guards = fn.parse_guards()
-            guard_if_needed(
-                cpp,
-                f'table.{fn.name} = reinterpret_cast<{fn.as_fn_pointer_type()}>(instanceFuncs.GetDeviceProcAddr(device, "{fn.name}"));',
-                guards,
-            )
+        cpp("table.m_Device = device;")
+        cpp("table.m_GetDeviceProcAddr = instanceFuncs.vkGetDeviceProcAddr;")
+        for version in sorted(versions):
+            cpp(f"#if defined({version})", indent=0)
+            with cpp.scope(f"if (apiVersion >= {version})"):
+                for fn in versions[version]:
+                    # the version already implies the function's guards, unless the function is broken
+                    guards = fn.parse_guards() if fn.name in broken_functions else ""
+                    guard_if_needed(cpp, device_load(fn), guards)
+            cpp("#endif", indent=0)
+
+        cpp("for (u32 i = 0; i < extensionCount; ++i)")
+        cpp("    loadExtension(table, extensions[i]);")
         cpp("return table;")
 
+    cpp.spacing()
+    with cpp.scope("void DeviceTable::loadExtension(DeviceTable &table, const char *extension)"):
+        cpp(
+            "// unknown names fall through. a collision between known names would fail to compile as a duplicate case"
+        )
+        with cpp.scope("switch (HashName(extension))", indent=0):
+            for extname, fns in extensions.items():
+                if args.guard_extension:
+                    cpp(f"#if defined({extname})", indent=0)
+                with cpp.scope(f'case HashName("{extname}"):', delimiters=False):
+                    for fn in fns:
+                        # the extension block already guards functions that only depend on the extension
+                        guards = fn.parse_guards()
+                        if args.guard_extension and guards == f"defined({extname})":
+                            guards = ""
+                        guard_if_needed(cpp, device_load(fn), guards)
+                    cpp("return;")
+                if args.guard_extension:
+                    cpp("#endif", indent=0)
+            with cpp.scope("default:", delimiters=False):
+                cpp("return;")
+
+    cpp.spacing()
+    with cpp.scope("PFN_vkVoidFunction DeviceTable::resolve(const char *name) const"):
+        cpp("return m_GetDeviceProcAddr(m_Device, name);")
+
     def codefn4(gen: CPPGenerator, fn: Function, /, *, namespace: str) -> None:
         with gen.scope(
             fn.as_string(
@@ -656,18 +850,12 @@ with cpp.scope("namespace VKit::Vulkan", indent=0):
             namespace="InstanceTable",
         )
 
-    cpp.spacing()
-    for fn in functions.values():
-        if not fn.is_device_function():
-            continue
-        guards = fn.parse_guards()
-        guard_if_needed(
-            cpp,
-            codefn4,
-            guards,
-            fn,
-            namespace="DeviceTable",
-        )
+    if not args.inline_device_dispatch:
+        cpp.spacing()
+        for fn in functions.values():
+            if not fn.is_device_function():
+                continue
+            guard_if_needed(cpp, codefn6, fn.parse_guards(), fn, inline=False)
 
 cpp("#if defined(TKIT_OS_APPLE) || defined(TKIT_OS_LINUX)", indent=0)
 cpp.include("dlfcn.h")
@@ -0,0 +1,787 @@
+/**
+ * @file test_descriptors.cpp
+ * @brief Catch2 test suite and benchmarks for VKit descriptor layouts, pools, writers and the layout cache
+ */
+
+#undef VKIT_NO_DISCARD
+#define VKIT_NO_DISCARD
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "vkit/core/core.hpp"
+#include "vkit/vulkan/instance.hpp"
+#include "vkit/device/physical_device.hpp"
+#include "vkit/device/logical_device.hpp"
+#include "vkit/state/descriptor_pool.hpp"
+#include "vkit/state/descriptor_allocator.hpp"
+#include "vkit/state/descriptor_set_layout.hpp"
+#include "vkit/state/descriptor_set.hpp"
+#include "vkit/state/layout_cache.hpp"
+#include "vkit/state/bindless_heap.hpp"
+#include "vkit/execution/command_pool.hpp"
+#ifdef VKIT_ENABLE_DEVICE_BUFFER
+#    include "vkit/state/descriptor_buffer.hpp"
+#endif
+
+#include <vector>
+
+// descriptor buffers need an allocator and buffer device addresses, which are core since 1.2
+#if defined(VKIT_ENABLE_DEVICE_BUFFER) && defined(VKIT_API_VERSION_1_2) && defined(VK_EXT_descriptor_buffer)
+#    define VKIT_TEST_DESCRIPTOR_BUFFER
+#endif
+
+using namespace TKit::Alias;
+
+namespace
+{
+
+// ============================================================================
+// Test Context Management
+// ============================================================================
+
+class TestContext
+{
+  public:
+    static TestContext &Get()
+    {
+        static TestContext instance;
+        return instance;
+    }
+
+    bool IsValid() const
+    {
+        return m_Valid;
+    }
+
+    VKit::ProxyDevice GetProxy() const
+    {
+        return m_LogicalDevice->CreateProxy();
+    }
+
+    const VKit::PhysicalDevice &GetPhysicalDevice() const
+    {
+        return *m_PhysicalDevice;
+    }
+
+    bool HasDescriptorIndexing() const
+    {
+        return m_DescriptorIndexing;
+    }
+
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+    const VKit::LogicalDevice *GetLogicalDevice() const
+    {
+        return m_LogicalDevice;
+    }
+
+    bool HasDescriptorBuffer() const
+    {
+        return m_Allocator != VK_NULL_HANDLE;
+    }
+
+    VmaAllocator GetAllocator() const
+    {
+        return m_Allocator;
+    }
+#endif
+
+  private:
+    TestContext()
+    {
+        Initialize();
+    }
+
+    ~TestContext()
+    {
+        Shutdown();
+    }
+
+    void Initialize()
+    {
+        // other test files share the loaded library and `Terminate()` is not reference counted, so it is left for the
+        // process exit to unload
+        if (!VKit::Initialize())
+            return;
+
+        auto instanceResult = VKit::Instance::Builder()
+                                  .SetApplicationName("VKit Descriptor Tests")
+                                  .RequireApiVersion(1, 0, 0)
+                                  .RequestApiVersion(1, 2, 0)
+                                  .SetHeadless(true)
+                                  .Build();
+        if (!instanceResult)
+            return;
+        m_Instance = new VKit::Instance(*instanceResult);
+
+        auto physicalResult = VKit::PhysicalDevice::Selector(m_Instance)
+                                  .PreferType(VKit::Device_Discrete)
+                                  .AddFlags(VKit::DeviceSelectorFlag_AnyType)
+                                  .RemoveFlags(VKit::DeviceSelectorFlag_RequirePresentQueue)
+#ifdef VK_KHR_descriptor_update_template
+                                  .RequestExtension(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME)
+#endif
+#ifdef VK_KHR_push_descriptor
+                                  .RequestExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)
+#endif
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+                                  .RequestExtension(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME)
+#endif
+                                  .Select();
+        if (!physicalResult)
+        {
+            m_Instance->Destroy();
+            delete m_Instance;
+            return;
+        }
+        m_PhysicalDevice = new VKit::PhysicalDevice(*physicalResult);
+#ifdef VKIT_API_VERSION_1_2
+        // what `BindlessHeap` needs for its sampled image binding
+        VKit::DeviceFeatures indexing{};
+        indexing.Vulkan12.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        indexing.Vulkan12.descriptorBindingPartiallyBound = VK_TRUE;
+        indexing.Vulkan12.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+        m_DescriptorIndexing = m_PhysicalDevice->EnableFeatures(indexing);
+#endif
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+        const bool descriptorBuffer = enableDescriptorBuffer();
+#endif
+
+        auto logicalResult = VKit::LogicalDevice::Builder(m_Instance, m_PhysicalDevice)
+                                 .RequireQueue(VKit::Queue_Graphics, 1, 1.0f)
+                                 .Build();
+        if (!logicalResult)
+        {
+            m_Instance->Destroy();
+            delete m_PhysicalDevice;
+            delete m_Instance;
+            return;
+        }
+        m_LogicalDevice = new VKit::LogicalDevice(*logicalResult);
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+        if (descriptorBuffer)
+        {
+            VKit::AllocatorSpecs specs{};
+            specs.Flags = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+            const auto allocatorResult = VKit::CreateAllocator(*m_LogicalDevice, specs);
+            if (allocatorResult)
+                m_Allocator = *allocatorResult;
+        }
+#endif
+        m_Valid = true;
+    }
+
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+    // buffer device addresses are only enabled when the extension is available, so that other devices are unaffected
+    bool enableDescriptorBuffer()
+    {
+        if (!VKit::DescriptorBuffer::IsSupported(*m_PhysicalDevice))
+            return false;
+
+        VKit::DeviceFeatures features{};
+        features.Vulkan12.bufferDeviceAddress = VK_TRUE;
+        if (!m_PhysicalDevice->EnableFeatures(features))
+            return false;
+
+        // the feature is mandatory for devices exposing the extension
+        m_DescriptorBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+        m_DescriptorBufferFeatures.descriptorBuffer = VK_TRUE;
+        m_PhysicalDevice->EnableExtensionBoundFeature(&m_DescriptorBufferFeatures);
+        return true;
+    }
+#endif
+
+    void Shutdown()
+    {
+        if (m_Valid)
+        {
+            m_LogicalDevice->WaitIdle();
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+            if (m_Allocator)
+                VKit::DestroyAllocator(m_Allocator);
+#endif
+            m_LogicalDevice->Destroy();
+            m_Instance->Destroy();
+            delete m_LogicalDevice;
+            delete m_PhysicalDevice;
+            delete m_Instance;
+            m_Valid = false;
+        }
+    }
+
+    bool m_Valid = false;
+    VKit::Instance *m_Instance = nullptr;
+    VKit::PhysicalDevice *m_PhysicalDevice = nullptr;
+    VKit::LogicalDevice *m_LogicalDevice = nullptr;
+    bool m_DescriptorIndexing = false;
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+    VmaAllocator m_Allocator = VK_NULL_HANDLE;
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT m_DescriptorBufferFeatures{};
+#endif
+};
+
+struct ContextGuard
+{
+    ContextGuard()
+    {
+        REQUIRE(TestContext::Get().IsValid());
+    }
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// LAYOUT CACHE
+// ============================================================================
+
+TEST_CASE("LayoutCache - Interning", "[descriptors][cache]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+    VKit::LayoutCache cache{proxy};
+
+    // same bindings added in a different order must resolve to the same layout
+    auto first = cache.AcquireDescriptorSetLayout(
+        VKit::DescriptorSetLayout::Builder(proxy)
+            .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+            .AddBinding(1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT));
+    auto second = cache.AcquireDescriptorSetLayout(
+        VKit::DescriptorSetLayout::Builder(proxy)
+            .AddBinding(1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT)
+            .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT));
+    auto other = cache.AcquireDescriptorSetLayout(VKit::DescriptorSetLayout::Builder(proxy).AddBinding(
+        0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_FRAGMENT_BIT));
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(other);
+    CHECK(first->GetHandle() == second->GetHandle());
+    CHECK(first->GetHandle() != other->GetHandle());
+    CHECK(cache.GetDescriptorSetLayoutCount() == 2);
+
+    auto playout1 = cache.AcquirePipelineLayout(VKit::PipelineLayout::Builder(proxy)
+                                                    .AddDescriptorSetLayout(*first)
+                                                    .AddPushConstantRange<u32>(VK_SHADER_STAGE_VERTEX_BIT));
+    auto playout2 = cache.AcquirePipelineLayout(VKit::PipelineLayout::Builder(proxy)
+                                                    .AddDescriptorSetLayout(*second)
+                                                    .AddPushConstantRange<u32>(VK_SHADER_STAGE_VERTEX_BIT));
+    REQUIRE(playout1);
+    REQUIRE(playout2);
+    CHECK(playout1->GetHandle() == playout2->GetHandle());
+    CHECK(cache.GetPipelineLayoutCount() == 1);
+
+    // the layouts stay alive until every reference is released
+    cache.ReleasePipelineLayout(*playout1);
+    CHECK(cache.GetPipelineLayoutCount() == 1);
+    cache.ReleasePipelineLayout(*playout2);
+    CHECK(cache.GetPipelineLayoutCount() == 0);
+
+    cache.ReleaseDescriptorSetLayout(*first);
+    cache.ReleaseDescriptorSetLayout(*second);
+    CHECK(cache.GetDescriptorSetLayoutCount() == 1);
+
+    cache.Destroy();
+    CHECK(cache.GetDescriptorSetLayoutCount() == 0);
+}
+
+// ============================================================================
+// DESCRIPTOR ALLOCATOR
+// ============================================================================
+
+TEST_CASE("DescriptorAllocator - Growth, Batches and Recycling", "[descriptors][allocator]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    auto layoutResult = VKit::DescriptorSetLayout::Builder(proxy)
+                            .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+                            .Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    auto allocatorResult = VKit::DescriptorAllocator::Builder(proxy)
+                               .SetSetsPerPool(1)
+                               .SetMaxSetsPerPool(4)
+                               .SetGrowthFactor(1.5f)
+                               .AddPoolSizeRatio(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1.f)
+                               .Build();
+    REQUIRE(allocatorResult);
+    auto allocator = *allocatorResult;
+
+    SECTION("Small pools still grow")
+    {
+        // pools of 1, 2 and 3 sets: a factor of 1.5 alone would keep them at 1
+        for (u32 i = 0; i < 6; ++i)
+            REQUIRE(allocator.Allocate(layout.GetHandle()));
+        CHECK(allocator.GetPoolCount() == 3);
+    }
+
+    SECTION("Batches are allocated from a single pool")
+    {
+        std::vector<VkDescriptorSetLayout> layouts(3, layout.GetHandle());
+        std::vector<VkDescriptorSet> sets(3, VK_NULL_HANDLE);
+        REQUIRE(allocator.Allocate(TKit::Span<const VkDescriptorSetLayout>{layouts.data(), layouts.size()},
+                                   TKit::Span<VkDescriptorSet>{sets.data(), sets.size()}));
+        for (const VkDescriptorSet set : sets)
+            CHECK(set != VK_NULL_HANDLE);
+        CHECK(allocator.GetPoolCount() == 3);
+    }
+
+    SECTION("Oversized batches are rejected without creating pools")
+    {
+        std::vector<VkDescriptorSetLayout> layouts(5, layout.GetHandle());
+        std::vector<VkDescriptorSet> sets(5, VK_NULL_HANDLE);
+        for (u32 i = 0; i < 3; ++i)
+        {
+            const auto result = allocator.Allocate(
+                TKit::Span<const VkDescriptorSetLayout>{layouts.data(), layouts.size()},
+                TKit::Span<VkDescriptorSet>{sets.data(), sets.size()});
+            REQUIRE(!result);
+            CHECK(result.GetError().GetCode() == VKit::Error_BadInput);
+        }
+        CHECK(allocator.GetPoolCount() == 1);
+    }
+
+    SECTION("Resetting recycles the pools")
+    {
+        for (u32 frame = 0; frame < 4; ++frame)
+        {
+            for (u32 i = 0; i < 6; ++i)
+                REQUIRE(allocator.Allocate(layout.GetHandle()));
+            REQUIRE(allocator.Reset());
+        }
+        CHECK(allocator.GetPoolCount() == 3);
+    }
+
+    allocator.Destroy();
+    CHECK(!allocator);
+    layout.Destroy();
+}
+
+TEST_CASE("DescriptorAllocator - Requests Fixed-Size Pools Cannot Hold", "[descriptors][allocator]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    auto layoutResult = VKit::DescriptorSetLayout::Builder(proxy)
+                            .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+                            .Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    // pools never grow past 2 sets even though the maximum would allow it
+    auto allocatorResult = VKit::DescriptorAllocator::Builder(proxy)
+                               .SetSetsPerPool(2)
+                               .SetMaxSetsPerPool(8)
+                               .SetGrowthFactor(1.f)
+                               .AddPoolSizeRatio(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1.f)
+                               .Build();
+    REQUIRE(allocatorResult);
+    auto allocator = *allocatorResult;
+
+    SECTION("Filled pools are followed by pools of the same size")
+    {
+        for (u32 i = 0; i < 6; ++i)
+            REQUIRE(allocator.Allocate(layout.GetHandle()));
+        CHECK(allocator.GetPoolCount() == 3);
+    }
+
+    SECTION("Batches larger than a pool fail instead of looping")
+    {
+        std::vector<VkDescriptorSetLayout> layouts(3, layout.GetHandle());
+        std::vector<VkDescriptorSet> sets(3, VK_NULL_HANDLE);
+        for (u32 i = 0; i < 3; ++i)
+            CHECK(!allocator.Allocate(TKit::Span<const VkDescriptorSetLayout>{layouts.data(), layouts.size()},
+                                      TKit::Span<VkDescriptorSet>{sets.data(), sets.size()}));
+        CHECK(allocator.GetPoolCount() == 1);
+
+        // a partially used pool still moves on to a fresh one
+        REQUIRE(allocator.Allocate(layout.GetHandle()));
+        layouts.resize(2);
+        sets.resize(2);
+        REQUIRE(allocator.Allocate(TKit::Span<const VkDescriptorSetLayout>{layouts.data(), layouts.size()},
+                                   TKit::Span<VkDescriptorSet>{sets.data(), sets.size()}));
+        CHECK(allocator.GetPoolCount() == 2);
+    }
+
+    SECTION("Layouts needing more descriptors than a pool provides fail instead of looping")
+    {
+        auto wideResult = VKit::DescriptorSetLayout::Builder(proxy)
+                              .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT, 3)
+                              .Build();
+        REQUIRE(wideResult);
+        auto wide = *wideResult;
+
+        CHECK(!allocator.Allocate(wide.GetHandle()));
+        CHECK(allocator.GetPoolCount() == 1);
+        wide.Destroy();
+    }
+
+    allocator.Destroy();
+    layout.Destroy();
+}
+
+// ============================================================================
+// DESCRIPTOR UPDATE TEMPLATES
+// ============================================================================
+
+#ifdef VK_KHR_descriptor_update_template
+TEST_CASE("DescriptorSetLayout - Update Template Packing", "[descriptors][template]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    if (!ctx.GetPhysicalDevice().IsExtensionEnabled(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME))
+        SKIP("VK_KHR_descriptor_update_template is not supported");
+
+    auto proxy = ctx.GetProxy();
+    auto layoutResult = VKit::DescriptorSetLayout::Builder(proxy)
+                            .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+                            .AddBinding(2, VK_DESCRIPTOR_TYPE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT, 4)
+                            .SetUpdateTemplate()
+                            .Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    const auto &info = layout.GetTemplateInfo();
+    CHECK(info.Template != VK_NULL_HANDLE);
+    REQUIRE(info.Entries.GetSize() == 3);
+    CHECK(info.Entries[1].descriptorCount == 0);
+
+    CHECK(info.Entries[0].offset == 0);
+    CHECK(info.Entries[0].stride == sizeof(VkDescriptorBufferInfo));
+    CHECK(info.Entries[2].offset == sizeof(VkDescriptorBufferInfo));
+    CHECK(info.Entries[2].stride == sizeof(VkDescriptorImageInfo));
+    CHECK(info.Size == sizeof(VkDescriptorBufferInfo) + 4 * sizeof(VkDescriptorImageInfo));
+
+    VKit::DescriptorSet::TemplateWriter writer{proxy, &layout};
+    CHECK(writer.GetSize() == info.Size);
+
+    layout.Destroy();
+    CHECK(!layout);
+}
+
+TEST_CASE("DescriptorSet - Writer vs TemplateWriter", "[.][benchmark][descriptors][template]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    if (!ctx.GetPhysicalDevice().IsExtensionEnabled(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME))
+        SKIP("VK_KHR_descriptor_update_template is not supported");
+
+    constexpr u32 setCount = 1024;
+    auto proxy = ctx.GetProxy();
+
+    auto layoutResult = VKit::DescriptorSetLayout::Builder(proxy)
+                            .AddBinding(0, VK_DESCRIPTOR_TYPE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT)
+                            .AddBinding(1, VK_DESCRIPTOR_TYPE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT, 4)
+                            .SetUpdateTemplate()
+                            .Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    auto poolResult = VKit::DescriptorPool::Builder(proxy)
+                          .SetMaxSets(setCount)
+                          .AddPoolSize(VK_DESCRIPTOR_TYPE_SAMPLER, 5 * setCount)
+                          .Build();
+    REQUIRE(poolResult);
+    auto pool = *poolResult;
+
+    std::vector<VkDescriptorSetLayout> layouts(setCount, layout.GetHandle());
+    std::vector<VkDescriptorSet> sets(setCount);
+    REQUIRE(pool.Allocate(TKit::Span<const VkDescriptorSetLayout>(layouts.data(), setCount),
+                          TKit::Span<VkDescriptorSet>(sets.data(), setCount)));
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.maxLod = 1.f;
+
+    VkSampler sampler;
+    REQUIRE(proxy.Table->CreateSampler(proxy, &samplerInfo, proxy.AllocationCallbacks, &sampler) == VK_SUCCESS);
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = sampler;
+    const std::vector<VkDescriptorImageInfo> imageInfos(4, imageInfo);
+
+    BENCHMARK("Writer")
+    {
+        for (const VkDescriptorSet set : sets)
+        {
+            VKit::DescriptorSet::Writer writer{proxy, &layout};
+            writer.WriteImage(0, imageInfo);
+            writer.WriteImage(1, TKit::Span<const VkDescriptorImageInfo>(imageInfos.data(), 4));
+            writer.Overwrite(set);
+        }
+    };
+
+    BENCHMARK("TemplateWriter")
+    {
+        for (const VkDescriptorSet set : sets)
+        {
+            VKit::DescriptorSet::TemplateWriter writer{proxy, &layout};
+            writer.WriteImage(0, imageInfo);
+            writer.WriteImage(1, TKit::Span<const VkDescriptorImageInfo>(imageInfos.data(), 4));
+            writer.Overwrite(set);
+        }
+    };
+
+    BENCHMARK("TemplateWriter (reused data)")
+    {
+        VKit::DescriptorSet::TemplateWriter writer{proxy, &layout};
+        writer.WriteImage(0, imageInfo);
+        writer.WriteImage(1, TKit::Span<const VkDescriptorImageInfo>(imageInfos.data(), 4));
+        for (const VkDescriptorSet set : sets)
+            writer.Overwrite(set);
+    };
+
+    proxy.Table->DestroySampler(proxy, sampler, proxy.AllocationCallbacks);
+    pool.Destroy();
+    layout.Destroy();
+}
+#endif
+
+// ============================================================================
+// PUSH DESCRIPTORS
+// ============================================================================
+
+#if defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)
+TEST_CASE("DescriptorSet - Push Descriptors and Push Templates", "[descriptors][push]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    const VKit::PhysicalDevice &device = ctx.GetPhysicalDevice();
+    if (!device.IsExtensionEnabled(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) ||
+        !device.IsExtensionEnabled(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME))
+        SKIP("VK_KHR_push_descriptor or VK_KHR_descriptor_update_template is not supported");
+
+    auto proxy = ctx.GetProxy();
+    auto layoutResult = VKit::DescriptorSetLayout::Builder(proxy)
+                            .AddBinding(0, VK_DESCRIPTOR_TYPE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT)
+                            .AddBinding(1, VK_DESCRIPTOR_TYPE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT, 2)
+                            .SetFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR)
+                            .SetUpdateTemplate()
+                            .Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+    CHECK(layout.IsPushDescriptor());
+
+    // push templates depend on the pipeline layout, so only the packing is computed along with the set layout
+    CHECK(layout.GetUpdateTemplate() == VK_NULL_HANDLE);
+    CHECK(layout.GetTemplateInfo().Entries.GetSize() == 2);
+
+    const VkDescriptorSetLayout setLayout = layout;
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &setLayout;
+
+    VkPipelineLayout pipelineLayout;
+    REQUIRE(proxy.Table->CreatePipelineLayout(proxy, &pipelineLayoutInfo, proxy.AllocationCallbacks,
+                                              &pipelineLayout) == VK_SUCCESS);
+
+    // templates can only come from push descriptor layouts built with an update template
+    auto plainResult = VKit::DescriptorSetLayout::Builder(proxy)
+                           .AddBinding(0, VK_DESCRIPTOR_TYPE_SAMPLER, VK_SHADER_STAGE_FRAGMENT_BIT)
+                           .SetFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR)
+                           .Build();
+    REQUIRE(plainResult);
+    auto plain = *plainResult;
+    CHECK(!plain.CreatePushTemplate(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout));
+    plain.Destroy();
+
+    auto templateResult = layout.CreatePushTemplate(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout);
+    REQUIRE(templateResult);
+    auto pushTemplate = *templateResult;
+    CHECK(pushTemplate);
+    CHECK(pushTemplate.GetPipelineLayout() == pipelineLayout);
+    CHECK(pushTemplate.GetSet() == 0);
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.maxLod = 1.f;
+
+    VkSampler sampler;
+    REQUIRE(proxy.Table->CreateSampler(proxy, &samplerInfo, proxy.AllocationCallbacks, &sampler) == VK_SUCCESS);
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = sampler;
+    const std::vector<VkDescriptorImageInfo> imageInfos(2, imageInfo);
+
+    auto poolResult = VKit::CommandPool::Create(proxy, device.GetInfo().FamilyIndices[VKit::Queue_Graphics], 0);
+    REQUIRE(poolResult);
+    auto pool = *poolResult;
+    auto commandResult = pool.Allocate();
+    REQUIRE(commandResult);
+    const VkCommandBuffer commandBuffer = *commandResult;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    REQUIRE(proxy.Table->BeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS);
+
+    VKit::DescriptorSet::Writer writer{proxy, &layout};
+    writer.WriteImage(0, imageInfo);
+    writer.WriteImage(1, TKit::Span<const VkDescriptorImageInfo>(imageInfos.data(), 2));
+    writer.Push(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0);
+
+    VKit::DescriptorSet::TemplateWriter templateWriter{proxy, &layout};
+    templateWriter.WriteImage(0, imageInfo);
+    templateWriter.WriteImage(1, TKit::Span<const VkDescriptorImageInfo>(imageInfos.data(), 2));
+    templateWriter.Push(commandBuffer, pushTemplate);
+
+    CHECK(proxy.Table->EndCommandBuffer(commandBuffer) == VK_SUCCESS);
+
+    pool.Destroy();
+    pushTemplate.Destroy();
+    CHECK(!pushTemplate);
+    proxy.Table->DestroySampler(proxy, sampler, proxy.AllocationCallbacks);
+    proxy.Table->DestroyPipelineLayout(proxy, pipelineLayout, proxy.AllocationCallbacks);
+    layout.Destroy();
+}
+#endif
+
+// ============================================================================
+// BINDLESS HEAP
+// ============================================================================
+
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_EXT_descriptor_indexing)
+TEST_CASE("BindlessHeap - Free Lists and Timeline Reclaim", "[descriptors][bindless]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+
+    const auto createBuilder = [&proxy](const u32 sampledImages) {
+        VKit::BindlessHeap::Builder builder{proxy};
+        builder.SetCapacity(VKit::Bindless_SampledImage, sampledImages)
+            .SetCapacity(VKit::Bindless_StorageImage, 0)
+            .SetCapacity(VKit::Bindless_StorageBuffer, 0)
+            .SetCapacity(VKit::Bindless_Sampler, 0)
+            .SetStages(VK_SHADER_STAGE_FRAGMENT_BIT);
+        return builder;
+    };
+    CHECK(!createBuilder(0).Build());
+
+    if (!ctx.HasDescriptorIndexing())
+        SKIP("Update-after-bind sampled images are not supported");
+
+    auto heapResult = createBuilder(4).Build();
+    REQUIRE(heapResult);
+    auto heap = *heapResult;
+    CHECK(heap);
+    CHECK(heap.GetLayout());
+    CHECK(heap.GetInfo().Capacities[VKit::Bindless_SampledImage] == 4);
+
+    for (u32 i = 0; i < 4; ++i)
+    {
+        const auto result = heap.Allocate(VKit::Bindless_SampledImage);
+        REQUIRE(result);
+        CHECK(*result == i);
+    }
+    CHECK(heap.GetAllocatedCount(VKit::Bindless_SampledImage) == 4);
+    CHECK(!heap.Allocate(VKit::Bindless_SampledImage));
+    CHECK(!heap.Allocate(VKit::Bindless_StorageBuffer));
+    CHECK(heap.GetAllocatedCount(VKit::Bindless_StorageBuffer) == 0);
+
+    heap.Release(VKit::Bindless_SampledImage, 1, 5);
+    heap.Release(VKit::Bindless_SampledImage, 3, 7);
+
+    // released slots stay in use until their timeline value completes
+    heap.Reclaim(4);
+    CHECK(heap.GetAllocatedCount(VKit::Bindless_SampledImage) == 4);
+    CHECK(!heap.Allocate(VKit::Bindless_SampledImage));
+
+    heap.Reclaim(5);
+    CHECK(heap.GetAllocatedCount(VKit::Bindless_SampledImage) == 3);
+    auto reused = heap.Allocate(VKit::Bindless_SampledImage);
+    REQUIRE(reused);
+    CHECK(*reused == 1);
+    CHECK(!heap.Allocate(VKit::Bindless_SampledImage));
+
+    heap.Reclaim(7);
+    reused = heap.Allocate(VKit::Bindless_SampledImage);
+    REQUIRE(reused);
+    CHECK(*reused == 3);
+    CHECK(heap.GetAllocatedCount(VKit::Bindless_SampledImage) == 4);
+
+    // a reused slot may be released again
+    heap.Release(VKit::Bindless_SampledImage, 1, 8);
+    heap.Reclaim(8);
+    CHECK(heap.GetAllocatedCount(VKit::Bindless_SampledImage) == 3);
+
+    heap.Destroy();
+    CHECK(heap.GetAllocatedCount(VKit::Bindless_SampledImage) == 0);
+    CHECK(!heap);
+}
+#endif
+
+// ============================================================================
+// DESCRIPTOR BUFFER
+// ============================================================================
+
+#ifdef VKIT_TEST_DESCRIPTOR_BUFFER
+TEST_CASE("DescriptorBuffer - Set Offsets and Sizes", "[descriptors][descriptor_buffer]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    if (!ctx.HasDescriptorBuffer())
+        SKIP("VK_EXT_descriptor_buffer is not supported");
+
+    auto proxy = ctx.GetProxy();
+    auto layoutResult = VKit::DescriptorSetLayout::Builder(proxy)
+                            .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+                            .AddBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT, 3)
+                            .SetFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT)
+                            .Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    auto bufferResult =
+        VKit::DescriptorBuffer::Builder(ctx.GetLogicalDevice(), ctx.GetAllocator()).SetSize(4096).Build();
+    REQUIRE(bufferResult);
+    auto buffer = *bufferResult;
+
+    const VkDeviceSize alignment = buffer.GetInfo().Properties.descriptorBufferOffsetAlignment;
+    const VkDeviceSize uniformSize = buffer.GetDescriptorSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    const VkDeviceSize storageSize = buffer.GetDescriptorSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT &properties = buffer.GetInfo().Properties;
+    if (ctx.GetPhysicalDevice().GetInfo().EnabledFeatures.Core.robustBufferAccess)
+    {
+        CHECK(uniformSize == properties.robustUniformBufferDescriptorSize);
+        CHECK(storageSize == properties.robustStorageBufferDescriptorSize);
+    }
+    else
+    {
+        CHECK(uniformSize == properties.uniformBufferDescriptorSize);
+        CHECK(storageSize == properties.storageBufferDescriptorSize);
+    }
+
+    // binding offsets are implementation defined, but every binding must fit inside the set
+    const VkDeviceSize setSize = layout.GetDescriptorBufferSize();
+    CHECK(setSize >= uniformSize + 3 * storageSize);
+    CHECK(layout.GetDescriptorBufferOffset(0) + uniformSize <= setSize);
+    CHECK(layout.GetDescriptorBufferOffset(1) + 3 * storageSize <= setSize);
+
+    VkDeviceSize used = 0;
+    for (u32 i = 0; i < 4; ++i)
+    {
+        const auto offsetResult = buffer.Allocate(layout);
+        REQUIRE(offsetResult);
+        CHECK(*offsetResult % alignment == 0);
+        CHECK(*offsetResult >= used);
+        CHECK(buffer.GetUsedSize() == *offsetResult + setSize);
+        used = buffer.GetUsedSize();
+    }
+
+    while (buffer.Allocate(layout))
+        ;
+    CHECK(buffer.GetUsedSize() <= buffer.GetBuffer().GetInfo().Size);
+
+    buffer.Reset();
+    CHECK(buffer.GetUsedSize() == 0);
+    const auto offsetResult = buffer.Allocate(layout);
+    REQUIRE(offsetResult);
+    CHECK(*offsetResult == 0);
+
+    buffer.Destroy();
+    CHECK(!buffer);
+    layout.Destroy();
+}
+#endif
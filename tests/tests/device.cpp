@@ -11,6 +11,7 @@
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "vkit/core/core.hpp"
+#include "vkit/core/name_registry.hpp"
 #include "vkit/vulkan/instance.hpp"
 #include "vkit/device/physical_device.hpp"
 #include "vkit/device/logical_device.hpp"
@@ -291,6 +292,56 @@ TEST_CASE("IsLayerSupported", "[core][layers]")
     }
 }
 
+TEST_CASE("NameRegistry", "[core][names]")
+{
+    CoreGuard guard;
+    REQUIRE(guard.IsValid());
+
+    SECTION("Interning is idempotent")
+    {
+        const u32 id = VKit::InternName("VK_TEST_interned_extension");
+        CHECK(id != VKit::NullName);
+        CHECK(VKit::InternName("VK_TEST_interned_extension") == id);
+        CHECK(VKit::FindName("VK_TEST_interned_extension") == id);
+        CHECK(std::strcmp(VKit::GetInternedName(id), "VK_TEST_interned_extension") == 0);
+    }
+
+    SECTION("Finding never interns")
+    {
+        const u32 count = VKit::GetInternedNameCount();
+        CHECK(VKit::FindName("VK_FAKE_never_interned_12345") == VKit::NullName);
+        CHECK(VKit::GetInternedNameCount() == count);
+    }
+
+    SECTION("Available extensions are interned")
+    {
+        for (u32 i = 0; i < VKit::GetExtensionCount(); ++i)
+            CHECK(VKit::FindName(VKit::GetExtensionByIndex(i).extensionName) != VKit::NullName);
+    }
+
+    SECTION("NameSet membership and inclusion")
+    {
+        VKit::NameSet set{};
+        CHECK(set.IsEmpty());
+        CHECK(set.Insert("VK_TEST_set_a"));
+        CHECK_FALSE(set.Insert("VK_TEST_set_a"));
+        CHECK(set.Insert("VK_TEST_set_b"));
+        CHECK(set.GetSize() == 2);
+        CHECK(set.Contains("VK_TEST_set_a"));
+        CHECK_FALSE(set.Contains("VK_FAKE_never_interned_12345"));
+
+        VKit::NameSet subset{};
+        subset.Insert("VK_TEST_set_b");
+        CHECK(set.ContainsAll(subset));
+        CHECK_FALSE(subset.ContainsAll(set));
+        CHECK(set.ContainsAll(VKit::NameSet{}));
+
+        set.Clear();
+        CHECK(set.IsEmpty());
+        CHECK_FALSE(set.Contains("VK_TEST_set_a"));
+    }
+}
+
 // ============================================================================
 // INSTANCE BUILDER TESTS
 // ============================================================================
@@ -1272,6 +1323,55 @@ TEST_CASE("LogicalDevice - Proxy Creation", "[logical_device][proxy]")
     device.Destroy();
 }
 
+#ifdef VK_EXT_debug_utils
+TEST_CASE("LogicalDevice - Debug Utils Object Names", "[logical_device][debug_utils]")
+{
+    CoreGuard coreGuard;
+    REQUIRE(coreGuard.IsValid());
+
+    auto instanceResult = VKit::Instance::Builder()
+                              .SetApplicationName("VKit Debug Utils Test")
+                              .RequireApiVersion(1, 0, 0)
+                              .RequestExtension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+                              .SetHeadless(true)
+                              .Build();
+    REQUIRE(instanceResult);
+    InstanceGuard instanceGuard(std::move(*instanceResult));
+    if (!instanceGuard.Get().IsExtensionEnabled(VK_EXT_DEBUG_UTILS_EXTENSION_NAME))
+    {
+        SKIP("VK_EXT_debug_utils is not supported");
+    }
+
+    auto physicalResult = VKit::PhysicalDevice::Selector(&instanceGuard.Get())
+                              .AddFlags(VKit::DeviceSelectorFlag_AnyType)
+                              .AddFlags(VKit::DeviceSelectorFlag_RequireGraphicsQueue)
+                              .RemoveFlags(VKit::DeviceSelectorFlag_RequirePresentQueue)
+                              .Select();
+
+    if (!physicalResult)
+    {
+        SKIP("No suitable physical device available");
+    }
+
+    VKit::PhysicalDevice physicalDevice = *physicalResult;
+
+    auto deviceResult = VKit::LogicalDevice::Builder(&instanceGuard.Get(), &physicalDevice)
+                            .RequireQueue(VKit::Queue_Graphics, 1)
+                            .Build();
+    REQUIRE(deviceResult);
+    VKit::LogicalDevice device = *deviceResult;
+
+    // the extension belongs to the instance, but its functions live in the device table
+    const auto proxy = device.CreateProxy();
+    CHECK(proxy.Table->vkSetDebugUtilsObjectNameEXT != nullptr);
+    CHECK(proxy.Table->vkCmdBeginDebugUtilsLabelEXT != nullptr);
+    CHECK(proxy.Table->vkQueueBeginDebugUtilsLabelEXT != nullptr);
+    CHECK(proxy.SetObjectName(device.GetHandle(), VK_OBJECT_TYPE_DEVICE, "VKit Test Device"));
+
+    device.Destroy();
+}
+#endif
+
 TEST_CASE("LogicalDevice - FindSupportedFormat", "[logical_device][format]")
 {
     CoreGuard coreGuard;
@@ -1420,6 +1520,71 @@ TEST_CASE("LogicalDevice - Queue Access", "[logical_device][queues]")
     device.Destroy();
 }
 
+TEST_CASE("LogicalDevice::Builder - Startup Benchmark", "[.][benchmark][logical_device]")
+{
+    CoreGuard coreGuard;
+    REQUIRE(coreGuard.IsValid());
+
+    // no validation layers, as they would dominate the measurement
+    auto instanceResult = CreateMinimalInstance();
+    REQUIRE(instanceResult);
+    InstanceGuard instanceGuard(std::move(*instanceResult));
+
+    auto physicalResult = VKit::PhysicalDevice::Selector(&instanceGuard.Get())
+                              .AddFlags(VKit::DeviceSelectorFlag_AnyType)
+                              .AddFlags(VKit::DeviceSelectorFlag_RequireGraphicsQueue)
+                              .RemoveFlags(VKit::DeviceSelectorFlag_RequirePresentQueue)
+                              .Select();
+
+    if (!physicalResult)
+    {
+        SKIP("No suitable physical device available");
+    }
+
+    VKit::PhysicalDevice physicalDevice = *physicalResult;
+
+    BENCHMARK("Build")
+    {
+        auto result = VKit::LogicalDevice::Builder(&instanceGuard.Get(), &physicalDevice)
+                          .RequireQueue(VKit::Queue_Graphics, 1)
+                          .Build();
+        if (result)
+            result->Destroy();
+        return bool(result);
+    };
+
+    auto deviceResult = VKit::LogicalDevice::Builder(&instanceGuard.Get(), &physicalDevice)
+                            .RequireQueue(VKit::Queue_Graphics, 1)
+                            .Build();
+    REQUIRE(deviceResult);
+    VKit::LogicalDevice device = *deviceResult;
+
+    const VKit::PhysicalDevice::Info &devInfo = physicalDevice.GetInfo();
+    TKit::TierArray<const char *> extensions;
+    for (const TKit::TierString &extension : devInfo.EnabledExtensions)
+        extensions.Append(extension.CString());
+
+    // loading everything the loader knows about, regardless of what the device enabled, is what loading only the
+    // enabled version and extensions is compared against. each lookup still goes through vkGetDeviceProcAddr()
+    TKit::TierArray<const char *> available;
+    for (const TKit::TierString &extension : devInfo.AvailableExtensions)
+        available.Append(extension.CString());
+
+    const VKit::Vulkan::InstanceTable &itable = *instanceGuard.Get().GetInfo().Table;
+    BENCHMARK("DeviceTable::Create (enabled version and extensions)")
+    {
+        return VKit::Vulkan::DeviceTable::Create(device, itable, devInfo.ApiVersion, extensions.GetSize(),
+                                                 extensions.GetData());
+    };
+    BENCHMARK("DeviceTable::Create (every version and available extension)")
+    {
+        return VKit::Vulkan::DeviceTable::Create(device, itable, TKIT_U32_MAX, available.GetSize(),
+                                                 available.GetData());
+    };
+
+    device.Destroy();
+}
+
 // ============================================================================
 // FULL PIPELINE INTEGRATION TEST
 // ============================================================================
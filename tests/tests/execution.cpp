@@ -13,6 +13,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_section_info.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 #include "vkit/core/core.hpp"
 #include "vkit/vulkan/instance.hpp"
@@ -22,6 +23,7 @@
 #include "vkit/execution/queue.hpp"
 
 #include <vector>
+#include <memory>
 
 using namespace TKit::Alias;
 
@@ -1094,3 +1096,136 @@ TEST_CASE("Integration - Multi-Queue Operations", "[integration][multi_queue]")
     computePool.Destroy();
     transferPool.Destroy();
 }
+
+// Build with VULKIT_UNCHECKED_DISPATCH to compare the unchecked wrappers against the raw function pointers.
+TEST_CASE("DeviceTable - Dispatch Overhead", "[.][benchmark][dispatch]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+
+    auto poolResult =
+        VKit::CommandPool::Create(proxy, ctx.GetGraphicsFamily(), VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    REQUIRE(poolResult);
+    auto pool = *poolResult;
+
+    auto allocResult = pool.Allocate();
+    REQUIRE(allocResult);
+    const VkCommandBuffer cmd = *allocResult;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    REQUIRE(proxy.Table->BeginCommandBuffer(cmd, &beginInfo) == VK_SUCCESS);
+
+    constexpr u32 calls = 4096;
+    const f32 constants[4] = {0.f, 0.25f, 0.5f, 1.f};
+
+    BENCHMARK("Wrapper")
+    {
+        for (u32 i = 0; i < calls; ++i)
+            proxy.Table->CmdSetBlendConstants(cmd, constants);
+    };
+
+    BENCHMARK("Raw function pointer")
+    {
+        for (u32 i = 0; i < calls; ++i)
+            proxy.Table->vkCmdSetBlendConstants(cmd, constants);
+    };
+
+    REQUIRE(proxy.Table->EndCommandBuffer(cmd) == VK_SUCCESS);
+    pool.Destroy();
+}
+
+// Compares the hot-first layout of the device table against the vk.xml order it replaced, within a single binary. The
+// default layout spreads the commands recorded every frame across the whole table, which is modeled by placing the
+// same pointers a third of the table apart. Between groups, a scratch buffer larger than most L1 caches is touched to
+// stand for the work an application does between recording calls, so that table entries have to be fetched again.
+TEST_CASE("DeviceTable - Recording Large Command Stream", "[.][benchmark][dispatch]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+
+    auto poolResult =
+        VKit::CommandPool::Create(proxy, ctx.GetGraphicsFamily(), VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    REQUIRE(poolResult);
+    auto pool = *poolResult;
+
+    auto allocResult = pool.Allocate();
+    REQUIRE(allocResult);
+    const VkCommandBuffer cmd = *allocResult;
+
+    constexpr u32 groups = 1024;
+    constexpr u32 cacheLine = 64;
+
+    VkViewport viewport{};
+    viewport.width = 1920.f;
+    viewport.height = 1080.f;
+    viewport.maxDepth = 1.f;
+
+    VkRect2D scissor{};
+    scissor.extent = {1920, 1080};
+
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    const VKit::Vulkan::DeviceTable *table = proxy.Table;
+
+    struct SpreadTable
+    {
+        static constexpr usize Gap = sizeof(VKit::Vulkan::DeviceTable) / 3;
+        alignas(cacheLine) PFN_vkCmdSetViewport vkCmdSetViewport;
+        alignas(cacheLine) u8 Gap0[Gap];
+        PFN_vkCmdSetScissor vkCmdSetScissor;
+        alignas(cacheLine) u8 Gap1[Gap];
+        PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier;
+    };
+    const auto spread = std::make_unique<SpreadTable>();
+    spread->vkCmdSetViewport = table->vkCmdSetViewport;
+    spread->vkCmdSetScissor = table->vkCmdSetScissor;
+    spread->vkCmdPipelineBarrier = table->vkCmdPipelineBarrier;
+
+    std::vector<u8> scratch(128 * 1024);
+
+    // raw pointers are called in both layouts, so that only where they are read from differs
+    const auto record = [&](const auto &pointers) {
+        VkResult result = table->ResetCommandBuffer(cmd, 0);
+        if (result != VK_SUCCESS)
+            return result;
+        result = table->BeginCommandBuffer(cmd, &beginInfo);
+        if (result != VK_SUCCESS)
+            return result;
+
+        for (u32 i = 0; i < groups; ++i)
+        {
+            for (usize j = 0; j < scratch.size(); j += cacheLine)
+                scratch[j] = static_cast<u8>(i);
+            Catch::Benchmark::keep_memory(scratch.data());
+
+            pointers.vkCmdSetViewport(cmd, 0, 1, &viewport);
+            pointers.vkCmdSetScissor(cmd, 0, 1, &scissor);
+            pointers.vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                                          1, &barrier, 0, nullptr, 0, nullptr);
+        }
+
+        return table->EndCommandBuffer(cmd);
+    };
+
+    BENCHMARK("Hot-first layout")
+    {
+        return record(*table);
+    };
+
+    BENCHMARK("Default layout")
+    {
+        return record(*spread);
+    };
+
+    pool.Destroy();
+}
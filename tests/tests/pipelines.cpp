@@ -0,0 +1,1587 @@
+/**
+ * @file test_pipelines.cpp
+ * @brief Catch2 test suite and benchmarks for VKit pipeline caches and the pipeline compiler
+ */
+
+#undef VKIT_NO_DISCARD
+#define VKIT_NO_DISCARD
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "vkit/core/core.hpp"
+#include "vkit/vulkan/instance.hpp"
+#include "vkit/device/physical_device.hpp"
+#include "vkit/device/logical_device.hpp"
+#include "vkit/state/shader.hpp"
+#include "vkit/state/shader_reflection.hpp"
+#include "vkit/state/shader_cache.hpp"
+#include "vkit/state/shader_watcher.hpp"
+#include "vkit/state/pipeline_layout.hpp"
+#include "vkit/state/pipeline_cache.hpp"
+#include "vkit/state/compute_pipeline.hpp"
+#include "vkit/state/pipeline_compiler.hpp"
+#include "vkit/state/pipeline_state_key.hpp"
+#include "vkit/state/pipeline_stats.hpp"
+#include "vkit/state/vertex_layout.hpp"
+#include "vkit/state/pipeline_library.hpp"
+#include "vkit/state/pipeline_variants.hpp"
+#include "vkit/state/dynamic_state.hpp"
+#include "vkit/state/shader_object.hpp"
+#include "vkit/execution/command_pool.hpp"
+
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <chrono>
+
+using namespace TKit::Alias;
+
+namespace
+{
+
+// ============================================================================
+// Test Context Management
+// ============================================================================
+
+class TestContext
+{
+  public:
+    static TestContext &Get()
+    {
+        static TestContext instance;
+        return instance;
+    }
+
+    bool IsValid() const
+    {
+        return m_Valid;
+    }
+
+    VKit::ProxyDevice GetProxy() const
+    {
+        return m_LogicalDevice->CreateProxy();
+    }
+
+    const VKit::PhysicalDevice &GetPhysicalDevice() const
+    {
+        return *m_PhysicalDevice;
+    }
+
+#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+    bool HasPipelineLibrary() const
+    {
+        return m_LibraryFeatures.graphicsPipelineLibrary == VK_TRUE;
+    }
+#endif
+#ifdef VK_EXT_shader_object
+    bool HasShaderObject() const
+    {
+        return m_ShaderObjectFeatures.shaderObject == VK_TRUE;
+    }
+#endif
+
+  private:
+    TestContext()
+    {
+        Initialize();
+    }
+
+    ~TestContext()
+    {
+        Shutdown();
+    }
+
+    void Initialize()
+    {
+        // other test files share the loaded library and `Terminate()` is not reference counted, so it is left for the
+        // process exit to unload
+        if (!VKit::Initialize())
+            return;
+
+        auto instanceResult = VKit::Instance::Builder()
+                                  .SetApplicationName("VKit Pipeline Tests")
+                                  .RequireApiVersion(1, 0, 0)
+                                  .RequestApiVersion(1, 2, 0)
+                                  .SetHeadless(true)
+                                  .Build();
+        if (!instanceResult)
+            return;
+        m_Instance = new VKit::Instance(*instanceResult);
+
+        auto physicalResult = VKit::PhysicalDevice::Selector(m_Instance)
+                                  .PreferType(VKit::Device_Discrete)
+                                  .AddFlags(VKit::DeviceSelectorFlag_AnyType)
+                                  .RemoveFlags(VKit::DeviceSelectorFlag_RequirePresentQueue)
+                                  .RequestExtension(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME)
+#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+                                  .RequestExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME)
+                                  .RequestExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME)
+#endif
+#ifdef VK_EXT_shader_object
+                                  // shader objects depend on dynamic rendering, which is core since 1.3
+                                  .RequestExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME)
+                                  .RequestExtension(VK_EXT_SHADER_OBJECT_EXTENSION_NAME)
+#endif
+                                  .Select();
+        if (!physicalResult)
+        {
+            m_Instance->Destroy();
+            delete m_Instance;
+            return;
+        }
+        m_PhysicalDevice = new VKit::PhysicalDevice(*physicalResult);
+#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+        // the feature is mandatory for devices exposing the extension
+        if (m_PhysicalDevice->IsExtensionEnabled(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+            m_PhysicalDevice->IsExtensionEnabled(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+        {
+            m_LibraryFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+            m_LibraryFeatures.graphicsPipelineLibrary = VK_TRUE;
+            m_PhysicalDevice->EnableExtensionBoundFeature(&m_LibraryFeatures);
+        }
+#endif
+#ifdef VK_EXT_shader_object
+        // the feature is mandatory for devices exposing the extension
+        if (m_PhysicalDevice->IsExtensionEnabled(VK_EXT_SHADER_OBJECT_EXTENSION_NAME))
+        {
+            m_ShaderObjectFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT;
+            m_ShaderObjectFeatures.shaderObject = VK_TRUE;
+            m_PhysicalDevice->EnableExtensionBoundFeature(&m_ShaderObjectFeatures);
+        }
+#endif
+
+        auto logicalResult = VKit::LogicalDevice::Builder(m_Instance, m_PhysicalDevice)
+                                 .RequireQueue(VKit::Queue_Graphics, 1, 1.0f)
+                                 .Build();
+        if (!logicalResult)
+        {
+            m_Instance->Destroy();
+            delete m_PhysicalDevice;
+            delete m_Instance;
+            return;
+        }
+        m_LogicalDevice = new VKit::LogicalDevice(*logicalResult);
+        m_Valid = true;
+    }
+
+    void Shutdown()
+    {
+        if (m_Valid)
+        {
+            m_LogicalDevice->WaitIdle();
+            m_LogicalDevice->Destroy();
+            m_Instance->Destroy();
+            delete m_LogicalDevice;
+            delete m_PhysicalDevice;
+            delete m_Instance;
+            m_Valid = false;
+        }
+    }
+
+    bool m_Valid = false;
+    VKit::Instance *m_Instance = nullptr;
+    VKit::PhysicalDevice *m_PhysicalDevice = nullptr;
+    VKit::LogicalDevice *m_LogicalDevice = nullptr;
+#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT m_LibraryFeatures{};
+#endif
+#ifdef VK_EXT_shader_object
+    VkPhysicalDeviceShaderObjectFeaturesEXT m_ShaderObjectFeatures{};
+#endif
+};
+
+// minimal compute shader with a configurable local size, so that distinct pipelines can be generated:
+// #version 450
+// layout(local_size_x = N) in;
+// void main() {}
+std::vector<u32> CreateComputeSpirv(const u32 localSizeX)
+{
+    return {0x07230203, 0x00010000, 0,          5,          0,          0x00020011, 1,          0x0003000E, 0,
+            1,          0x0005000F, 5,          1,          0x6E69616D, 0,          0x00060010, 1,          17,
+            localSizeX, 1,          1,          0x00020013, 2,          0x00030021, 3,          2,          0x00050036,
+            2,          1,          0,          3,          0x000200F8, 4,          0x000100FD, 0x00010038};
+}
+
+// minimal vertex or fragment shader, for graphics pipelines that are never drawn with:
+// #version 450
+// void main() {}
+std::vector<u32> CreateGraphicsSpirv(const VkShaderStageFlagBits stage)
+{
+    if (stage == VK_SHADER_STAGE_VERTEX_BIT)
+        return {0x07230203, 0x00010000, 0,          5,          0,          0x00020011, 1,          0x0003000E,
+                0,          1,          0x0005000F, 0,          1,          0x6E69616D, 0,          0x00020013,
+                2,          0x00030021, 3,          2,          0x00050036, 2,          1,          0,
+                3,          0x000200F8, 4,          0x000100FD, 0x00010038};
+
+    // fragment shaders also need an origin execution mode
+    return {0x07230203, 0x00010000, 0,          5,          0,          0x00020011, 1,          0x0003000E, 0,
+            1,          0x0005000F, 4,          1,          0x6E69616D, 0,          0x00030010, 1,          7,
+            0x00020013, 2,          0x00030021, 3,          2,          0x00050036, 2,          1,          0,
+            3,          0x000200F8, 4,          0x000100FD, 0x00010038};
+}
+
+// appends a SPIR-V instruction, so that the reflection tests can spell out their modules one instruction at a time
+void EmitSpirv(std::vector<u32> &spirv, const u32 opcode, const std::initializer_list<u32> operands)
+{
+    spirv.push_back((static_cast<u32>(operands.size() + 1) << 16) | opcode);
+    spirv.insert(spirv.end(), operands);
+}
+
+// module with every kind of resource reflection reads. for the vertex stage:
+// #version 450
+// layout(location = 0) in vec3 inPosition;
+// layout(location = 1) in vec2 inUv;
+// layout(set = 0, binding = 0) uniform Camera { mat4 ViewProjection; };
+// layout(set = 1, binding = 2) uniform sampler2D textures[4];
+// layout(push_constant) uniform Push { vec4 Color; uint Index; };
+// void main() {}
+// for the fragment stage, the texture array is runtime sized, the push constant block only holds
+// `layout(offset = 16) uint Index` and a storage buffer is bound to binding 1 of set 3, or to binding 0 of set 0 when
+// `conflicting` is set, clashing with the uniform buffer
+std::vector<u32> CreateReflectionSpirv(const VkShaderStageFlagBits stage, const bool conflicting = false)
+{
+    enum : u32
+    {
+        Void = 1,
+        Function,
+        Main,
+        Label,
+        Float,
+        Uint,
+        Vec2,
+        Vec3,
+        Vec4,
+        Mat4,
+        Four,
+        Image,
+        SampledImage,
+        Textures,
+        Camera,
+        Push,
+        Storage,
+        CameraPtr,
+        TexturesPtr,
+        PushPtr,
+        StoragePtr,
+        Vec3Ptr,
+        Vec2Ptr,
+        CameraVar,
+        TexturesVar,
+        PushVar,
+        StorageVar,
+        PositionVar,
+        UvVar,
+        Bound
+    };
+
+    const bool vertex = stage == VK_SHADER_STAGE_VERTEX_BIT;
+    std::vector<u32> spirv{0x07230203, 0x00010000, 0, Bound, 0};
+    EmitSpirv(spirv, 17, {1});    // OpCapability Shader
+    EmitSpirv(spirv, 14, {0, 1}); // OpMemoryModel Logical GLSL450
+    if (vertex)
+        EmitSpirv(spirv, 15, {0, Main, 0x6E69616D, 0, PositionVar, UvVar}); // OpEntryPoint Vertex
+    else
+    {
+        EmitSpirv(spirv, 15, {4, Main, 0x6E69616D, 0}); // OpEntryPoint Fragment
+        EmitSpirv(spirv, 16, {Main, 7});                // OpExecutionMode OriginUpperLeft
+    }
+
+    // OpDecorate and OpMemberDecorate: Block, Offset, MatrixStride, DescriptorSet, Binding and Location
+    EmitSpirv(spirv, 71, {Camera, 2});
+    EmitSpirv(spirv, 72, {Camera, 0, 35, 0});
+    EmitSpirv(spirv, 72, {Camera, 0, 7, 16});
+    EmitSpirv(spirv, 71, {CameraVar, 34, 0});
+    EmitSpirv(spirv, 71, {CameraVar, 33, 0});
+    EmitSpirv(spirv, 71, {TexturesVar, 34, 1});
+    EmitSpirv(spirv, 71, {TexturesVar, 33, 2});
+    EmitSpirv(spirv, 71, {Push, 2});
+    if (vertex)
+    {
+        EmitSpirv(spirv, 72, {Push, 0, 35, 0});
+        EmitSpirv(spirv, 72, {Push, 1, 35, 16});
+        EmitSpirv(spirv, 71, {PositionVar, 30, 0});
+        EmitSpirv(spirv, 71, {UvVar, 30, 1});
+    }
+    else
+    {
+        EmitSpirv(spirv, 72, {Push, 0, 35, 16});
+        EmitSpirv(spirv, 71, {Storage, 2});
+        EmitSpirv(spirv, 72, {Storage, 0, 35, 0});
+        EmitSpirv(spirv, 71, {StorageVar, 34, conflicting ? 0U : 3U});
+        EmitSpirv(spirv, 71, {StorageVar, 33, conflicting ? 0U : 1U});
+    }
+
+    EmitSpirv(spirv, 19, {Void});                            // OpTypeVoid
+    EmitSpirv(spirv, 33, {Function, Void});                  // OpTypeFunction
+    EmitSpirv(spirv, 22, {Float, 32});                       // OpTypeFloat
+    EmitSpirv(spirv, 21, {Uint, 32, 0});                     // OpTypeInt
+    EmitSpirv(spirv, 23, {Vec2, Float, 2});                  // OpTypeVector
+    EmitSpirv(spirv, 23, {Vec3, Float, 3});                  // OpTypeVector
+    EmitSpirv(spirv, 23, {Vec4, Float, 4});                  // OpTypeVector
+    EmitSpirv(spirv, 24, {Mat4, Vec4, 4});                   // OpTypeMatrix
+    EmitSpirv(spirv, 43, {Uint, Four, 4});                   // OpConstant
+    EmitSpirv(spirv, 25, {Image, Float, 1, 0, 0, 0, 1, 0}); // OpTypeImage 2D, sampled
+    EmitSpirv(spirv, 27, {SampledImage, Image});             // OpTypeSampledImage
+    if (vertex)
+        EmitSpirv(spirv, 28, {Textures, SampledImage, Four}); // OpTypeArray
+    else
+        EmitSpirv(spirv, 29, {Textures, SampledImage}); // OpTypeRuntimeArray
+    EmitSpirv(spirv, 30, {Camera, Mat4});                // OpTypeStruct
+    if (vertex)
+        EmitSpirv(spirv, 30, {Push, Vec4, Uint});
+    else
+    {
+        EmitSpirv(spirv, 30, {Push, Uint});
+        EmitSpirv(spirv, 30, {Storage, Uint});
+    }
+
+    // OpTypePointer and OpVariable, with the Uniform, UniformConstant, PushConstant, StorageBuffer and Input classes
+    EmitSpirv(spirv, 32, {CameraPtr, 2, Camera});
+    EmitSpirv(spirv, 32, {TexturesPtr, 0, Textures});
+    EmitSpirv(spirv, 32, {PushPtr, 9, Push});
+    EmitSpirv(spirv, 59, {CameraPtr, CameraVar, 2});
+    EmitSpirv(spirv, 59, {TexturesPtr, TexturesVar, 0});
+    EmitSpirv(spirv, 59, {PushPtr, PushVar, 9});
+    if (vertex)
+    {
+        EmitSpirv(spirv, 32, {Vec3Ptr, 1, Vec3});
+        EmitSpirv(spirv, 32, {Vec2Ptr, 1, Vec2});
+        EmitSpirv(spirv, 59, {Vec3Ptr, PositionVar, 1});
+        EmitSpirv(spirv, 59, {Vec2Ptr, UvVar, 1});
+    }
+    else
+    {
+        EmitSpirv(spirv, 32, {StoragePtr, 12, Storage});
+        EmitSpirv(spirv, 59, {StoragePtr, StorageVar, 12});
+    }
+
+    EmitSpirv(spirv, 54, {Void, Main, 0, Function}); // OpFunction
+    EmitSpirv(spirv, 248, {Label});                  // OpLabel
+    EmitSpirv(spirv, 253, {});                       // OpReturn
+    EmitSpirv(spirv, 56, {});                        // OpFunctionEnd
+    return spirv;
+}
+
+const VKit::ShaderReflection::DescriptorBinding *FindBinding(const VKit::ShaderReflection &reflection, const u32 set,
+                                                              const u32 binding)
+{
+    for (const VKit::ShaderReflection::DescriptorBinding &b : reflection.GetBindings())
+        if (b.Set == set && b.Binding == binding)
+            return &b;
+    return nullptr;
+}
+
+// stand-in for vkGetPipelineCacheData, with a cache that another thread grows right after its size is first queried
+usize s_PipelineCacheSize = 0;
+bool s_PipelineCacheGrown = false;
+VKAPI_ATTR VkResult VKAPI_CALL GrowingPipelineCacheData(VkDevice, VkPipelineCache, size_t *size, void *data)
+{
+    if (!data)
+    {
+        *size = s_PipelineCacheSize;
+        if (!s_PipelineCacheGrown)
+            s_PipelineCacheSize *= 2;
+        s_PipelineCacheGrown = true;
+        return VK_SUCCESS;
+    }
+
+    const bool incomplete = *size < s_PipelineCacheSize;
+    *size = std::min(*size, s_PipelineCacheSize);
+    std::memset(data, 0, *size);
+    return incomplete ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+#ifdef VK_EXT_extended_dynamic_state3
+// stand-ins for the dynamic state commands, counting which of the core or EXT entry points were recorded with
+u32 s_CoreStateCommands = 0;
+u32 s_ExtStateCommands = 0;
+
+#    ifdef VKIT_API_VERSION_1_3
+VKAPI_ATTR void VKAPI_CALL CountCoreCullMode(VkCommandBuffer, VkCullModeFlags)
+{
+    ++s_CoreStateCommands;
+}
+VKAPI_ATTR void VKAPI_CALL CountCoreFrontFace(VkCommandBuffer, VkFrontFace)
+{
+    ++s_CoreStateCommands;
+}
+#    endif
+VKAPI_ATTR void VKAPI_CALL CountExtCullMode(VkCommandBuffer, VkCullModeFlags)
+{
+    ++s_ExtStateCommands;
+}
+VKAPI_ATTR void VKAPI_CALL CountExtFrontFace(VkCommandBuffer, VkFrontFace)
+{
+    ++s_ExtStateCommands;
+}
+#endif
+
+struct ContextGuard
+{
+    ContextGuard()
+    {
+        REQUIRE(TestContext::Get().IsValid());
+    }
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// PIPELINE CACHE
+// ============================================================================
+
+TEST_CASE("PipelineCache - Header Validation", "[pipelines][cache]")
+{
+    ContextGuard guard;
+    const VkPhysicalDeviceProperties &properties = TestContext::Get().GetPhysicalDevice().GetInfo().Properties.Core;
+
+    VkPipelineCacheHeaderVersionOne header{};
+    header.headerSize = sizeof(header);
+    header.headerVersion = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+    header.vendorID = properties.vendorID;
+    header.deviceID = properties.deviceID;
+    std::memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    std::vector<std::byte> blob(sizeof(header));
+    std::memcpy(blob.data(), &header, sizeof(header));
+    const auto span = [&blob] { return TKit::Span<const std::byte>(blob.data(), blob.size()); };
+    CHECK(VKit::PipelineCache::IsCompatible(span(), properties));
+
+    header.deviceID = properties.deviceID + 1;
+    std::memcpy(blob.data(), &header, sizeof(header));
+    CHECK(!VKit::PipelineCache::IsCompatible(span(), properties));
+
+    header.deviceID = properties.deviceID;
+    header.pipelineCacheUUID[0] ^= 0xFF;
+    std::memcpy(blob.data(), &header, sizeof(header));
+    CHECK(!VKit::PipelineCache::IsCompatible(span(), properties));
+
+    blob.resize(sizeof(header) / 2);
+    CHECK(!VKit::PipelineCache::IsCompatible(span(), properties));
+}
+
+TEST_CASE("PipelineCache - Save and Load", "[pipelines][cache]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+    const auto &properties = ctx.GetPhysicalDevice().GetInfo().Properties;
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "vulkit-test-pipeline-cache.bin";
+    const std::string pathStr = path.string();
+    std::filesystem::remove(path);
+
+    // the builder keeps its own copy of the path, which the cache then saves to
+    auto cacheResult = VKit::PipelineCache::Builder(proxy, properties).SetPath(std::string{pathStr}).Build();
+    REQUIRE(cacheResult);
+    auto cache = *cacheResult;
+    CHECK(cache.GetInfo().LoadedSize == 0);
+    CHECK(cache.GetInfo().Path == path);
+
+    auto threadResult = VKit::PipelineCache::Builder(proxy, properties).Build();
+    REQUIRE(threadResult);
+    auto threadCache = *threadResult;
+
+    const VkPipelineCache source = threadCache;
+    CHECK(cache.Merge(TKit::Span<const VkPipelineCache>(&source, 1)));
+    REQUIRE(cache.Save());
+    CHECK(std::filesystem::exists(path));
+    CHECK(!std::filesystem::exists(pathStr + ".tmp"));
+
+    threadCache.Destroy();
+    cache.Destroy();
+
+    auto reloadResult = VKit::PipelineCache::Builder(proxy, properties).SetPath(pathStr.c_str()).Build();
+    REQUIRE(reloadResult);
+    auto reloaded = *reloadResult;
+    CHECK(reloaded.GetInfo().LoadedSize == std::filesystem::file_size(path));
+    reloaded.Destroy();
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("PipelineCache - Data Growing While Read", "[pipelines][cache]")
+{
+    // the commands only reach the stand-in, so neither a device nor a cache is needed
+    VKit::Vulkan::DeviceTable table{};
+    table.vkGetPipelineCacheData = GrowingPipelineCacheData;
+    VKit::ProxyDevice proxy{};
+    proxy.Table = &table;
+
+    s_PipelineCacheSize = 16;
+    s_PipelineCacheGrown = false;
+    const VKit::PipelineCache cache{proxy, VK_NULL_HANDLE, VKit::PipelineCache::Info{}};
+    const auto result = cache.GetData();
+    REQUIRE(result);
+    CHECK(result->GetSize() == 32);
+}
+
+TEST_CASE("PipelineCache - Startup Time", "[.][benchmark][pipelines][cache]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+    const auto &properties = ctx.GetPhysicalDevice().GetInfo().Properties;
+
+    constexpr u32 pipelineCount = 64;
+
+    auto layoutResult = VKit::PipelineLayout::Builder(proxy).Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    std::vector<VKit::Shader> shaders{};
+    std::vector<VKit::ComputePipelineSpecs> specs{};
+    for (u32 i = 0; i < pipelineCount; ++i)
+    {
+        const std::vector<u32> spirv = CreateComputeSpirv(i + 1);
+        auto shaderResult = VKit::Shader::Create(proxy, spirv.data(), spirv.size() * sizeof(u32));
+        REQUIRE(shaderResult);
+        shaders.push_back(*shaderResult);
+
+        VKit::ComputePipelineSpecs spc{};
+        spc.Layout = layout;
+        spc.ComputeShader = shaders.back();
+        specs.push_back(spc);
+    }
+
+    const TKit::Span<const VKit::ComputePipelineSpecs> specSpan{specs.data(), pipelineCount};
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "vulkit-bench-pipeline-cache.bin";
+    const std::string pathStr = path.string();
+
+    // warm up the on-disk cache once
+    {
+        auto cacheResult = VKit::PipelineCache::Builder(proxy, properties).Build();
+        REQUIRE(cacheResult);
+        auto cache = *cacheResult;
+        std::vector<VKit::ComputePipeline> pipelines(pipelineCount);
+        const TKit::Span<VKit::ComputePipeline> pipelineSpan{pipelines.data(), pipelineCount};
+        REQUIRE(VKit::ComputePipeline::Create(proxy, specSpan, pipelineSpan, cache));
+        REQUIRE(cache.Save(pathStr.c_str()));
+        for (VKit::ComputePipeline &pipeline : pipelines)
+            pipeline.Destroy();
+        cache.Destroy();
+    }
+
+    const auto createAll = [&](const VkPipelineCache cache) {
+        std::vector<VKit::ComputePipeline> pipelines(pipelineCount);
+        const auto result = VKit::ComputePipeline::Create(
+            proxy, specSpan, TKit::Span<VKit::ComputePipeline>(pipelines.data(), pipelineCount), cache);
+        for (VKit::ComputePipeline &pipeline : pipelines)
+            pipeline.Destroy();
+        return static_cast<bool>(result);
+    };
+
+    BENCHMARK("Without cache")
+    {
+        return createAll(VK_NULL_HANDLE);
+    };
+
+    BENCHMARK("With on-disk cache")
+    {
+        auto cacheResult = VKit::PipelineCache::Builder(proxy, properties).SetPath(pathStr.c_str()).Build();
+        auto cache = *cacheResult;
+        const bool result = createAll(cache);
+        cache.Destroy();
+        return result;
+    };
+
+    std::filesystem::remove(path);
+    for (VKit::Shader &shader : shaders)
+        shader.Destroy();
+    layout.Destroy();
+}
+
+// ============================================================================
+// SHADER REFLECTION
+// ============================================================================
+
+TEST_CASE("ShaderReflection - Compute Module", "[pipelines][reflection]")
+{
+    const std::vector<u32> spirv = CreateComputeSpirv(64);
+    const auto result = VKit::ShaderReflection::Reflect(spirv.data(), spirv.size() * sizeof(u32));
+    REQUIRE(result);
+
+    const VKit::ShaderReflection &reflection = *result;
+    CHECK(reflection.GetStages() == VK_SHADER_STAGE_COMPUTE_BIT);
+    CHECK(reflection.GetWorkgroupSize()[0] == 64);
+    CHECK(reflection.GetWorkgroupSize()[1] == 1);
+    CHECK(reflection.GetWorkgroupSize()[2] == 1);
+    CHECK(reflection.GetBindings().IsEmpty());
+    CHECK(reflection.GetPushConstantBlock().Size == 0);
+
+    std::vector<u32> corrupted = spirv;
+    corrupted[0] = 0;
+    CHECK(!VKit::ShaderReflection::Reflect(corrupted.data(), corrupted.size() * sizeof(u32)));
+    CHECK(!VKit::ShaderReflection::Reflect(spirv.data(), 3));
+
+    // a corrupt id bound must not be trusted for allocation, but stripped modules may have gaps in their ids
+    std::vector<u32> unbounded = spirv;
+    unbounded[3] = UINT32_MAX;
+    CHECK(!VKit::ShaderReflection::Reflect(unbounded.data(), unbounded.size() * sizeof(u32)));
+    std::vector<u32> sparse = spirv;
+    sparse[3] = 1 << 16;
+    CHECK(VKit::ShaderReflection::Reflect(sparse.data(), sparse.size() * sizeof(u32)));
+
+    // an OpDecorate without its decoration operand
+    std::vector<u32> truncated = spirv;
+    truncated.insert(truncated.begin() + 5, {(2U << 16) | 71U, 1U});
+    CHECK(!VKit::ShaderReflection::Reflect(truncated.data(), truncated.size() * sizeof(u32)));
+}
+
+TEST_CASE("ShaderReflection - Graphics Module", "[pipelines][reflection]")
+{
+    const std::vector<u32> spirv = CreateReflectionSpirv(VK_SHADER_STAGE_VERTEX_BIT);
+    const auto result = VKit::ShaderReflection::Reflect(spirv.data(), spirv.size() * sizeof(u32));
+    REQUIRE(result);
+
+    const VKit::ShaderReflection &reflection = *result;
+    CHECK(reflection.GetStages() == VK_SHADER_STAGE_VERTEX_BIT);
+
+    SECTION("Descriptor bindings")
+    {
+        REQUIRE(reflection.GetBindings().GetSize() == 2);
+
+        const auto *camera = FindBinding(reflection, 0, 0);
+        REQUIRE(camera);
+        CHECK(camera->Type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+        CHECK(camera->Count == 1);
+        CHECK(camera->Stages == VK_SHADER_STAGE_VERTEX_BIT);
+
+        const auto *textures = FindBinding(reflection, 1, 2);
+        REQUIRE(textures);
+        CHECK(textures->Type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+        CHECK(textures->Count == 4);
+    }
+
+    SECTION("Push constants")
+    {
+        const VKit::ShaderReflection::PushConstantBlock &push = reflection.GetPushConstantBlock();
+        CHECK(push.Offset == 0);
+        CHECK(push.Size == 20);
+        CHECK(push.Stages == VK_SHADER_STAGE_VERTEX_BIT);
+    }
+
+    SECTION("Vertex inputs")
+    {
+        const auto &inputs = reflection.GetVertexInputs();
+        REQUIRE(inputs.GetSize() == 2);
+        CHECK(inputs[0].Location == 0);
+        CHECK(inputs[0].Format == VK_FORMAT_R32G32B32_SFLOAT);
+        CHECK(inputs[1].Location == 1);
+        CHECK(inputs[1].Format == VK_FORMAT_R32G32_SFLOAT);
+    }
+}
+
+TEST_CASE("ShaderReflection - Merging Stages", "[pipelines][reflection]")
+{
+    const std::vector<u32> vertexSpirv = CreateReflectionSpirv(VK_SHADER_STAGE_VERTEX_BIT);
+    const std::vector<u32> fragmentSpirv = CreateReflectionSpirv(VK_SHADER_STAGE_FRAGMENT_BIT);
+    const auto vresult = VKit::ShaderReflection::Reflect(vertexSpirv.data(), vertexSpirv.size() * sizeof(u32));
+    const auto fresult = VKit::ShaderReflection::Reflect(fragmentSpirv.data(), fragmentSpirv.size() * sizeof(u32));
+    REQUIRE(vresult);
+    REQUIRE(fresult);
+
+    const VKit::ShaderReflection &fragment = *fresult;
+    CHECK(fragment.GetStages() == VK_SHADER_STAGE_FRAGMENT_BIT);
+    CHECK(fragment.GetPushConstantBlock().Offset == 16);
+    CHECK(fragment.GetPushConstantBlock().Size == 4);
+    CHECK(fragment.GetVertexInputs().IsEmpty());
+
+    VKit::ShaderReflection merged = *vresult;
+    REQUIRE(merged.Merge(fragment));
+    CHECK(merged.GetStages() == (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT));
+    REQUIRE(merged.GetBindings().GetSize() == 3);
+
+    const auto *camera = FindBinding(merged, 0, 0);
+    REQUIRE(camera);
+    CHECK(camera->Stages == (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT));
+
+    // runtime sized in the fragment stage, so runtime sized once merged
+    const auto *textures = FindBinding(merged, 1, 2);
+    REQUIRE(textures);
+    CHECK(textures->Count == 0);
+
+    const auto *storage = FindBinding(merged, 3, 1);
+    REQUIRE(storage);
+    CHECK(storage->Type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    CHECK(storage->Stages == VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    const VKit::ShaderReflection::PushConstantBlock &push = merged.GetPushConstantBlock();
+    CHECK(push.Offset == 0);
+    CHECK(push.Size == 20);
+    CHECK(push.Stages == (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT));
+    CHECK(merged.GetVertexInputs().GetSize() == 2);
+
+    const std::vector<u32> conflictingSpirv = CreateReflectionSpirv(VK_SHADER_STAGE_FRAGMENT_BIT, true);
+    const auto cresult =
+        VKit::ShaderReflection::Reflect(conflictingSpirv.data(), conflictingSpirv.size() * sizeof(u32));
+    REQUIRE(cresult);
+    VKit::ShaderReflection conflicting = *vresult;
+    CHECK(!conflicting.Merge(*cresult));
+}
+
+#ifdef VKIT_ENABLE_DESCRIPTORS
+TEST_CASE("ShaderReflection - Descriptor Set Layout Builders", "[pipelines][reflection]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    const std::vector<u32> vertexSpirv = CreateReflectionSpirv(VK_SHADER_STAGE_VERTEX_BIT);
+    const std::vector<u32> fragmentSpirv = CreateReflectionSpirv(VK_SHADER_STAGE_FRAGMENT_BIT);
+    const auto vresult = VKit::ShaderReflection::Reflect(vertexSpirv.data(), vertexSpirv.size() * sizeof(u32));
+    const auto fresult = VKit::ShaderReflection::Reflect(fragmentSpirv.data(), fragmentSpirv.size() * sizeof(u32));
+    REQUIRE(vresult);
+    REQUIRE(fresult);
+    VKit::ShaderReflection reflection = *vresult;
+    REQUIRE(reflection.Merge(*fresult));
+
+    // set 2 has no bindings but keeps its index
+    auto builders = reflection.CreateDescriptorSetLayoutBuilders(proxy, 16);
+    REQUIRE(builders.GetSize() == 4);
+
+    // set 1 holds the runtime sized array, which is made partially bound and needs descriptor indexing to be built
+    const VkShaderStageFlags stages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+    auto cameraResult = builders[0].Build();
+    auto emptyResult = builders[2].Build();
+    auto storageResult = builders[3].Build();
+    REQUIRE(cameraResult);
+    REQUIRE(emptyResult);
+    REQUIRE(storageResult);
+    auto camera = *cameraResult;
+    auto empty = *emptyResult;
+    auto storage = *storageResult;
+
+    CHECK(camera.GetBindings()[0].descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    CHECK(camera.GetBindings()[0].descriptorCount == 1);
+    CHECK(camera.GetBindings()[0].stageFlags == stages);
+    CHECK(storage.GetBindings()[1].descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    CHECK(storage.GetBindings()[1].stageFlags == VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    camera.Destroy();
+    empty.Destroy();
+    storage.Destroy();
+}
+#endif
+
+TEST_CASE("ShaderReflection - Malformed Modules", "[pipelines][reflection]")
+{
+    const std::vector<u32> spirv = CreateReflectionSpirv(VK_SHADER_STAGE_VERTEX_BIT);
+    const auto reflect = [](const std::vector<u32> &words) {
+        return VKit::ShaderReflection::Reflect(words.data(), words.size() * sizeof(u32));
+    };
+    // the ids of CreateReflectionSpirv() that the instructions below refer to
+    constexpr u32 camera = 15;
+    constexpr u32 bound = 30;
+
+    SECTION("Operand ids past the bound")
+    {
+        std::vector<u32> words = spirv;
+        words[3] = bound + 1;
+        EmitSpirv(words, 59, {bound + 1, bound, 2}); // OpVariable
+        CHECK(!reflect(words));
+    }
+
+    SECTION("Variables whose type is not a pointer")
+    {
+        std::vector<u32> words = spirv;
+        words[3] = bound + 1;
+        EmitSpirv(words, 59, {camera, bound, 2});
+        CHECK(!reflect(words));
+    }
+
+    SECTION("Self-referential types")
+    {
+        // a struct holding itself, used as the push constant block
+        std::vector<u32> words = spirv;
+        words[3] = bound + 3;
+        EmitSpirv(words, 30, {bound, bound});            // OpTypeStruct
+        EmitSpirv(words, 32, {bound + 1, 9, bound});     // OpTypePointer
+        EmitSpirv(words, 59, {bound + 1, bound + 2, 9}); // OpVariable
+        CHECK(!reflect(words));
+    }
+
+    SECTION("Member indices past the limit")
+    {
+        std::vector<u32> words = spirv;
+        EmitSpirv(words, 72, {camera, UINT32_MAX, 35, 0}); // OpMemberDecorate
+        CHECK(!reflect(words));
+    }
+}
+
+// ============================================================================
+// SHADER CACHE
+// ============================================================================
+
+TEST_CASE("ShaderCache - Deduplication", "[pipelines][shader-cache]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    const std::vector<u32> spirv = CreateComputeSpirv(64);
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "vulkit-test-shader.spv";
+    const std::string pathStr = path.string();
+    {
+        std::ofstream file{path, std::ios::binary};
+        file.write(reinterpret_cast<const char *>(spirv.data()), spirv.size() * sizeof(u32));
+    }
+
+    VKit::ShaderCache cache{proxy, VKit::ShaderCacheFlag_StripDebugInfo};
+    auto fromMemory = cache.Create(spirv.data(), spirv.size() * sizeof(u32));
+    REQUIRE(fromMemory);
+    auto fromFile = cache.Load(pathStr.c_str());
+    REQUIRE(fromFile);
+    CHECK(fromMemory->GetHandle() == fromFile->GetHandle());
+    CHECK(cache.GetModuleCount() == 1);
+
+    const std::vector<u32> other = CreateComputeSpirv(32);
+    auto otherResult = cache.Create(other.data(), other.size() * sizeof(u32));
+    REQUIRE(otherResult);
+    CHECK(otherResult->GetHandle() != fromMemory->GetHandle());
+    CHECK(cache.GetModuleCount() == 2);
+
+    // the file loader validates the magic number
+    std::vector<u32> corrupted = spirv;
+    corrupted[0] = 0;
+    {
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char *>(corrupted.data()), corrupted.size() * sizeof(u32));
+    }
+    CHECK(!cache.Load(pathStr.c_str()));
+
+    cache.Destroy();
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("ShaderCache - Strip Debug Info", "[pipelines][shader-cache]")
+{
+    std::vector<u32> spirv = CreateComputeSpirv(64);
+    const usize originalSize = spirv.size();
+
+    // OpName %1 "main", inserted after OpExecutionMode
+    const u32 name[] = {0x00040005, 1, 0x6E69616D, 0};
+    spirv.insert(spirv.begin() + 21, std::begin(name), std::end(name));
+
+    TKit::TierArray<u32> stripped{};
+    VKit::ShaderCache::StripDebugInfo(spirv.data(), spirv.size() * sizeof(u32), stripped);
+    REQUIRE(stripped.GetSize() == originalSize);
+
+    const std::vector<u32> expected = CreateComputeSpirv(64);
+    CHECK(std::memcmp(stripped.GetData(), expected.data(), originalSize * sizeof(u32)) == 0);
+    CHECK(VKit::ShaderCache::Hash(spirv.data(), spirv.size() * sizeof(u32)) !=
+          VKit::ShaderCache::Hash(expected.data(), originalSize * sizeof(u32)));
+}
+
+// ============================================================================
+// SHADER WATCHER
+// ============================================================================
+
+TEST_CASE("ShaderWatcher - Reload, Update and Reclaim", "[pipelines][shader-watcher]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    // the watcher is notified of files moved into place, which is how most compilers write their output
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "vulkit-test-shader-watcher";
+    const std::filesystem::path path = directory / "compute.spv";
+    std::filesystem::create_directories(directory);
+    const auto writeSpirv = [&](const u32 localSizeX) {
+        const std::vector<u32> spirv = CreateComputeSpirv(localSizeX);
+        const std::filesystem::path staging = directory / "compute.spv.tmp";
+        {
+            std::ofstream file{staging, std::ios::binary | std::ios::trunc};
+            file.write(reinterpret_cast<const char *>(spirv.data()), spirv.size() * sizeof(u32));
+        }
+        std::filesystem::rename(staging, path);
+    };
+    writeSpirv(1);
+
+    auto layoutResult = VKit::PipelineLayout::Builder(proxy).Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    VKit::ShaderWatcher watcher{proxy};
+    const auto shaderResult = watcher.Watch(path);
+    REQUIRE(shaderResult);
+    const u32 shaderId = *shaderResult;
+    const VkShaderModule module = watcher.GetShader(shaderId);
+
+    VKit::ComputePipelineSpecs specs{};
+    specs.Layout = layout;
+    specs.ComputeShader = module;
+    const auto pipelineResult = watcher.AddComputePipeline(specs);
+    REQUIRE(pipelineResult);
+    const u32 pipelineId = *pipelineResult;
+    const VkPipeline pipeline = watcher.GetComputePipeline(pipelineId);
+
+    REQUIRE(watcher.Start());
+    // nothing changed yet
+    CHECK(watcher.Update(1) == 0);
+    CHECK(watcher.GetShader(shaderId).GetHandle() == module);
+
+    // polling backends compare modification times, which may be coarse
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    writeSpirv(2);
+
+    // reloads are built in the background and only swapped in by an update
+    u32 reloaded = 0;
+    for (u32 i = 0; i < 500 && reloaded == 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        reloaded = watcher.Update(1);
+    }
+    REQUIRE(reloaded == 1);
+    CHECK(watcher.GetShader(shaderId).GetHandle() != module);
+    CHECK(watcher.GetComputePipeline(pipelineId).GetHandle() != pipeline);
+
+    // the replaced module and pipeline are only destroyed once timeline 1 completes
+    watcher.Reclaim(0);
+    watcher.Reclaim(1);
+
+    watcher.Destroy();
+    layout.Destroy();
+    std::filesystem::remove_all(directory);
+}
+
+// ============================================================================
+// PIPELINE STATE KEY
+// ============================================================================
+
+TEST_CASE("PipelineStateKey - Equivalent Builders", "[pipelines][state-key]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    const VkFormat colorFormat = VK_FORMAT_B8G8R8A8_SRGB;
+    VkPipelineRenderingCreateInfoKHR renderingInfo{};
+    renderingInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    renderingInfo.colorAttachmentCount = 1;
+    renderingInfo.pColorAttachmentFormats = &colorFormat;
+
+    const auto createBuilder = [&](const VkCullModeFlags cullMode, const VkDynamicState first,
+                                   const VkDynamicState second) {
+        VKit::GraphicsPipeline::Builder builder{proxy, VK_NULL_HANDLE, renderingInfo};
+        builder.SetCullMode(cullMode)
+            .AddDynamicState(first)
+            .AddDynamicState(second)
+            .AddDefaultColorAttachment()
+            .Bake();
+        return builder;
+    };
+
+    const auto a = VKit::PipelineStateKey::Create(
+        createBuilder(VK_CULL_MODE_BACK_BIT, VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR));
+    const auto b = VKit::PipelineStateKey::Create(
+        createBuilder(VK_CULL_MODE_BACK_BIT, VK_DYNAMIC_STATE_SCISSOR, VK_DYNAMIC_STATE_VIEWPORT));
+    const auto c = VKit::PipelineStateKey::Create(
+        createBuilder(VK_CULL_MODE_NONE, VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR));
+    REQUIRE(a);
+    REQUIRE(b);
+    REQUIRE(c);
+
+    // dynamic state order does not make a pipeline different
+    CHECK(*a == *b);
+    CHECK(a->Hash() == b->Hash());
+    CHECK(*a != *c);
+    CHECK(a->Hash() != c->Hash());
+
+    VKit::PipelineStateCache cache{proxy};
+    CHECK(!cache.Find(*a));
+    CHECK(cache.GetPipelineCount() == 0);
+}
+
+TEST_CASE("PipelineStateKey - Dynamic State Collapses Permutations", "[pipelines][state-key]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    const VkFormat colorFormat = VK_FORMAT_B8G8R8A8_SRGB;
+    VkPipelineRenderingCreateInfoKHR renderingInfo{};
+    renderingInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    renderingInfo.colorAttachmentCount = 1;
+    renderingInfo.pColorAttachmentFormats = &colorFormat;
+
+    const auto createKey = [&](const VkCullModeFlags cullMode, const VkPrimitiveTopology topology,
+                               const VKit::DynamicStateFlags flags) {
+        VKit::GraphicsPipeline::Builder builder{proxy, VK_NULL_HANDLE, renderingInfo};
+        builder.SetCullMode(cullMode)
+            .SetTopology(topology)
+            .EnableDepthTest()
+            .AddDynamicStates(flags)
+            .AddDefaultColorAttachment()
+            .Bake();
+        const auto key = VKit::PipelineStateKey::Create(builder);
+        REQUIRE(key);
+        return *key;
+    };
+
+    const auto a = createKey(VK_CULL_MODE_BACK_BIT, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, 0);
+    const auto b = createKey(VK_CULL_MODE_NONE, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP, 0);
+    CHECK(a != b);
+
+    const VKit::DynamicStateFlags flags = VKit::DynamicStateFlag_Extended | VKit::DynamicStateFlag_Extended2;
+    const auto c = createKey(VK_CULL_MODE_BACK_BIT, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, flags);
+    const auto d = createKey(VK_CULL_MODE_NONE, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP, flags);
+    CHECK(c == d);
+    CHECK(c.Hash() == d.Hash());
+
+    // topologies of a different class still need their own pipeline
+    const auto e = createKey(VK_CULL_MODE_NONE, VK_PRIMITIVE_TOPOLOGY_LINE_LIST, flags);
+    CHECK(c != e);
+}
+
+TEST_CASE("VertexLayout - Deduplication", "[pipelines][state-key]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    const auto createLayout = [](const u32 stride) {
+        VKit::VertexLayout layout{};
+        layout.AddBinding(stride)
+            .AddAttribute(0, VK_FORMAT_R32G32B32_SFLOAT, 0)
+            .AddAttribute(0, VK_FORMAT_R32G32_SFLOAT, 12);
+        return layout;
+    };
+
+    const VKit::VertexLayout a = createLayout(20);
+    const VKit::VertexLayout b = createLayout(20);
+    const VKit::VertexLayout c = createLayout(32);
+    CHECK(a == b);
+    CHECK(a.Hash() == b.Hash());
+    CHECK(a != c);
+
+    VKit::VertexLayoutCache cache{};
+    const VKit::VertexLayout &ia = cache.Intern(a);
+    const VKit::VertexLayout &ib = cache.Intern(b);
+    const VKit::VertexLayout &ic = cache.Intern(c);
+    CHECK(&ia == &ib);
+    CHECK(&ia != &ic);
+    CHECK(cache.GetLayoutCount() == 2);
+
+    const VkFormat colorFormat = VK_FORMAT_B8G8R8A8_SRGB;
+    VkPipelineRenderingCreateInfoKHR renderingInfo{};
+    renderingInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    renderingInfo.colorAttachmentCount = 1;
+    renderingInfo.pColorAttachmentFormats = &colorFormat;
+
+    const auto createKey = [&](const VKit::VertexLayout &layout, const VKit::DynamicStateFlags flags) {
+        VKit::GraphicsPipeline::Builder builder{proxy, VK_NULL_HANDLE, renderingInfo};
+        builder.SetVertexLayout(layout).AddDynamicStates(flags).AddDefaultColorAttachment().Bake();
+        const auto key = VKit::PipelineStateKey::Create(builder);
+        REQUIRE(key);
+        return *key;
+    };
+
+    // baked layouts need their own pipeline, dynamic ones do not
+    CHECK(createKey(a, 0) != createKey(c, 0));
+    CHECK(createKey(a, VKit::DynamicStateFlag_VertexInput) == createKey(c, VKit::DynamicStateFlag_VertexInput));
+}
+
+// ============================================================================
+// DYNAMIC STATE
+// ============================================================================
+
+#ifdef VK_EXT_extended_dynamic_state3
+TEST_CASE("DynamicState - Core Commands First", "[pipelines][dynamic-state]")
+{
+    // the commands only reach the stand-ins, so neither a device nor a command buffer is needed
+    VKit::Vulkan::DeviceTable table{};
+    table.vkCmdSetCullModeEXT = CountExtCullMode;
+    table.vkCmdSetFrontFaceEXT = CountExtFrontFace;
+    VKit::ProxyDevice proxy{};
+    proxy.Table = &table;
+
+    s_CoreStateCommands = 0;
+    s_ExtStateCommands = 0;
+    VKit::DynamicState state{proxy};
+    state.SetCullMode(VK_CULL_MODE_BACK_BIT).SetFrontFace(VK_FRONT_FACE_CLOCKWISE);
+    state.Apply(VK_NULL_HANDLE);
+    CHECK(s_ExtStateCommands == 2);
+
+    // unchanged states are not recorded again
+    state.SetCullMode(VK_CULL_MODE_BACK_BIT);
+    state.Apply(VK_NULL_HANDLE);
+    CHECK(s_ExtStateCommands == 2);
+
+    state.SetCullMode(VK_CULL_MODE_FRONT_BIT);
+    state.Apply(VK_NULL_HANDLE);
+    CHECK(s_ExtStateCommands == 3);
+    CHECK(s_CoreStateCommands == 0);
+
+#    ifdef VKIT_API_VERSION_1_3
+    table.vkCmdSetCullMode = CountCoreCullMode;
+    table.vkCmdSetFrontFace = CountCoreFrontFace;
+    state.Invalidate();
+    state.Apply(VK_NULL_HANDLE);
+    CHECK(s_CoreStateCommands == 2);
+    CHECK(s_ExtStateCommands == 3);
+#    endif
+}
+#endif
+
+// ============================================================================
+// PIPELINE COMPILER
+// ============================================================================
+
+namespace
+{
+struct ComputeWorkload
+{
+    VKit::PipelineLayout Layout;
+    std::vector<VKit::Shader> Shaders;
+    std::vector<VKit::ComputePipelineSpecs> Specs;
+
+    ComputeWorkload(const VKit::ProxyDevice &proxy, const u32 count)
+    {
+        auto layoutResult = VKit::PipelineLayout::Builder(proxy).Build();
+        REQUIRE(layoutResult);
+        Layout = *layoutResult;
+        for (u32 i = 0; i < count; ++i)
+        {
+            const std::vector<u32> spirv = CreateComputeSpirv(i + 1);
+            auto shaderResult = VKit::Shader::Create(proxy, spirv.data(), spirv.size() * sizeof(u32));
+            REQUIRE(shaderResult);
+            Shaders.push_back(*shaderResult);
+
+            VKit::ComputePipelineSpecs spc{};
+            spc.Layout = Layout;
+            spc.ComputeShader = Shaders.back();
+            Specs.push_back(spc);
+        }
+    }
+    ~ComputeWorkload()
+    {
+        for (VKit::Shader &shader : Shaders)
+            shader.Destroy();
+        Layout.Destroy();
+    }
+};
+} // namespace
+
+TEST_CASE("PipelineCompiler - Futures", "[pipelines][compiler]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+
+    constexpr u32 pipelineCount = 17;
+    ComputeWorkload workload{proxy, pipelineCount};
+
+    auto cacheResult = VKit::PipelineCache::Builder(proxy, ctx.GetPhysicalDevice().GetInfo().Properties).Build();
+    REQUIRE(cacheResult);
+    auto cache = *cacheResult;
+
+    VKit::PipelineCompiler compiler{proxy, 4};
+    CHECK(compiler.GetWorkerCount() == 4);
+
+    std::vector<VKit::PipelineCompiler::ComputeFuture> futures(pipelineCount);
+    REQUIRE(compiler.Compile(TKit::Span<const VKit::ComputePipelineSpecs>(workload.Specs.data(), pipelineCount),
+                             TKit::Span<VKit::PipelineCompiler::ComputeFuture>(futures.data(), pipelineCount)));
+
+    for (auto &future : futures)
+    {
+        auto compilation = future.get();
+        REQUIRE(compilation.Pipeline);
+        CHECK(compilation.CompileTime.count() >= 0);
+        compilation.Pipeline->Destroy();
+    }
+
+    REQUIRE(compiler.Finish(cache));
+    auto dataResult = cache.GetData();
+    REQUIRE(dataResult);
+    CHECK(dataResult->GetSize() >= sizeof(VkPipelineCacheHeaderVersionOne));
+
+    cache.Destroy();
+}
+
+TEST_CASE("PipelineCompiler - Parallel Compilation", "[.][benchmark][pipelines][compiler]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    constexpr u32 pipelineCount = 128;
+    ComputeWorkload workload{proxy, pipelineCount};
+    const TKit::Span<const VKit::ComputePipelineSpecs> specs{workload.Specs.data(), pipelineCount};
+
+    BENCHMARK("Single call")
+    {
+        std::vector<VKit::ComputePipeline> pipelines(pipelineCount);
+        const TKit::Span<VKit::ComputePipeline> pipelineSpan{pipelines.data(), pipelineCount};
+        const auto result = VKit::ComputePipeline::Create(proxy, specs, pipelineSpan);
+        for (VKit::ComputePipeline &pipeline : pipelines)
+            pipeline.Destroy();
+        return static_cast<bool>(result);
+    };
+
+    BENCHMARK("PipelineCompiler")
+    {
+        VKit::PipelineCompiler compiler{proxy};
+        std::vector<VKit::PipelineCompiler::ComputeFuture> futures(pipelineCount);
+        const auto result =
+            compiler.Compile(specs, TKit::Span<VKit::PipelineCompiler::ComputeFuture>(futures.data(), pipelineCount));
+        for (auto &future : futures)
+            if (future.valid())
+            {
+                auto compilation = future.get();
+                if (compilation.Pipeline)
+                    compilation.Pipeline->Destroy();
+            }
+        compiler.Destroy();
+        return static_cast<bool>(result);
+    };
+}
+
+// ============================================================================
+// PIPELINE STATS
+// ============================================================================
+
+TEST_CASE("PipelineStats - Compute Feedback", "[pipelines][stats]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+
+    constexpr u32 pipelineCount = 4;
+    ComputeWorkload workload{proxy, pipelineCount};
+
+    const VKit::PhysicalDevice::Info &devInfo = ctx.GetPhysicalDevice().GetInfo();
+    VKit::PipelineStats stats{devInfo.ApiVersion, devInfo.EnabledExtensionSet};
+    if (!stats.IsSupported())
+    {
+        SKIP("Pipeline creation feedback is not supported");
+    }
+
+    for (VKit::ComputePipelineSpecs &spc : workload.Specs)
+    {
+        spc.Stats = &stats;
+        spc.Name = "compute";
+    }
+
+    auto single = VKit::ComputePipeline::Create(proxy, workload.Specs[0]);
+    REQUIRE(single);
+    single->Destroy();
+
+    std::vector<VKit::ComputePipeline> pipelines(pipelineCount);
+    REQUIRE(VKit::ComputePipeline::Create(
+        proxy, TKit::Span<const VKit::ComputePipelineSpecs>(workload.Specs.data(), pipelineCount),
+        TKit::Span<VKit::ComputePipeline>(pipelines.data(), pipelineCount)));
+    for (VKit::ComputePipeline &pipeline : pipelines)
+        pipeline.Destroy();
+
+    REQUIRE(stats.GetEntryCount() == pipelineCount + 1);
+    const auto entries = stats.GetEntries();
+    for (u32 i = 0; i < entries.GetSize(); ++i)
+    {
+        // stage feedback is optional, so only the pipeline feedback is checked
+        CHECK(entries[i].Valid);
+        REQUIRE(entries[i].Stages.GetSize() == 1);
+        CHECK(entries[i].Stages[0].Stage == VK_SHADER_STAGE_COMPUTE_BIT);
+        if (i > 0)
+            CHECK(entries[i - 1].Duration >= entries[i].Duration);
+    }
+    CHECK(stats.GetCacheHitRate() >= 0.f);
+    CHECK(stats.GetCacheHitRate() <= 1.f);
+    CHECK(stats.Dump(2) != "");
+
+    stats.Clear();
+    CHECK(stats.GetEntryCount() == 0);
+}
+
+// ============================================================================
+// PIPELINE VARIANTS
+// ============================================================================
+
+TEST_CASE("PipelineVariants - Fallback Until Compiled", "[pipelines][variants]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+    auto layoutResult = VKit::PipelineLayout::Builder(proxy).Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    const std::vector<u32> vertexSpirv = CreateGraphicsSpirv(VK_SHADER_STAGE_VERTEX_BIT);
+    const std::vector<u32> fragmentSpirv = CreateGraphicsSpirv(VK_SHADER_STAGE_FRAGMENT_BIT);
+    auto vertexResult = VKit::Shader::Create(proxy, vertexSpirv.data(), vertexSpirv.size() * sizeof(u32));
+    auto fragmentResult = VKit::Shader::Create(proxy, fragmentSpirv.data(), fragmentSpirv.size() * sizeof(u32));
+    REQUIRE(vertexResult);
+    REQUIRE(fragmentResult);
+    auto vertex = *vertexResult;
+    auto fragment = *fragmentResult;
+
+    VkAttachmentDescription attachment{};
+    attachment.format = VK_FORMAT_B8G8R8A8_SRGB;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    const VkAttachmentReference reference{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &reference;
+
+    VkRenderPassCreateInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &attachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+
+    VkRenderPass renderPass;
+    REQUIRE(proxy.Table->CreateRenderPass(proxy, &renderPassInfo, proxy.AllocationCallbacks, &renderPass) ==
+            VK_SUCCESS);
+
+    VKit::GraphicsPipeline::Builder builder{proxy, layout, renderPass};
+    builder.AddShaderStage(vertex, VK_SHADER_STAGE_VERTEX_BIT)
+        .AddShaderStage(fragment, VK_SHADER_STAGE_FRAGMENT_BIT)
+        .SetViewportCount(1)
+        .AddDynamicState(VK_DYNAMIC_STATE_VIEWPORT)
+        .AddDynamicState(VK_DYNAMIC_STATE_SCISSOR)
+        .AddDefaultColorAttachment()
+        .Bake();
+
+    // the shaders declare no constants, which is valid and still compiles a pipeline per variant
+    VKit::PipelineVariants variants{builder};
+    const u32 shadows = variants.AddConstant(0, false);
+    const u32 scale = variants.AddConstant(1, 1.f);
+    CHECK(variants.GetConstantCount() == 2);
+
+    REQUIRE(variants.SetFallback(variants.CreateKey()));
+
+    VKit::PipelineVariants::Key first = variants.CreateKey();
+    first.Set(shadows, true);
+    VKit::PipelineVariants::Key second = variants.CreateKey();
+    second.Set(scale, 2.f);
+
+    // a variant is always pending right after it is requested, so the fallback is returned
+    const VkPipeline fallback = variants.Get(first).GetHandle();
+    CHECK(fallback != VK_NULL_HANDLE);
+    CHECK(variants.Get(second).GetHandle() == fallback);
+    CHECK(variants.GetVariantCount() == 2);
+
+    const auto waitUntilReady = [&](const VKit::PipelineVariants::Key &key) {
+        for (u32 i = 0; i < 1000 && !variants.IsReady(key); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return variants.IsReady(key);
+    };
+
+    REQUIRE(waitUntilReady(first));
+    const VkPipeline compiled = variants.Get(first).GetHandle();
+    CHECK(compiled != VK_NULL_HANDLE);
+    CHECK(compiled != fallback);
+    CHECK(variants.Get(first).GetHandle() == compiled);
+
+    REQUIRE(waitUntilReady(second));
+    CHECK(variants.Get(second).GetHandle() != fallback);
+    CHECK(variants.Get(second).GetHandle() != compiled);
+
+    // requesting known keys does not queue them again
+    variants.Prepare(first);
+    CHECK(variants.GetVariantCount() == 2);
+
+    variants.Destroy();
+    CHECK(variants.GetVariantCount() == 0);
+
+    proxy.Table->DestroyRenderPass(proxy, renderPass, proxy.AllocationCallbacks);
+    vertex.Destroy();
+    fragment.Destroy();
+    layout.Destroy();
+}
+
+// ============================================================================
+// PIPELINE LIBRARY
+// ============================================================================
+
+#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+TEST_CASE("PipelineLibrary - Part Caching and Optimized Swap", "[pipelines][library]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    if (!ctx.HasPipelineLibrary())
+        SKIP("VK_EXT_graphics_pipeline_library is not supported");
+
+    auto proxy = ctx.GetProxy();
+    auto layoutResult = VKit::PipelineLayout::Builder(proxy).Build();
+    REQUIRE(layoutResult);
+    auto layout = *layoutResult;
+
+    const std::vector<u32> vertexSpirv = CreateGraphicsSpirv(VK_SHADER_STAGE_VERTEX_BIT);
+    const std::vector<u32> fragmentSpirv = CreateGraphicsSpirv(VK_SHADER_STAGE_FRAGMENT_BIT);
+    auto vertexResult = VKit::Shader::Create(proxy, vertexSpirv.data(), vertexSpirv.size() * sizeof(u32));
+    auto fragmentResult = VKit::Shader::Create(proxy, fragmentSpirv.data(), fragmentSpirv.size() * sizeof(u32));
+    REQUIRE(vertexResult);
+    REQUIRE(fragmentResult);
+    auto vertex = *vertexResult;
+    auto fragment = *fragmentResult;
+
+    VkAttachmentDescription attachment{};
+    attachment.format = VK_FORMAT_B8G8R8A8_SRGB;
+    attachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    const VkAttachmentReference reference{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &reference;
+
+    VkRenderPassCreateInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &attachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+
+    VkRenderPass renderPass;
+    REQUIRE(proxy.Table->CreateRenderPass(proxy, &renderPassInfo, proxy.AllocationCallbacks, &renderPass) ==
+            VK_SUCCESS);
+
+    const auto configure = [&](VKit::GraphicsPipeline::Builder &builder, const VkCullModeFlags cullMode) {
+        builder.AddShaderStage(vertex, VK_SHADER_STAGE_VERTEX_BIT)
+            .AddShaderStage(fragment, VK_SHADER_STAGE_FRAGMENT_BIT)
+            .SetCullMode(cullMode)
+            .SetViewportCount(1)
+            .AddDynamicState(VK_DYNAMIC_STATE_VIEWPORT)
+            .AddDynamicState(VK_DYNAMIC_STATE_SCISSOR)
+            .AddDefaultColorAttachment()
+            .Bake();
+    };
+    VKit::GraphicsPipeline::Builder back{proxy, layout, renderPass};
+    VKit::GraphicsPipeline::Builder none{proxy, layout, renderPass};
+    configure(back, VK_CULL_MODE_BACK_BIT);
+    configure(none, VK_CULL_MODE_NONE);
+
+    VKit::PipelineLibrary library{proxy};
+
+    const auto fast = library.Link(back, false);
+    REQUIRE(fast);
+    CHECK(library.GetPipeline(*fast).GetHandle() != VK_NULL_HANDLE);
+    CHECK(!library.IsOptimized(*fast));
+    for (u32 i = 0; i < VKit::PipelineLibrary_Count; ++i)
+        CHECK(library.GetLibraryCount(static_cast<VKit::PipelineLibraryType>(i)) == 1);
+
+    // only the pre-rasterization part depends on the cull mode
+    const auto culled = library.Link(none, false);
+    REQUIRE(culled);
+    CHECK(library.GetLibraryCount(VKit::PipelineLibrary_VertexInput) == 1);
+    CHECK(library.GetLibraryCount(VKit::PipelineLibrary_PreRasterization) == 2);
+    CHECK(library.GetLibraryCount(VKit::PipelineLibrary_FragmentShader) == 1);
+    CHECK(library.GetLibraryCount(VKit::PipelineLibrary_FragmentOutput) == 1);
+    CHECK(library.Update(1) == 0);
+
+    const auto optimized = library.Link(back, true);
+    REQUIRE(optimized);
+    CHECK(library.GetLibraryCount(VKit::PipelineLibrary_PreRasterization) == 2);
+    const VkPipeline fastHandle = library.GetPipeline(*optimized).GetHandle();
+
+    // the optimized pipeline is linked in the background, so it only shows up after some update
+    for (u32 i = 0; i < 1000 && !library.IsOptimized(*optimized); ++i)
+        if (library.Update(1) == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    REQUIRE(library.IsOptimized(*optimized));
+    CHECK(library.GetPipeline(*optimized).GetHandle() != fastHandle);
+    CHECK(!library.IsOptimized(*fast));
+    CHECK(library.GetRetiredCount() == 1);
+
+    // the fast-linked pipeline is only destroyed once its timeline value completes
+    library.Reclaim(0);
+    CHECK(library.GetRetiredCount() == 1);
+    library.Reclaim(1);
+    CHECK(library.GetRetiredCount() == 0);
+
+    library.Destroy();
+    CHECK(library.GetLibraryCount(VKit::PipelineLibrary_PreRasterization) == 0);
+
+    proxy.Table->DestroyRenderPass(proxy, renderPass, proxy.AllocationCallbacks);
+    vertex.Destroy();
+    fragment.Destroy();
+    layout.Destroy();
+}
+#endif
+
+// ============================================================================
+// SHADER OBJECT
+// ============================================================================
+
+#ifdef VK_EXT_shader_object
+TEST_CASE("ShaderObject - Build, Bind and Destroy", "[pipelines][shader-object]")
+{
+    ContextGuard guard;
+    auto &ctx = TestContext::Get();
+    if (!ctx.HasShaderObject())
+        SKIP("VK_EXT_shader_object is not supported");
+
+    auto proxy = ctx.GetProxy();
+    auto layoutResult = VKit::PipelineLayout::Builder(proxy).AddPushConstantRange<u32>(VK_SHADER_STAGE_ALL).Build();
+    REQUIRE(layoutResult);
+    VKit::PipelineLayout layout = *layoutResult;
+
+    CHECK(!VKit::ShaderObject::Builder(proxy, layout).Build());
+
+    const std::vector<u32> vertexSpirv = CreateGraphicsSpirv(VK_SHADER_STAGE_VERTEX_BIT);
+    const std::vector<u32> fragmentSpirv = CreateGraphicsSpirv(VK_SHADER_STAGE_FRAGMENT_BIT);
+    const std::vector<u32> computeSpirv = CreateComputeSpirv(64);
+
+    auto graphicsResult =
+        VKit::ShaderObject::Builder(proxy, layout)
+            .AddStage(VK_SHADER_STAGE_VERTEX_BIT, vertexSpirv.data(), vertexSpirv.size() * sizeof(u32))
+            .AddStage(VK_SHADER_STAGE_FRAGMENT_BIT, fragmentSpirv.data(), fragmentSpirv.size() * sizeof(u32))
+            .SetLinked()
+            .Build();
+    REQUIRE(graphicsResult);
+    VKit::ShaderObject graphics = *graphicsResult;
+    CHECK(graphics);
+    CHECK(graphics.GetInfo().Linked);
+    REQUIRE(graphics.GetInfo().Stages.GetSize() == 2);
+    CHECK(graphics.GetHandle(VK_SHADER_STAGE_VERTEX_BIT) != VK_NULL_HANDLE);
+    CHECK(graphics.GetHandle(VK_SHADER_STAGE_FRAGMENT_BIT) != VK_NULL_HANDLE);
+    CHECK(graphics.GetHandle(VK_SHADER_STAGE_VERTEX_BIT) != graphics.GetHandle(VK_SHADER_STAGE_FRAGMENT_BIT));
+    CHECK(graphics.GetHandle(VK_SHADER_STAGE_COMPUTE_BIT) == VK_NULL_HANDLE);
+
+    auto computeResult =
+        VKit::ShaderObject::Builder(proxy, layout)
+            .AddStage(VK_SHADER_STAGE_COMPUTE_BIT, computeSpirv.data(), computeSpirv.size() * sizeof(u32))
+            .Build();
+    REQUIRE(computeResult);
+    VKit::ShaderObject compute = *computeResult;
+    CHECK(!compute.GetInfo().Linked);
+    CHECK(compute.GetHandle(VK_SHADER_STAGE_COMPUTE_BIT) != VK_NULL_HANDLE);
+
+    auto poolResult =
+        VKit::CommandPool::Create(proxy, ctx.GetPhysicalDevice().GetInfo().FamilyIndices[VKit::Queue_Graphics], 0);
+    REQUIRE(poolResult);
+    auto pool = *poolResult;
+    auto commandResult = pool.Allocate();
+    REQUIRE(commandResult);
+    const VkCommandBuffer commandBuffer = *commandResult;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    REQUIRE(proxy.Table->BeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS);
+    graphics.Bind(commandBuffer);
+    graphics.Unbind(commandBuffer);
+    compute.Bind(commandBuffer);
+    proxy.Table->CmdDispatch(commandBuffer, 1, 1, 1);
+    CHECK(proxy.Table->EndCommandBuffer(commandBuffer) == VK_SUCCESS);
+    pool.Destroy();
+
+    graphics.Destroy();
+    compute.Destroy();
+    CHECK(!graphics);
+    CHECK(!compute);
+    layout.Destroy();
+}
+#endif
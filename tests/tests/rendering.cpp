@@ -0,0 +1,643 @@
+/**
+ * @file test_rendering.cpp
+ * @brief Catch2 test suite for VKit dynamic rendering, render passes and the framebuffer cache
+ */
+
+#undef VKIT_NO_DISCARD
+#define VKIT_NO_DISCARD
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "vkit/core/core.hpp"
+#include "vkit/vulkan/instance.hpp"
+#include "vkit/device/physical_device.hpp"
+#include "vkit/device/logical_device.hpp"
+#include "vkit/memory/allocator.hpp"
+#include "vkit/resource/device_image.hpp"
+#include "vkit/state/rendering_info.hpp"
+#include "vkit/state/render_pass.hpp"
+#include "vkit/execution/command_pool.hpp"
+
+using namespace TKit::Alias;
+
+namespace
+{
+
+// ============================================================================
+// Test Context Management
+// ============================================================================
+
+class TestContext
+{
+  public:
+    static TestContext &Get()
+    {
+        static TestContext instance;
+        return instance;
+    }
+
+    bool IsValid() const
+    {
+        return m_Valid;
+    }
+
+    VKit::ProxyDevice GetProxy() const
+    {
+        return m_LogicalDevice->CreateProxy();
+    }
+
+    const VKit::PhysicalDevice &GetPhysicalDevice() const
+    {
+        return *m_PhysicalDevice;
+    }
+
+    const VKit::LogicalDevice *GetLogicalDevice() const
+    {
+        return m_LogicalDevice;
+    }
+
+    VmaAllocator GetAllocator() const
+    {
+        return m_Allocator;
+    }
+
+    bool HasDynamicRendering() const
+    {
+        return m_DynamicRendering;
+    }
+
+    bool HasImagelessFramebuffer() const
+    {
+        return m_ImagelessFramebuffer;
+    }
+
+  private:
+    TestContext()
+    {
+        Initialize();
+    }
+
+    ~TestContext()
+    {
+        Shutdown();
+    }
+
+    void Initialize()
+    {
+        // other test files share the loaded library and `Terminate()` is not reference counted, so it is left for the
+        // process exit to unload
+        if (!VKit::Initialize())
+            return;
+
+        auto instanceResult = VKit::Instance::Builder()
+                                  .SetApplicationName("VKit Rendering Tests")
+                                  .RequireApiVersion(1, 0, 0)
+                                  .RequestApiVersion(1, 3, 0)
+                                  .SetHeadless(true)
+                                  .Build();
+        if (!instanceResult)
+            return;
+        m_Instance = new VKit::Instance(*instanceResult);
+
+        auto physicalResult = VKit::PhysicalDevice::Selector(m_Instance)
+                                  .PreferType(VKit::Device_Discrete)
+                                  .AddFlags(VKit::DeviceSelectorFlag_AnyType)
+                                  .RemoveFlags(VKit::DeviceSelectorFlag_RequirePresentQueue)
+#ifdef VK_KHR_dynamic_rendering
+                                  .RequestExtension(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME)
+                                  .RequestExtension(VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME)
+                                  .RequestExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME)
+#endif
+#ifdef VK_KHR_imageless_framebuffer
+                                  .RequestExtension(VK_KHR_MAINTENANCE_2_EXTENSION_NAME)
+                                  .RequestExtension(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME)
+                                  .RequestExtension(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME)
+#endif
+                                  .Select();
+        if (!physicalResult)
+        {
+            m_Instance->Destroy();
+            delete m_Instance;
+            return;
+        }
+        m_PhysicalDevice = new VKit::PhysicalDevice(*physicalResult);
+#ifdef VKIT_API_VERSION_1_3
+        VKit::DeviceFeatures features{};
+        features.Vulkan13.dynamicRendering = VK_TRUE;
+        m_DynamicRendering = m_PhysicalDevice->EnableFeatures(features);
+#endif
+#ifdef VK_KHR_dynamic_rendering
+        // the feature is mandatory for devices exposing the extension. it may not be chained alongside the 1.3 features
+        if (!m_DynamicRendering && m_PhysicalDevice->IsExtensionEnabled(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+        {
+            m_DynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+            m_DynamicRenderingFeatures.dynamicRendering = VK_TRUE;
+            m_PhysicalDevice->EnableExtensionBoundFeature(&m_DynamicRenderingFeatures);
+            m_DynamicRendering = true;
+        }
+#endif
+#ifdef VKIT_API_VERSION_1_2
+        VKit::DeviceFeatures imageless{};
+        imageless.Vulkan12.imagelessFramebuffer = VK_TRUE;
+        m_ImagelessFramebuffer = m_PhysicalDevice->EnableFeatures(imageless);
+#endif
+#ifdef VK_KHR_imageless_framebuffer
+        if (!m_ImagelessFramebuffer &&
+            m_PhysicalDevice->IsExtensionEnabled(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME))
+        {
+            m_ImagelessFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR;
+            m_ImagelessFeatures.imagelessFramebuffer = VK_TRUE;
+            m_PhysicalDevice->EnableExtensionBoundFeature(&m_ImagelessFeatures);
+            m_ImagelessFramebuffer = true;
+        }
+#endif
+
+        auto logicalResult = VKit::LogicalDevice::Builder(m_Instance, m_PhysicalDevice)
+                                 .RequireQueue(VKit::Queue_Graphics, 1, 1.0f)
+                                 .Build();
+        if (!logicalResult)
+        {
+            m_Instance->Destroy();
+            delete m_PhysicalDevice;
+            delete m_Instance;
+            return;
+        }
+        m_LogicalDevice = new VKit::LogicalDevice(*logicalResult);
+
+        const auto allocatorResult = VKit::CreateAllocator(*m_LogicalDevice);
+        if (!allocatorResult)
+        {
+            m_LogicalDevice->Destroy();
+            m_Instance->Destroy();
+            delete m_LogicalDevice;
+            delete m_PhysicalDevice;
+            delete m_Instance;
+            return;
+        }
+        m_Allocator = *allocatorResult;
+        m_Valid = true;
+    }
+
+    void Shutdown()
+    {
+        if (m_Valid)
+        {
+            m_LogicalDevice->WaitIdle();
+            VKit::DestroyAllocator(m_Allocator);
+            m_LogicalDevice->Destroy();
+            m_Instance->Destroy();
+            delete m_LogicalDevice;
+            delete m_PhysicalDevice;
+            delete m_Instance;
+            m_Valid = false;
+        }
+    }
+
+    bool m_Valid = false;
+    VKit::Instance *m_Instance = nullptr;
+    VKit::PhysicalDevice *m_PhysicalDevice = nullptr;
+    VKit::LogicalDevice *m_LogicalDevice = nullptr;
+    VmaAllocator m_Allocator = VK_NULL_HANDLE;
+    bool m_DynamicRendering = false;
+    bool m_ImagelessFramebuffer = false;
+#ifdef VK_KHR_dynamic_rendering
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR m_DynamicRenderingFeatures{};
+#endif
+#ifdef VK_KHR_imageless_framebuffer
+    VkPhysicalDeviceImagelessFramebufferFeaturesKHR m_ImagelessFeatures{};
+#endif
+};
+
+struct ContextGuard
+{
+    ContextGuard()
+    {
+        REQUIRE(TestContext::Get().IsValid());
+    }
+};
+
+// formats and sample counts every device must support for attachments
+constexpr VkFormat ColorFormat = VK_FORMAT_R8G8B8A8_UNORM;
+constexpr VkFormat DepthFormat = VK_FORMAT_D16_UNORM;
+constexpr VkExtent2D Extent{64, 64};
+
+VKit::DeviceImage CreateAttachment(const VkFormat format, const VKit::DeviceImageFlags flags,
+                                   const VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT,
+                                   const VkExtent2D &extent = Extent)
+{
+    const auto &ctx = TestContext::Get();
+    auto imageResult = VKit::DeviceImage::Builder(ctx.GetProxy(), ctx.GetAllocator(), extent,
+                                                  TKit::Span<const VkFormat>{&format, 1}, flags)
+                           .SetSamples(samples)
+                           .AddImageView()
+                           .Build();
+    REQUIRE(imageResult);
+    return *imageResult;
+}
+
+// a single subpass writing a color attachment (index 0) and a depth attachment (index 1)
+VKit::RenderPass CreateRenderPass(const u32 imageCount, const VKit::DeviceImageFlags depthFlags = 0,
+                                  const bool sharedDepth = false)
+{
+    auto renderPassResult = VKit::RenderPass::Builder(TestContext::Get().GetLogicalDevice(), imageCount)
+                                .BeginAttachment(VKit::DeviceImageFlag_ColorAttachment)
+                                .RequestFormat(ColorFormat)
+                                .SetFinalLayout(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL)
+                                .EndAttachment()
+                                .BeginAttachment(VKit::DeviceImageFlag_DepthAttachment | depthFlags)
+                                .RequestFormat(DepthFormat)
+                                .SetFinalLayout(VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
+                                .SetShared(sharedDepth)
+                                .EndAttachment()
+                                .BeginSubpass(VK_PIPELINE_BIND_POINT_GRAPHICS)
+                                .AddColorAttachment(0)
+                                .SetDepthStencilAttachment(1)
+                                .EndSubpass()
+                                .Build();
+    REQUIRE(renderPassResult);
+    return *renderPassResult;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// RENDERING INFO
+// ============================================================================
+
+#ifdef VK_KHR_dynamic_rendering
+TEST_CASE("RenderingInfo - Build Validation", "[rendering][rendering-info]")
+{
+    ContextGuard guard;
+    auto proxy = TestContext::Get().GetProxy();
+
+    VKit::DeviceImage color = CreateAttachment(ColorFormat, VKit::DeviceImageFlag_ColorAttachment);
+    VKit::DeviceImage depth = CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment);
+
+    SECTION("No attachments")
+    {
+        CHECK(!VKit::RenderingInfo::Builder(proxy, Extent).Build());
+    }
+
+    SECTION("Missing view")
+    {
+        CHECK(!VKit::RenderingInfo::Builder(proxy, Extent)
+                   .AddColorAttachment(color, VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE, {}, 1)
+                   .Build());
+    }
+
+    SECTION("Render area not covered")
+    {
+        CHECK(!VKit::RenderingInfo::Builder(proxy, Extent)
+                   .AddColorAttachment(color)
+                   .SetRenderArea({{32, 32}, Extent})
+                   .Build());
+        CHECK(!VKit::RenderingInfo::Builder(proxy, {128, 128}).SetDepthAttachment(depth).Build());
+    }
+
+    SECTION("Formats")
+    {
+        auto renderingResult =
+            VKit::RenderingInfo::Builder(proxy, Extent).AddColorAttachment(color).SetDepthAttachment(depth).Build();
+        REQUIRE(renderingResult);
+        const VKit::RenderingInfo &rendering = *renderingResult;
+        REQUIRE(rendering.GetInfo().ColorFormats.GetSize() == 1);
+        CHECK(rendering.GetInfo().ColorFormats[0] == ColorFormat);
+        CHECK(rendering.GetInfo().DepthFormat == DepthFormat);
+        // the image has no stencil aspect
+        CHECK(rendering.GetInfo().StencilFormat == VK_FORMAT_UNDEFINED);
+
+        const VkPipelineRenderingCreateInfoKHR pipelineInfo = rendering.CreatePipelineRenderingInfo();
+        CHECK(pipelineInfo.colorAttachmentCount == 1);
+        CHECK(pipelineInfo.pColorAttachmentFormats[0] == ColorFormat);
+        CHECK(pipelineInfo.depthAttachmentFormat == DepthFormat);
+        CHECK(pipelineInfo.stencilAttachmentFormat == VK_FORMAT_UNDEFINED);
+    }
+
+    depth.Destroy();
+    color.Destroy();
+}
+
+TEST_CASE("RenderingInfo - Resolving Depth Alongside Color", "[rendering][rendering-info]")
+{
+    ContextGuard guard;
+    const auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+
+    VKit::DeviceImage msColor =
+        CreateAttachment(ColorFormat, VKit::DeviceImageFlag_ColorAttachment, VK_SAMPLE_COUNT_4_BIT);
+    VKit::DeviceImage msDepth =
+        CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment, VK_SAMPLE_COUNT_4_BIT);
+    VKit::DeviceImage color = CreateAttachment(ColorFormat, VKit::DeviceImageFlag_ColorAttachment);
+    VKit::DeviceImage depth = CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment);
+
+    // the depth attachment is set first, so that a plain resolve target would land on the color attachment
+    auto renderingResult = VKit::RenderingInfo::Builder(proxy, Extent)
+                               .SetDepthAttachment(msDepth)
+                               .AddColorAttachment(msColor)
+                               .SetResolveTarget(color)
+                               .SetDepthResolveTarget(depth)
+                               .Build();
+    REQUIRE(renderingResult);
+    VKit::RenderingInfo rendering = *renderingResult;
+
+    const VKit::RenderingInfo::Info &info = rendering.GetInfo();
+    REQUIRE(info.ColorAttachments.GetSize() == 1);
+    CHECK(info.ColorAttachments[0].Resolve == &color);
+    CHECK(info.ColorAttachments[0].ResolveMode == VK_RESOLVE_MODE_AVERAGE_BIT_KHR);
+    CHECK(info.DepthAttachment.Image == &msDepth);
+    CHECK(info.DepthAttachment.Resolve == &depth);
+    CHECK(info.DepthAttachment.ResolveMode == VK_RESOLVE_MODE_SAMPLE_ZERO_BIT_KHR);
+
+    if (ctx.HasDynamicRendering())
+    {
+        auto poolResult = VKit::CommandPool::Create(
+            proxy, ctx.GetPhysicalDevice().GetInfo().FamilyIndices[VKit::Queue_Graphics], 0);
+        REQUIRE(poolResult);
+        auto pool = *poolResult;
+        auto commandResult = pool.Allocate();
+        REQUIRE(commandResult);
+        const VkCommandBuffer commandBuffer = *commandResult;
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        REQUIRE(proxy.Table->BeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS);
+        rendering.Begin(commandBuffer);
+        rendering.End(commandBuffer);
+        CHECK(proxy.Table->EndCommandBuffer(commandBuffer) == VK_SUCCESS);
+
+        // resolve targets are transitioned along with the attachments
+        CHECK(msColor.GetLayout() == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        CHECK(color.GetLayout() == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        CHECK(msDepth.GetLayout() == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+        CHECK(depth.GetLayout() == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+
+        pool.Destroy();
+    }
+
+    depth.Destroy();
+    color.Destroy();
+    msDepth.Destroy();
+    msColor.Destroy();
+}
+#endif
+
+// ============================================================================
+// RENDER PASS
+// ============================================================================
+
+TEST_CASE("RenderPass - Saved Memory of Shared Attachments", "[rendering][render-pass]")
+{
+    ContextGuard guard;
+    const auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+    constexpr u32 imageCount = 3;
+
+    u32 requests = 0;
+    VkDeviceSize depthSize = 0;
+    const auto createImage = [&](const VKit::RenderPass &renderPass, const u32 attachmentIndex) {
+        ++requests;
+        const VkFormat format = attachmentIndex == 0 ? ColorFormat : DepthFormat;
+        auto imageResult =
+            VKit::DeviceImage::Builder(proxy, ctx.GetAllocator(), Extent, TKit::Span<const VkFormat>{&format, 1},
+                                       renderPass.GetAttachment(attachmentIndex).Flags)
+                .AddImageView()
+                .Build();
+        if (imageResult && attachmentIndex == 1)
+            depthSize = imageResult->GetMemorySize();
+        return imageResult;
+    };
+
+    SECTION("Per image attachments")
+    {
+        VKit::RenderPass renderPass = CreateRenderPass(imageCount);
+        auto resourcesResult = renderPass.CreateResources(
+            Extent, [&](u32, const u32 attachmentIndex) { return createImage(renderPass, attachmentIndex); });
+        REQUIRE(resourcesResult);
+        VKit::RenderPass::Resources resources = *resourcesResult;
+
+        CHECK(requests == 2 * imageCount);
+        CHECK(resources.GetSavedMemory() == 0);
+        CHECK(resources.GetImageView(0, 1) != resources.GetImageView(1, 1));
+
+        resources.Destroy();
+        renderPass.Destroy();
+    }
+
+    SECTION("Shared transient depth")
+    {
+        VKit::RenderPass renderPass = CreateRenderPass(imageCount, VKit::DeviceImageFlag_Transient, true);
+        auto resourcesResult = renderPass.CreateResources(
+            Extent, [&](u32, const u32 attachmentIndex) { return createImage(renderPass, attachmentIndex); });
+        REQUIRE(resourcesResult);
+        VKit::RenderPass::Resources resources = *resourcesResult;
+
+        // the shared attachment is only requested for the first image index
+        CHECK(requests == imageCount + 1);
+        REQUIRE(depthSize > 0);
+        CHECK(resources.GetSavedMemory() == depthSize * (imageCount - 1));
+        for (u32 i = 1; i < imageCount; ++i)
+        {
+            CHECK(resources.GetImageView(i, 1) == resources.GetImageView(0, 1));
+            CHECK(resources.GetFramebuffer(i) != resources.GetFramebuffer(0));
+        }
+
+        resources.Destroy();
+        CHECK(resources.GetSavedMemory() == 0);
+        renderPass.Destroy();
+    }
+}
+
+TEST_CASE("DeviceImage - Transient Attachments Prefer Lazily Allocated Memory", "[rendering][render-pass]")
+{
+    ContextGuard guard;
+    const auto &ctx = TestContext::Get();
+    auto proxy = ctx.GetProxy();
+    const VmaAllocator allocator = ctx.GetAllocator();
+
+    const auto isLazy = [&](const VKit::DeviceImage &image) {
+        VmaAllocationInfo info;
+        vmaGetAllocationInfo(allocator, image.GetInfo().Allocation, &info);
+        VkMemoryPropertyFlags flags;
+        vmaGetMemoryTypeProperties(allocator, info.memoryType, &flags);
+        return (flags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0;
+    };
+
+    VKit::DeviceImage transient =
+        CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment | VKit::DeviceImageFlag_Transient);
+    VKit::DeviceImage regular = CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment);
+    CHECK(transient.GetInfo().Usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+    CHECK(!(regular.GetInfo().Usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT));
+
+    // lazily allocated memory is only preferred, so it is expected only when the image can live in it
+    VkMemoryRequirements requirements;
+    proxy.Table->GetImageMemoryRequirements(proxy, transient, &requirements);
+    const VkPhysicalDeviceMemoryProperties *properties;
+    vmaGetMemoryProperties(allocator, &properties);
+
+    bool lazyAvailable = false;
+    for (u32 i = 0; i < properties->memoryTypeCount; ++i)
+        if ((requirements.memoryTypeBits & (1U << i)) &&
+            (properties->memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT))
+            lazyAvailable = true;
+
+    CHECK(isLazy(transient) == lazyAvailable);
+    CHECK(!isLazy(regular));
+
+    regular.Destroy();
+    transient.Destroy();
+}
+
+// ============================================================================
+// FRAMEBUFFER CACHE
+// ============================================================================
+
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_imageless_framebuffer)
+TEST_CASE("FramebufferCache - Hits, Eviction and Purging", "[rendering][framebuffer-cache]")
+{
+    ContextGuard guard;
+    const auto &ctx = TestContext::Get();
+    if (!ctx.HasImagelessFramebuffer())
+        SKIP("Imageless framebuffers are not supported");
+
+    auto proxy = ctx.GetProxy();
+    VKit::RenderPass first = CreateRenderPass(1);
+    VKit::RenderPass second = CreateRenderPass(1);
+
+    const VKit::DeviceImage attachments[] = {CreateAttachment(ColorFormat, VKit::DeviceImageFlag_ColorAttachment),
+                                             CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment)};
+    // distinct images with the same description
+    const VKit::DeviceImage alike[] = {CreateAttachment(ColorFormat, VKit::DeviceImageFlag_ColorAttachment),
+                                       CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment)};
+    constexpr VkExtent2D smallExtent{32, 32};
+    const VKit::DeviceImage small[] = {
+        CreateAttachment(ColorFormat, VKit::DeviceImageFlag_ColorAttachment, VK_SAMPLE_COUNT_1_BIT, smallExtent),
+        CreateAttachment(DepthFormat, VKit::DeviceImageFlag_DepthAttachment, VK_SAMPLE_COUNT_1_BIT, smallExtent)};
+
+    VKit::FramebufferCache cache{proxy};
+    const auto acquire = [&](const VKit::RenderPass &renderPass, const VkExtent2D &extent,
+                             const VKit::DeviceImage *images) {
+        const auto framebufferResult =
+            cache.Acquire(renderPass, extent, TKit::Span<const VKit::DeviceImage>{images, 2});
+        REQUIRE(framebufferResult);
+        return *framebufferResult;
+    };
+
+    const VkFramebuffer framebuffer = acquire(first, Extent, attachments);
+    CHECK(cache.GetFramebufferCount() == 1);
+    CHECK(acquire(first, Extent, alike) == framebuffer);
+    CHECK(cache.GetFramebufferCount() == 1);
+
+    const VkFramebuffer smallFramebuffer = acquire(first, smallExtent, small);
+    CHECK(smallFramebuffer != framebuffer);
+    CHECK(acquire(second, Extent, attachments) != framebuffer);
+    CHECK(cache.GetFramebufferCount() == 3);
+
+    // only the framebuffer of the stale extent goes away
+    cache.Purge(Extent);
+    CHECK(cache.GetFramebufferCount() == 2);
+    CHECK(acquire(first, Extent, attachments) == framebuffer);
+    CHECK(cache.GetFramebufferCount() == 2);
+
+    cache.Evict(first);
+    CHECK(cache.GetFramebufferCount() == 1);
+    acquire(first, Extent, attachments);
+    CHECK(cache.GetFramebufferCount() == 2);
+
+    cache.Evict(first);
+    cache.Evict(second);
+    CHECK(cache.GetFramebufferCount() == 0);
+
+    acquire(first, Extent, attachments);
+    cache.Destroy();
+    CHECK(cache.GetFramebufferCount() == 0);
+
+    for (const VKit::DeviceImage *images : {attachments, alike, small})
+        for (u32 i = 0; i < 2; ++i)
+        {
+            VKit::DeviceImage image = images[i];
+            image.Destroy();
+        }
+    second.Destroy();
+    first.Destroy();
+}
+
+TEST_CASE("FramebufferCache - Imageless Render Pass Resources", "[rendering][framebuffer-cache]")
+{
+    ContextGuard guard;
+    const auto &ctx = TestContext::Get();
+    if (!ctx.HasImagelessFramebuffer())
+        SKIP("Imageless framebuffers are not supported");
+
+    auto proxy = ctx.GetProxy();
+    constexpr u32 imageCount = 3;
+    VKit::RenderPass renderPass = CreateRenderPass(imageCount);
+    VKit::FramebufferCache cache{proxy};
+
+    const auto createImage = [&](u32, const u32 attachmentIndex) {
+        const VkFormat format = attachmentIndex == 0 ? ColorFormat : DepthFormat;
+        return VKit::DeviceImage::Builder(proxy, ctx.GetAllocator(), Extent, TKit::Span<const VkFormat>{&format, 1},
+                                          renderPass.GetAttachment(attachmentIndex).Flags)
+            .AddImageView()
+            .Build();
+    };
+
+    auto resourcesResult = renderPass.CreateImagelessResources(Extent, createImage, cache);
+    REQUIRE(resourcesResult);
+    VKit::RenderPass::Resources resources = *resourcesResult;
+    CHECK(resources.IsImageless());
+    CHECK(cache.GetFramebufferCount() == 1);
+    for (u32 i = 1; i < imageCount; ++i)
+        CHECK(resources.GetFramebuffer(i) == resources.GetFramebuffer(0));
+
+    // recreating the resources alike reuses the framebuffer
+    auto otherResult = renderPass.CreateImagelessResources(Extent, createImage, cache);
+    REQUIRE(otherResult);
+    VKit::RenderPass::Resources other = *otherResult;
+    CHECK(other.GetFramebuffer(0) == resources.GetFramebuffer(0));
+    CHECK(cache.GetFramebufferCount() == 1);
+    other.Destroy();
+
+    // the begin info supplies the views of the requested image index
+    const VkRenderPassAttachmentBeginInfoKHR attachmentInfo = resources.CreateAttachmentBeginInfo(1);
+    REQUIRE(attachmentInfo.attachmentCount == 2);
+    CHECK(attachmentInfo.pAttachments[0] == resources.GetImageView(1, 0));
+    CHECK(attachmentInfo.pAttachments[1] == resources.GetImageView(1, 1));
+    CHECK(attachmentInfo.pAttachments[0] != resources.GetImageView(0, 0));
+
+    auto poolResult =
+        VKit::CommandPool::Create(proxy, ctx.GetPhysicalDevice().GetInfo().FamilyIndices[VKit::Queue_Graphics], 0);
+    REQUIRE(poolResult);
+    auto pool = *poolResult;
+    auto commandResult = pool.Allocate();
+    REQUIRE(commandResult);
+    const VkCommandBuffer commandBuffer = *commandResult;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    REQUIRE(proxy.Table->BeginCommandBuffer(commandBuffer, &beginInfo) == VK_SUCCESS);
+
+    VkClearValue clearValues[2]{};
+    clearValues[1].depthStencil = {1.f, 0};
+
+    VkRenderPassBeginInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.pNext = &attachmentInfo;
+    renderPassInfo.renderPass = renderPass;
+    renderPassInfo.framebuffer = resources.GetFramebuffer(1);
+    renderPassInfo.renderArea = {{0, 0}, Extent};
+    renderPassInfo.clearValueCount = 2;
+    renderPassInfo.pClearValues = clearValues;
+    proxy.Table->CmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    proxy.Table->CmdEndRenderPass(commandBuffer);
+    CHECK(proxy.Table->EndCommandBuffer(commandBuffer) == VK_SUCCESS);
+    pool.Destroy();
+
+    // the framebuffer belongs to the cache, so it outlives the resources
+    resources.Destroy();
+    CHECK(cache.GetFramebufferCount() == 1);
+
+    cache.Evict(renderPass);
+    CHECK(cache.GetFramebufferCount() == 0);
+    renderPass.Destroy();
+}
+#endif
@@ -2,6 +2,7 @@
 #include "vkit/core/core.hpp"
 #include "vkit/vulkan/loader.hpp"
 #include "vkit/core/alias.hpp"
+#include "vkit/core/name_registry.hpp"
 #include "tkit/container/stack_array.hpp"
 
 namespace VKit
@@ -10,40 +11,41 @@ struct Capabilities
 {
     TKit::ArenaArray<VkExtensionProperties> AvailableExtensions{};
     TKit::ArenaArray<VkLayerProperties> AvailableLayers{};
+
+    // indexed by interned name id, holding the position of the extension or layer in the arrays above
+    TKit::ArenaArray<u32> ExtensionIndices{};
+    TKit::ArenaArray<u32> LayerIndices{};
 };
 
 static TKit::Storage<Capabilities> s_Capabilities{};
 
+static u32 getIndex(const TKit::ArenaArray<u32> &indices, const char *name)
+{
+    // names interned after initialization are never supported
+    const u32 id = FindName(name);
+    return id < indices.GetSize() ? indices[id] : NullName;
+}
+
 const VkExtensionProperties *GetExtensionByName(const char *name)
 {
-    for (const VkExtensionProperties &extension : s_Capabilities->AvailableExtensions)
-        if (strcmp(name, extension.extensionName) == 0)
-            return &extension;
-    return nullptr;
+    const u32 index = getIndex(s_Capabilities->ExtensionIndices, name);
+    return index != NullName ? &s_Capabilities->AvailableExtensions[index] : nullptr;
 }
 
 const VkLayerProperties *GetLayerByName(const char *name)
 {
-    for (const VkLayerProperties &layer : s_Capabilities->AvailableLayers)
-        if (strcmp(name, layer.layerName) == 0)
-            return &layer;
-    return nullptr;
+    const u32 index = getIndex(s_Capabilities->LayerIndices, name);
+    return index != NullName ? &s_Capabilities->AvailableLayers[index] : nullptr;
 }
 
 bool IsExtensionSupported(const char *name)
 {
-    for (const VkExtensionProperties &extension : s_Capabilities->AvailableExtensions)
-        if (strcmp(name, extension.extensionName) == 0)
-            return true;
-    return false;
+    return getIndex(s_Capabilities->ExtensionIndices, name) != NullName;
 }
 
 bool IsLayerSupported(const char *name)
 {
-    for (const VkLayerProperties &layer : s_Capabilities->AvailableLayers)
-        if (strcmp(name, layer.layerName) == 0)
-            return true;
-    return false;
+    return getIndex(s_Capabilities->LayerIndices, name) != NullName;
 }
 const VkExtensionProperties &GetExtensionByIndex(const u32 index)
 {
@@ -203,10 +205,39 @@ Result<> Initialize(const Specs &specs)
                 Result<>);
             count += counts[i + 1];
         }
+
+    TKit::StackArray<u32> layerIds{};
+    layerIds.Resize(layerCount);
+    for (u32 i = 0; i < layerCount; ++i)
+        layerIds[i] = InternName(s_Capabilities->AvailableLayers[i].layerName);
+
+    TKit::StackArray<u32> extensionIds{};
+    extensionIds.Resize(extensionCount);
+    for (u32 i = 0; i < extensionCount; ++i)
+        extensionIds[i] = InternName(extensions[i].extensionName);
+
+    const u32 nameCount = GetInternedNameCount();
+    s_Capabilities->LayerIndices.Resize(nameCount);
+    s_Capabilities->ExtensionIndices.Resize(nameCount);
+    for (u32 i = 0; i < nameCount; ++i)
+    {
+        s_Capabilities->LayerIndices[i] = NullName;
+        s_Capabilities->ExtensionIndices[i] = NullName;
+    }
+
+    for (u32 i = 0; i < layerCount; ++i)
+        s_Capabilities->LayerIndices[layerIds[i]] = i;
+
+    // layers may report extensions that are already available, so they are deduplicated by id
     s_Capabilities->AvailableExtensions.Reserve(extensionCount);
     for (u32 i = 0; i < extensionCount; ++i)
-        if (!IsExtensionSupported(extensions[i].extensionName))
-            s_Capabilities->AvailableExtensions.Append(extensions[i]);
+    {
+        u32 &index = s_Capabilities->ExtensionIndices[extensionIds[i]];
+        if (index != NullName)
+            continue;
+        index = s_Capabilities->AvailableExtensions.GetSize();
+        s_Capabilities->AvailableExtensions.Append(extensions[i]);
+    }
 
     return Result<>::Ok();
 }
@@ -0,0 +1,144 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/core/name_registry.hpp"
+
+#include <unordered_map>
+#include <deque>
+#include <mutex>
+#include <bit>
+#include <cstring>
+
+namespace VKit
+{
+namespace
+{
+// names are kept with std containers, as the registry outlives the allocators pushed by `Initialize()`
+struct NameRegistry
+{
+    std::unordered_map<u64, u32> Ids{};
+    // a deque, so that the pointers returned by `GetInternedName()` stay valid as the registry grows
+    std::deque<std::string> Names{};
+    std::mutex Mutex{};
+};
+} // namespace
+
+static NameRegistry &getRegistry()
+{
+    static NameRegistry registry{};
+    return registry;
+}
+
+// collisions are astronomically rare between the few hundred existing names, but they are still resolved by rehashing
+static u64 rehash(const u64 hash)
+{
+    return hash * 0x9E3779B97F4A7C15ULL + 1;
+}
+
+u32 InternName(const char *name)
+{
+    NameRegistry &registry = getRegistry();
+    std::scoped_lock lock{registry.Mutex};
+    for (u64 hash = HashName(name);; hash = rehash(hash))
+    {
+        const auto it = registry.Ids.find(hash);
+        if (it == registry.Ids.end())
+        {
+            const u32 id = static_cast<u32>(registry.Names.size());
+            registry.Names.emplace_back(name);
+            registry.Ids.emplace(hash, id);
+            return id;
+        }
+        if (registry.Names[it->second] == name)
+            return it->second;
+    }
+}
+
+u32 FindName(const char *name)
+{
+    NameRegistry &registry = getRegistry();
+    std::scoped_lock lock{registry.Mutex};
+    for (u64 hash = HashName(name);; hash = rehash(hash))
+    {
+        const auto it = registry.Ids.find(hash);
+        if (it == registry.Ids.end())
+            return NullName;
+        if (registry.Names[it->second] == name)
+            return it->second;
+    }
+}
+
+const char *GetInternedName(const u32 id)
+{
+    NameRegistry &registry = getRegistry();
+    std::scoped_lock lock{registry.Mutex};
+    TKIT_ASSERT(id < registry.Names.size(), "[VULKIT][NAME-REGISTRY] The name id {} has not been interned", id);
+    return registry.Names[id].c_str();
+}
+
+u32 GetInternedNameCount()
+{
+    NameRegistry &registry = getRegistry();
+    std::scoped_lock lock{registry.Mutex};
+    return static_cast<u32>(registry.Names.size());
+}
+
+bool NameSet::Insert(const u32 id)
+{
+    TKIT_ASSERT(id != NullName, "[VULKIT][NAME-REGISTRY] Cannot insert a null name into a set");
+    const u32 word = id / 64;
+    const u64 bit = 1ULL << (id % 64);
+    if (word >= m_Words.GetSize())
+        m_Words.Resize(word + 1, 0);
+    else if (m_Words[word] & bit)
+        return false;
+
+    m_Words[word] |= bit;
+    return true;
+}
+bool NameSet::Insert(const char *name)
+{
+    return Insert(InternName(name));
+}
+
+bool NameSet::Contains(const u32 id) const
+{
+    const u32 word = id / 64;
+    return word < m_Words.GetSize() && (m_Words[word] & (1ULL << (id % 64)));
+}
+bool NameSet::Contains(const char *name) const
+{
+    const u32 id = FindName(name);
+    return id != NullName && Contains(id);
+}
+
+bool NameSet::ContainsAll(const NameSet &other) const
+{
+    const u32 size = m_Words.GetSize();
+    for (u32 i = 0; i < other.m_Words.GetSize(); ++i)
+    {
+        const u64 word = i < size ? m_Words[i] : 0;
+        if ((other.m_Words[i] & ~word) != 0)
+            return false;
+    }
+    return true;
+}
+
+void NameSet::Clear()
+{
+    m_Words.Clear();
+}
+
+u32 NameSet::GetSize() const
+{
+    u32 size = 0;
+    for (const u64 word : m_Words)
+        size += static_cast<u32>(std::popcount(word));
+    return size;
+}
+bool NameSet::IsEmpty() const
+{
+    for (const u64 word : m_Words)
+        if (word != 0)
+            return false;
+    return true;
+}
+} // namespace VKit
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "vkit/core/alias.hpp"
+#include "tkit/container/tier_array.hpp"
+
+namespace VKit
+{
+constexpr u32 NullName = ~0U;
+
+// 64-bit FNV-1a. constexpr, so that known names can be matched in a switch
+constexpr u64 HashName(const char *name)
+{
+    u64 hash = 0xCBF29CE484222325ULL;
+    for (; *name; ++name)
+    {
+        hash ^= static_cast<u8>(*name);
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Interns an extension or layer name into a dense, process-wide ID.
+ *
+ * Names are looked up by their hash, so interning or finding a name costs a single pass over its characters and a
+ * hash map probe. IDs are assigned in interning order starting from zero and are never released, so they stay valid
+ * across `Terminate()` and can be stored in a `NameSet`.
+ *
+ * Only names reported by the driver or requested by the user should be interned. Queries for arbitrary names should
+ * use `FindName()`, which never grows the registry.
+ *
+ */
+u32 InternName(const char *name);
+// returns `NullName` if the name has never been interned
+u32 FindName(const char *name);
+
+const char *GetInternedName(u32 id);
+u32 GetInternedNameCount();
+
+/**
+ * @brief A bitset over interned name IDs, to store sets of extensions or layers.
+ *
+ * Membership queries are a single bit test, and checking that a set contains another one is a word-wise AND.
+ *
+ */
+class NameSet
+{
+  public:
+    // returns true if the name was not in the set
+    bool Insert(u32 id);
+    bool Insert(const char *name);
+
+    bool Contains(u32 id) const;
+    bool Contains(const char *name) const;
+
+    bool ContainsAll(const NameSet &other) const;
+
+    void Clear();
+
+    u32 GetSize() const;
+    bool IsEmpty() const;
+
+  private:
+    TKit::TierArray<u64> m_Words{};
+};
+} // namespace VKit
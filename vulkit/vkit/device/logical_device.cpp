@@ -100,7 +100,8 @@ Result<LogicalDevice> LogicalDevice::Builder::Build() const
     }
 
     TKit::StackArray<const char *> enabledExtensions;
-    enabledExtensions.Reserve(devInfo.EnabledExtensions.GetSize());
+    // room for the instance extensions, which are only handed to the device table
+    enabledExtensions.Reserve(devInfo.EnabledExtensions.GetSize() + instanceInfo.EnabledExtensions.GetSize());
     for (const TKit::TierString &extension : devInfo.EnabledExtensions)
         enabledExtensions.Append(extension.CString());
 
@@ -151,9 +152,15 @@ Result<LogicalDevice> LogicalDevice::Builder::Build() const
         itable->CreateDevice(*m_PhysicalDevice, &createInfo, instanceInfo.AllocationCallbacks, &device),
         Result<LogicalDevice>);
 
+    // instance extensions such as VK_EXT_debug_utils also provide device level functions
+    for (const char *extension : instanceInfo.EnabledExtensions)
+        enabledExtensions.Append(extension);
+
     TKit::TierAllocator *tier = TKit::GetTier();
-    const Vulkan::DeviceTable *table =
-        tier->Create<Vulkan::DeviceTable>(Vulkan::DeviceTable::Create(device, *m_Instance->GetInfo().Table));
+    // only the core functions of the device's version and the ones of its enabled extensions are loaded eagerly
+    const Vulkan::DeviceTable *table = tier->Create<Vulkan::DeviceTable>(
+        Vulkan::DeviceTable::Create(device, *m_Instance->GetInfo().Table, devInfo.ApiVersion,
+                                    enabledExtensions.GetSize(), enabledExtensions.GetData()));
 
     Info info{};
     info.Instance = m_Instance;
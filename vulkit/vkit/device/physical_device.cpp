@@ -172,11 +172,6 @@ static constexpr TKit::FixedArray<VkBool32 VkPhysicalDeviceVulkan14Features::*,
     &VkPhysicalDeviceVulkan14Features::pushDescriptor};
 #endif
 
-template <typename C, typename T> static bool contains(const C &container, const T &value)
-{
-    return std::find(container.begin(), container.end(), value) != container.end();
-}
-
 template <typename T> const auto &getMembers()
 {
 #ifdef VKIT_API_VERSION_1_2
@@ -419,42 +414,50 @@ Result<PhysicalDevice> PhysicalDevice::Selector::judgeDevice(const VkPhysicalDev
 
     TKit::StackArray<TKit::TierString> availableExtensions;
     availableExtensions.Reserve(extensionsProps.GetSize());
+    NameSet availableSet{};
     for (const VkExtensionProperties &extension : extensionsProps)
+    {
         availableExtensions.Append(extension.extensionName);
+        availableSet.Insert(extension.extensionName);
+    }
+
+    if (!availableSet.ContainsAll(m_RequiredExtensionSet))
+        for (const TKit::TierString &extension : m_RequiredExtensions)
+            if (!availableSet.Contains(extension.CString()))
+                return JudgeResult::Error(
+                    Error_MissingExtension,
+                    TKit::TierString::Format(
+                        "[VULKIT][P-DEVICE] The device '{}' does not support the required extension '{}'", name,
+                        extension));
 
     TKit::StackArray<TKit::TierString> enabledExtensions;
     enabledExtensions.Reserve(m_RequestedExtensions.GetCapacity());
+    NameSet enabledSet = m_RequiredExtensionSet;
     for (const TKit::TierString &extension : m_RequiredExtensions)
-    {
-        if (!contains(availableExtensions, extension))
-            return JudgeResult::Error(
-                Error_MissingExtension,
-                TKit::TierString::Format(
-                    "[VULKIT][P-DEVICE] The device '{}' does not support the required extension '{}'", name,
-                    extension));
         enabledExtensions.Append(extension);
-    }
 
+    const auto enable = [&enabledExtensions, &enabledSet](const char *extension) {
+        if (enabledSet.Insert(extension))
+            enabledExtensions.Append(extension);
+    };
+
+    if (!availableSet.ContainsAll(m_RequestedExtensionSet))
+        fullySuitable = false;
     for (const TKit::TierString &extension : m_RequestedExtensions)
-        if (!contains(availableExtensions, extension))
-        {
+        if (!availableSet.Contains(extension.CString()))
             TKIT_LOG_WARNING("[VULKIT][P-DEVICE] The device '{}' does not support the requested extension '{}'", name,
                              extension);
-            fullySuitable = false;
-        }
-        else if (!contains(enabledExtensions, extension))
-            enabledExtensions.Append(extension);
+        else
+            enable(extension.CString());
 
     DeviceSelectorFlags flags = m_Flags;
     const auto checkFlags = [&flags](const DeviceSelectorFlags pflags) -> bool { return pflags & flags; };
 
-    if (checkFlags(DeviceSelectorFlag_PortabilitySubset) &&
-        contains(availableExtensions, "VK_KHR_portability_subset") &&
-        !contains(enabledExtensions, "VK_KHR_portability_subset"))
-        enabledExtensions.Append("VK_KHR_portability_subset");
+    if (checkFlags(DeviceSelectorFlag_PortabilitySubset) && availableSet.Contains("VK_KHR_portability_subset"))
+        enable("VK_KHR_portability_subset");
 
-    if (checkFlags(DeviceSelectorFlag_RequirePresentQueue) && !contains(enabledExtensions, "VK_KHR_swapchain"))
-        enabledExtensions.Append("VK_KHR_swapchain");
+    if (checkFlags(DeviceSelectorFlag_RequirePresentQueue))
+        enable("VK_KHR_swapchain");
 
     u32 familyCount;
     table->GetPhysicalDeviceQueueFamilyProperties(device, &familyCount, nullptr);
@@ -779,6 +782,8 @@ Result<PhysicalDevice> PhysicalDevice::Selector::judgeDevice(const VkPhysicalDev
     deviceInfo.ApiVersion = properties.Core.apiVersion;
     deviceInfo.AvailableExtensions = availableExtensions;
     deviceInfo.EnabledExtensions = enabledExtensions;
+    deviceInfo.AvailableExtensionSet = availableSet;
+    deviceInfo.EnabledExtensionSet = enabledSet;
     deviceInfo.Flags = deviceFlags;
     deviceInfo.FamilyIndices[Queue_Graphics] = graphicsIndex;
     deviceInfo.FamilyIndices[Queue_Compute] = computeIndex;
@@ -892,11 +897,11 @@ bool PhysicalDevice::EnableFeatures(const DeviceFeatures &features)
 
 bool PhysicalDevice::IsExtensionSupported(const char *extension) const
 {
-    return contains(m_Info.AvailableExtensions, extension);
+    return m_Info.AvailableExtensionSet.Contains(extension);
 }
 bool PhysicalDevice::IsExtensionEnabled(const char *extension) const
 {
-    return contains(m_Info.EnabledExtensions, extension);
+    return m_Info.EnabledExtensionSet.Contains(extension);
 }
 bool PhysicalDevice::EnableExtension(const char *extension)
 {
@@ -905,6 +910,7 @@ bool PhysicalDevice::EnableExtension(const char *extension)
     if (!IsExtensionSupported(extension))
         return false;
     m_Info.EnabledExtensions.Append(extension);
+    m_Info.EnabledExtensionSet.Insert(extension);
     return true;
 }
 
@@ -960,13 +966,13 @@ PhysicalDevice::Selector &PhysicalDevice::Selector::RequestApiVersion(u32 major,
 }
 PhysicalDevice::Selector &PhysicalDevice::Selector::RequireExtension(const char *extension)
 {
-    if (!contains(m_RequiredExtensions, extension))
+    if (m_RequiredExtensionSet.Insert(extension))
         m_RequiredExtensions.Append(extension);
     return *this;
 }
 PhysicalDevice::Selector &PhysicalDevice::Selector::RequestExtension(const char *extension)
 {
-    if (!contains(m_RequestedExtensions, extension))
+    if (m_RequestedExtensionSet.Insert(extension))
         m_RequestedExtensions.Append(extension);
     return *this;
 }
@@ -162,6 +162,8 @@ class PhysicalDevice
 
         TKit::TierArray<TKit::TierString> m_RequiredExtensions;
         TKit::TierArray<TKit::TierString> m_RequestedExtensions;
+        NameSet m_RequiredExtensionSet{};
+        NameSet m_RequestedExtensionSet{};
 
         DeviceFeatures m_RequiredFeatures{};
     };
@@ -178,6 +180,9 @@ class PhysicalDevice
         // std string because extension names are "locally" allocated
         TKit::TierArray<TKit::TierString> EnabledExtensions;
         TKit::TierArray<TKit::TierString> AvailableExtensions;
+        // the same extensions as interned ids, for constant time queries
+        NameSet EnabledExtensionSet;
+        NameSet AvailableExtensionSet;
 
         DeviceFeatures EnabledFeatures{};
         DeviceFeatures AvailableFeatures{};
@@ -175,7 +175,8 @@ Result<Swapchain> Swapchain::Builder::Build() const
     finalImages.Resize(imageCount);
     for (u32 i = 0; i < imageCount; ++i)
     {
-        DeviceImage::Info iminfo = DeviceImage::Info::FromSwapchain(surfaceFormat.format, extent);
+        DeviceImage::Info iminfo = DeviceImage::Info::FromSwapchain(surfaceFormat.format, extent,
+                                                                    DeviceImageFlag_ColorAttachment, m_ImageUsage);
         finalImages[i] = DeviceImage{*m_Device, images[i], VK_IMAGE_LAYOUT_UNDEFINED, iminfo};
         if (checkFlags(SwapchainBuilderFlag_CreateImageViews))
             TKIT_RETURN_IF_FAILED(finalImages[i].AddImageView(), cleanup());
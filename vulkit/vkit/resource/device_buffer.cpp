@@ -284,4 +284,22 @@ VkDescriptorBufferInfo DeviceBuffer::CreateDescriptorInfo(const VkDeviceSize siz
     return info;
 }
 
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_buffer_device_address)
+VkDeviceAddress DeviceBuffer::GetDeviceAddress() const
+{
+    VkBufferDeviceAddressInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    info.buffer = m_Buffer;
+#    ifdef VKIT_API_VERSION_1_2
+    if (m_Device.Table->vkGetBufferDeviceAddress)
+        return m_Device.Table->GetBufferDeviceAddress(m_Device, &info);
+#    endif
+#    ifdef VK_KHR_buffer_device_address
+    return m_Device.Table->GetBufferDeviceAddressKHR(m_Device, &info);
+#    else
+    return m_Device.Table->GetBufferDeviceAddress(m_Device, &info);
+#    endif
+}
+#endif
+
 } // namespace VKit
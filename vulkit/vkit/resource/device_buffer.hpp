@@ -141,6 +141,11 @@ class DeviceBuffer
     VkDescriptorBufferInfo CreateDescriptorInfo(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0) const;
     VkDescriptorBufferInfo CreateDescriptorInfoAt(u32 index) const;
 
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_buffer_device_address)
+    // the buffer must have been created with VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT
+    VkDeviceAddress GetDeviceAddress() const;
+#endif
+
     const ProxyDevice &GetDevice() const
     {
         return m_Device;
@@ -123,6 +123,17 @@ DeviceImage::Builder::Builder(const ProxyDevice &device, const VmaAllocator allo
         m_ImageInfo.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
     if (m_Flags & DeviceImageFlag_Destination)
         m_ImageInfo.usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    if (m_Flags & DeviceImageFlag_Transient)
+        m_ImageInfo.usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+}
+
+VkDeviceSize DeviceImage::GetMemorySize() const
+{
+    if (!m_Info.Allocation)
+        return 0;
+    VmaAllocationInfo info;
+    vmaGetAllocationInfo(m_Info.Allocator, m_Info.Allocation, &info);
+    return info.size;
 }
 
 VkImageAspectFlags DeviceImage::InferAspectMask() const
@@ -131,7 +142,7 @@ VkImageAspectFlags DeviceImage::InferAspectMask() const
 }
 
 DeviceImage::Info DeviceImage::Info::FromSwapchain(const TKit::Span<const VkFormat> formats, const VkExtent2D &extent,
-                                                   DeviceImageFlags flags)
+                                                   DeviceImageFlags flags, const VkImageUsageFlags usage)
 {
     if (flags & DeviceImageFlag_ColorAttachment)
         flags |= DeviceImageFlag_Color;
@@ -152,6 +163,8 @@ DeviceImage::Info DeviceImage::Info::FromSwapchain(const TKit::Span<const VkForm
     info.Type = VK_IMAGE_TYPE_2D;
     info.MipLevels = 1;
     info.ArrayLayers = 1;
+    info.Usage = usage;
+    info.CreateFlags = 0;
     return info;
 }
 
@@ -168,6 +181,9 @@ Result<DeviceImage> DeviceImage::Builder::Build() const
         allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
         allocInfo.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
     }
+    // lazily allocated memory is not available everywhere, so it is only preferred
+    if (m_ImageInfo.usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT)
+        allocInfo.preferredFlags = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
 
     VkImage image;
     VmaAllocation allocation;
@@ -198,6 +214,8 @@ Result<DeviceImage> DeviceImage::Builder::Build() const
     info.MipLevels = m_ImageInfo.mipLevels;
     info.ArrayLayers = m_ImageInfo.arrayLayers;
     info.Flags = m_Flags;
+    info.Usage = m_ImageInfo.usage;
+    info.CreateFlags = m_ImageInfo.flags;
 
     DeviceImage img{m_Device, image, m_ImageInfo.initialLayout, info};
 
@@ -27,6 +27,8 @@ enum DeviceImageFlagBit : DeviceImageFlags
     DeviceImageFlag_ForceHostVisible = 1U << 9,
     DeviceImageFlag_Source = 1U << 10,
     DeviceImageFlag_Destination = 1U << 11,
+    // contents never leave the render pass, so the image may be backed by lazily allocated memory
+    DeviceImageFlag_Transient = 1U << 12,
 };
 
 } // namespace VKit
@@ -101,9 +103,13 @@ class DeviceImage
         u32 MipLevels;
         u32 ArrayLayers;
         DeviceImageFlags Flags;
+        // the ones the image was created with. needed to describe the image without it, as imageless framebuffers do
+        VkImageUsageFlags Usage;
+        VkImageCreateFlags CreateFlags;
 
         static Info FromSwapchain(TKit::Span<const VkFormat> formats, const VkExtent2D &extent,
-                                  DeviceImageFlags flags = DeviceImageFlag_ColorAttachment);
+                                  DeviceImageFlags flags = DeviceImageFlag_ColorAttachment,
+                                  VkImageUsageFlags usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
     };
 
     struct TransitionInfo
@@ -207,6 +213,9 @@ class DeviceImage
 
     VkImageAspectFlags InferAspectMask() const;
 
+    // the size of the memory backing the image, or 0 if it is not owned (as with swap chain images)
+    VkDeviceSize GetMemorySize() const;
+
     VKIT_SET_DEBUG_NAME(m_Image, VK_OBJECT_TYPE_IMAGE)
 #ifdef VK_EXT_debug_utils
     VKIT_NO_DISCARD Result<> SetViewNames(const char *name)
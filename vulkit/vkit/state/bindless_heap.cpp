@@ -0,0 +1,229 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/bindless_heap.hpp"
+
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_EXT_descriptor_indexing)
+namespace VKit
+{
+static VkDescriptorType getDescriptorType(const BindlessType type)
+{
+    switch (type)
+    {
+    case Bindless_SampledImage:
+        return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    case Bindless_StorageImage:
+        return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    case Bindless_StorageBuffer:
+        return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    case Bindless_Sampler:
+        return VK_DESCRIPTOR_TYPE_SAMPLER;
+    default:
+        TKIT_FATAL("[VULKIT][BINDLESS-HEAP] Unknown bindless type");
+        return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    }
+}
+
+const char *ToString(const BindlessType type)
+{
+    switch (type)
+    {
+    case Bindless_SampledImage:
+        return "SampledImage";
+    case Bindless_StorageImage:
+        return "StorageImage";
+    case Bindless_StorageBuffer:
+        return "StorageBuffer";
+    case Bindless_Sampler:
+        return "Sampler";
+    case Bindless_Count:
+        return "Unknown";
+    }
+    return "Unknown";
+}
+
+Result<BindlessHeap> BindlessHeap::Builder::Build() const
+{
+    const VkDescriptorBindingFlagsEXT flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+                                              VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+                                              VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT;
+
+    DescriptorSetLayout::Builder lbuilder{m_Device};
+    lbuilder.SetFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT);
+
+    DescriptorPool::Builder pbuilder{m_Device};
+    pbuilder.SetMaxSets(1).SetFlags(VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT);
+
+    bool empty = true;
+    for (u32 i = 0; i < Bindless_Count; ++i)
+    {
+        const u32 capacity = m_Capacities[i];
+        if (capacity == 0)
+            continue;
+        empty = false;
+
+        const VkDescriptorType type = getDescriptorType(static_cast<BindlessType>(i));
+        lbuilder.AddBinding2(i, type, m_Stages, capacity, flags);
+        pbuilder.AddPoolSize(type, capacity);
+    }
+    if (empty)
+        return Result<BindlessHeap>::Error(
+            Error_BadInput, "[VULKIT][BINDLESS-HEAP] At least one resource type must have a non-zero capacity");
+
+    const auto lresult = lbuilder.Build();
+    TKIT_RETURN_ON_ERROR(lresult);
+    DescriptorSetLayout layout = *lresult;
+
+    const auto presult = pbuilder.Build();
+    TKIT_RETURN_ON_ERROR(presult, layout.Destroy());
+    DescriptorPool pool = *presult;
+
+    const auto sresult = pool.Allocate(layout);
+    const auto cleanup = [&pool, &layout] {
+        pool.Destroy();
+        layout.Destroy();
+    };
+    TKIT_RETURN_ON_ERROR(sresult, cleanup());
+
+    BindlessHeap::Info info{};
+    info.Capacities = m_Capacities;
+    info.Stages = m_Stages;
+
+    return Result<BindlessHeap>::Ok(m_Device, layout, pool, *sresult, info);
+}
+
+void BindlessHeap::Destroy()
+{
+    m_Pool.Destroy();
+    m_Layout.Destroy();
+    m_Set = DescriptorSet{};
+    for (Slots &slots : m_Slots)
+        slots = Slots{};
+}
+
+Result<u32> BindlessHeap::Allocate(const BindlessType type)
+{
+    Slots &slots = m_Slots[type];
+    if (!slots.Free.IsEmpty())
+    {
+        const u32 index = slots.Free.GetBack();
+        slots.Free.Pop();
+        slots.Live[index] = true;
+        return index;
+    }
+    if (slots.Next < m_Info.Capacities[type])
+    {
+        slots.Live.Append(true);
+        return slots.Next++;
+    }
+
+    return Result<u32>::Error(
+        Error_InsufficientMemory,
+        TKit::TierString::Format("[VULKIT][BINDLESS-HEAP] All {} '{}' slots are in use. Consider increasing the "
+                                 "capacity or reclaiming released slots more often",
+                                 m_Info.Capacities[type], ToString(type)));
+}
+
+void BindlessHeap::Release(const BindlessType type, const u32 index, const u64 timeline)
+{
+    Slots &slots = m_Slots[type];
+    TKIT_ASSERT(index < slots.Next, "[VULKIT][BINDLESS-HEAP] The '{}' slot {} was never allocated", ToString(type),
+                index);
+    TKIT_ASSERT(slots.Live[index], "[VULKIT][BINDLESS-HEAP] The '{}' slot {} has already been released",
+                ToString(type), index);
+    slots.Live[index] = false;
+    slots.Pending.Append(PendingRelease{index, timeline});
+}
+void BindlessHeap::Release(const BindlessType type, const u32 index, const Queue &queue)
+{
+    Release(type, index, queue.GetTimelineCounter());
+}
+
+void BindlessHeap::Reclaim(const u64 completedTimeline)
+{
+    for (Slots &slots : m_Slots)
+    {
+        u32 pending = 0;
+        for (const PendingRelease &release : slots.Pending)
+        {
+            if (release.Timeline <= completedTimeline)
+                slots.Free.Append(release.Index);
+            else
+                slots.Pending[pending++] = release;
+        }
+        slots.Pending.Resize(pending);
+    }
+}
+void BindlessHeap::Reclaim(const Queue &queue)
+{
+    Reclaim(queue.GetCompletedTimeline());
+}
+
+u32 BindlessHeap::GetAllocatedCount(const BindlessType type) const
+{
+    const Slots &slots = m_Slots[type];
+    return slots.Next - slots.Free.GetSize();
+}
+
+void BindlessHeap::write(const BindlessType type, const u32 index, const VkDescriptorImageInfo *imageInfo,
+                         const VkDescriptorBufferInfo *bufferInfo)
+{
+    TKIT_ASSERT(index < m_Info.Capacities[type], "[VULKIT][BINDLESS-HEAP] The '{}' slot {} exceeds the capacity of {}",
+                ToString(type), index, m_Info.Capacities[type]);
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = m_Set;
+    write.dstBinding = type;
+    write.dstArrayElement = index;
+    write.descriptorCount = 1;
+    write.descriptorType = getDescriptorType(type);
+    write.pImageInfo = imageInfo;
+    write.pBufferInfo = bufferInfo;
+
+    m_Device.Table->UpdateDescriptorSets(m_Device, 1, &write, 0, nullptr);
+}
+
+void BindlessHeap::WriteSampledImage(const u32 index, const VkImageView view, const VkImageLayout layout)
+{
+    VkDescriptorImageInfo info{};
+    info.imageView = view;
+    info.imageLayout = layout;
+    write(Bindless_SampledImage, index, &info, nullptr);
+}
+void BindlessHeap::WriteStorageImage(const u32 index, const VkImageView view, const VkImageLayout layout)
+{
+    VkDescriptorImageInfo info{};
+    info.imageView = view;
+    info.imageLayout = layout;
+    write(Bindless_StorageImage, index, &info, nullptr);
+}
+void BindlessHeap::WriteStorageBuffer(const u32 index, const VkDescriptorBufferInfo &info)
+{
+    write(Bindless_StorageBuffer, index, nullptr, &info);
+}
+void BindlessHeap::WriteSampler(const u32 index, const VkSampler sampler)
+{
+    VkDescriptorImageInfo info{};
+    info.sampler = sampler;
+    write(Bindless_Sampler, index, &info, nullptr);
+}
+
+void BindlessHeap::Bind(const VkCommandBuffer commandBuffer, const VkPipelineBindPoint bindPoint,
+                        const VkPipelineLayout layout, const u32 set) const
+{
+    const VkDescriptorSet handle = m_Set;
+    DescriptorSet::Bind(m_Device, commandBuffer, handle, bindPoint, layout, set);
+}
+
+BindlessHeap::Builder &BindlessHeap::Builder::SetCapacity(const BindlessType type, const u32 capacity)
+{
+    m_Capacities[type] = capacity;
+    return *this;
+}
+BindlessHeap::Builder &BindlessHeap::Builder::SetStages(const VkShaderStageFlags stages)
+{
+    m_Stages = stages;
+    return *this;
+}
+
+} // namespace VKit
+#endif
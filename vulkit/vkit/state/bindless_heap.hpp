@@ -0,0 +1,144 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_DESCRIPTORS
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_DESCRIPTORS"
+#endif
+
+#include "vkit/state/descriptor_pool.hpp"
+#include "vkit/execution/queue.hpp"
+#include "tkit/container/fixed_array.hpp"
+
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_EXT_descriptor_indexing)
+namespace VKit
+{
+enum BindlessType : u8
+{
+    Bindless_SampledImage,
+    Bindless_StorageImage,
+    Bindless_StorageBuffer,
+    Bindless_Sampler,
+    Bindless_Count
+};
+
+const char *ToString(BindlessType type);
+
+/**
+ * @brief A single, large descriptor set meant to be indexed from shaders.
+ *
+ * Each resource type lives in its own binding, whose number matches its `BindlessType` value. Bindings are created with
+ * the update-after-bind and partially-bound flags, so that descriptors can be written while the set is bound and unused
+ * slots may stay empty. Requires the `descriptorIndexing` features for the corresponding descriptor types.
+ *
+ * Slots are handed out as stable `u32` indices from per-type free-lists. Released slots are only reused once the
+ * timeline value they were released with has completed, so that in-flight work never sees a descriptor change under
+ * its feet.
+ *
+ */
+class BindlessHeap
+{
+  public:
+    class Builder
+    {
+      public:
+        Builder(const ProxyDevice &device) : m_Device(device)
+        {
+        }
+
+        VKIT_NO_DISCARD Result<BindlessHeap> Build() const;
+
+        // a capacity of zero disables the binding
+        Builder &SetCapacity(BindlessType type, u32 capacity);
+        Builder &SetStages(VkShaderStageFlags stages);
+
+      private:
+        ProxyDevice m_Device;
+        TKit::FixedArray<u32, Bindless_Count> m_Capacities{1024, 1024, 1024, 128};
+        VkShaderStageFlags m_Stages = VK_SHADER_STAGE_ALL;
+    };
+
+    struct Info
+    {
+        TKit::FixedArray<u32, Bindless_Count> Capacities;
+        VkShaderStageFlags Stages;
+    };
+
+    BindlessHeap() = default;
+    BindlessHeap(const ProxyDevice &device, const DescriptorSetLayout &layout, const DescriptorPool &pool,
+                 const DescriptorSet &set, const Info &info)
+        : m_Device(device), m_Layout(layout), m_Pool(pool), m_Set(set), m_Info(info)
+    {
+    }
+
+    void Destroy();
+
+    VKIT_NO_DISCARD Result<u32> Allocate(BindlessType type);
+
+    // the slot will only become available again once `timeline` completes. a slot may only be released once per
+    // allocation
+    void Release(BindlessType type, u32 index, u64 timeline);
+    void Release(BindlessType type, u32 index, const Queue &queue);
+
+    // makes available every released slot whose timeline value is less or equal than `completedTimeline`
+    void Reclaim(u64 completedTimeline);
+    void Reclaim(const Queue &queue);
+
+    void WriteSampledImage(u32 index, VkImageView view, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    void WriteStorageImage(u32 index, VkImageView view, VkImageLayout layout = VK_IMAGE_LAYOUT_GENERAL);
+    void WriteStorageBuffer(u32 index, const VkDescriptorBufferInfo &info);
+    void WriteSampler(u32 index, VkSampler sampler);
+
+    void Bind(VkCommandBuffer commandBuffer, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+              u32 set = 0) const;
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    const DescriptorSetLayout &GetLayout() const
+    {
+        return m_Layout;
+    }
+    const DescriptorSet &GetSet() const
+    {
+        return m_Set;
+    }
+    const Info &GetInfo() const
+    {
+        return m_Info;
+    }
+
+    u32 GetAllocatedCount(BindlessType type) const;
+
+    operator bool() const
+    {
+        return m_Set.GetHandle() != VK_NULL_HANDLE;
+    }
+
+  private:
+    struct PendingRelease
+    {
+        u32 Index;
+        u64 Timeline;
+    };
+    struct Slots
+    {
+        TKit::TierArray<u32> Free{};
+        TKit::TierArray<PendingRelease> Pending{};
+        // whether each slot below `Next` is currently handed out, to catch releasing a slot twice
+        TKit::TierArray<bool> Live{};
+        u32 Next = 0;
+    };
+
+    void write(BindlessType type, u32 index, const VkDescriptorImageInfo *imageInfo,
+               const VkDescriptorBufferInfo *bufferInfo);
+
+    ProxyDevice m_Device{};
+    DescriptorSetLayout m_Layout{};
+    DescriptorPool m_Pool{};
+    DescriptorSet m_Set{};
+    TKit::FixedArray<Slots, Bindless_Count> m_Slots{};
+    Info m_Info;
+};
+} // namespace VKit
+#endif
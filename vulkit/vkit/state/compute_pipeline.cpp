@@ -1,5 +1,6 @@
 #include "vkit/core/pch.hpp"
 #include "vkit/state/compute_pipeline.hpp"
+#include "vkit/state/pipeline_stats.hpp"
 #include "tkit/container/stack_array.hpp"
 
 namespace VKit
@@ -21,26 +22,56 @@ static VkComputePipelineCreateInfo createPipelineInfo(const ComputePipelineSpecs
     return pipelineInfo;
 }
 
+// feedback is only chained when the device can report it, as the structure is unknown to it otherwise
+static bool usesStats(const ComputePipelineSpecs &specs)
+{
+    return specs.Stats && specs.Stats->IsSupported();
+}
+
+static void recordStats(const ComputePipelineSpecs &specs, const PipelineStats::Feedback &feedback)
+{
+    const VkShaderStageFlagBits stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    specs.Stats->Record(specs.Name, feedback, TKit::Span<const VkShaderStageFlagBits>{&stage, 1});
+}
+
 Result<ComputePipeline> ComputePipeline::Create(const ProxyDevice &device, const ComputePipelineSpecs &specs)
 {
-    const VkComputePipelineCreateInfo pipelineInfo = createPipelineInfo(specs);
+    VkComputePipelineCreateInfo pipelineInfo = createPipelineInfo(specs);
+
+    const bool stats = usesStats(specs);
+    PipelineStats::Feedback feedback{stats ? 1U : 0U};
+    if (stats)
+        pipelineInfo.pNext = feedback.Chain(pipelineInfo.pNext);
 
     VkPipeline pipeline;
     VKIT_RETURN_IF_FAILED(device.Table->CreateComputePipelines(device, specs.Cache, 1, &pipelineInfo,
                                                                device.AllocationCallbacks, &pipeline),
                           Result<ComputePipeline>);
 
+    if (stats)
+        recordStats(specs, feedback);
     return Result<ComputePipeline>::Ok(device, pipeline);
 }
 Result<> ComputePipeline::Create(const ProxyDevice &device, const TKit::Span<const ComputePipelineSpecs> specs,
                                  const TKit::Span<ComputePipeline> pipelines, const VkPipelineCache cache)
 {
+    const u32 count = specs.GetSize();
+
+    // reserved up front, as the create infos point into the feedback storage
+    TKit::TierArray<PipelineStats::Feedback> feedbacks{};
+    feedbacks.Reserve(count);
+
     TKit::StackArray<VkComputePipelineCreateInfo> pipelineInfos{};
-    pipelineInfos.Reserve(specs.GetSize());
+    pipelineInfos.Reserve(count);
     for (const ComputePipelineSpecs &spc : specs)
-        pipelineInfos.Append(createPipelineInfo(spc));
+    {
+        VkComputePipelineCreateInfo &info = pipelineInfos.Append(createPipelineInfo(spc));
+        const bool stats = usesStats(spc);
+        PipelineStats::Feedback &feedback = feedbacks.Append(stats ? 1U : 0U);
+        if (stats)
+            info.pNext = feedback.Chain(info.pNext);
+    }
 
-    const u32 count = specs.GetSize();
     TKit::StackArray<VkPipeline> vkpipelines{count};
 
     VKIT_RETURN_IF_FAILED(device.Table->CreateComputePipelines(device, cache, count, pipelineInfos.GetData(),
@@ -48,7 +79,11 @@ Result<> ComputePipeline::Create(const ProxyDevice &device, const TKit::Span<con
                           Result<>);
 
     for (u32 i = 0; i < count; ++i)
+    {
+        if (usesStats(specs[i]))
+            recordStats(specs[i], feedbacks[i]);
         pipelines[i] = ComputePipeline(device, vkpipelines[i]);
+    }
     return Result<>::Ok();
 }
 
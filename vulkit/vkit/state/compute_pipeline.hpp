@@ -10,12 +10,17 @@
 
 namespace VKit
 {
+class PipelineStats;
+
 struct ComputePipelineSpecs
 {
     VkPipelineLayout Layout = VK_NULL_HANDLE;
     VkShaderModule ComputeShader = VK_NULL_HANDLE;
     VkPipelineCache Cache = VK_NULL_HANDLE;
     const char *EntryPoint = "main";
+    // if set and supported by the device, creation feedback is chained and recorded into it under `Name`
+    PipelineStats *Stats = nullptr;
+    const char *Name = nullptr;
 };
 
 class ComputePipeline
@@ -0,0 +1,177 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/descriptor_allocator.hpp"
+
+namespace VKit
+{
+static Result<DescriptorPool> createPool(const ProxyDevice &device, const DescriptorAllocator::Info &info,
+                                         const u32 sets)
+{
+    DescriptorPool::Builder builder{device};
+    builder.SetMaxSets(sets).SetFlags(info.Flags);
+    for (const DescriptorAllocator::PoolSizeRatio &ratio : info.Ratios)
+        builder.AddPoolSize(ratio.Type, std::max(1u, static_cast<u32>(ratio.Ratio * static_cast<f32>(sets))));
+
+    return builder.Build();
+}
+
+static bool isPoolExhausted(const Error &error)
+{
+    const VkResult result = error.GetVulkanResult();
+    return result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL;
+}
+
+Result<DescriptorAllocator> DescriptorAllocator::Builder::Build() const
+{
+    if (m_Ratios.IsEmpty())
+        return Result<DescriptorAllocator>::Error(Error_BadInput,
+                                                  "[VULKIT][DESCRIPTOR-ALLOCATOR] At least one pool size ratio is needed");
+    if (m_SetsPerPool == 0 || m_SetsPerPool > m_MaxSetsPerPool)
+        return Result<DescriptorAllocator>::Error(
+            Error_BadInput,
+            "[VULKIT][DESCRIPTOR-ALLOCATOR] Sets per pool must be greater than zero and not exceed the maximum");
+    if (m_GrowthFactor < 1.f)
+        return Result<DescriptorAllocator>::Error(
+            Error_BadInput, "[VULKIT][DESCRIPTOR-ALLOCATOR] The growth factor must be greater or equal than 1");
+
+    DescriptorAllocator::Info info{};
+    info.SetsPerPool = m_SetsPerPool;
+    info.MaxSetsPerPool = m_MaxSetsPerPool;
+    info.GrowthFactor = m_GrowthFactor;
+    info.Flags = m_Flags;
+    info.Ratios = m_Ratios;
+
+    const auto result = createPool(m_Device, info, m_SetsPerPool);
+    TKIT_RETURN_ON_ERROR(result);
+
+    return Result<DescriptorAllocator>::Ok(m_Device, *result, info);
+}
+
+void DescriptorAllocator::Destroy()
+{
+    for (DescriptorPool &pool : m_Pools)
+        pool.Destroy();
+    m_Pools.Clear();
+    m_Current = 0;
+    m_CurrentUsed = false;
+}
+
+u32 DescriptorAllocator::getNextPoolSize() const
+{
+    if (m_Current + 1 < m_Pools.GetSize())
+        return m_Pools[m_Current + 1].GetInfo().MaxSets;
+
+    // truncating the product would never grow small pools, so every new pool holds at least one more set
+    const u32 sets = m_NextSetsPerPool;
+    if (m_Info.GrowthFactor > 1.f)
+        return std::min(m_Info.MaxSetsPerPool,
+                        std::max(sets + 1, static_cast<u32>(static_cast<f32>(sets) * m_Info.GrowthFactor)));
+    return sets;
+}
+
+Result<> DescriptorAllocator::advance()
+{
+    if (m_Current + 1 < m_Pools.GetSize())
+    {
+        ++m_Current;
+        m_CurrentUsed = false;
+        return Result<>::Ok();
+    }
+
+    const u32 sets = getNextPoolSize();
+    const auto result = createPool(m_Device, m_Info, sets);
+    TKIT_RETURN_ON_ERROR(result);
+
+    m_Pools.Append(*result);
+    m_NextSetsPerPool = sets;
+    ++m_Current;
+    m_CurrentUsed = false;
+    return Result<>::Ok();
+}
+
+Result<DescriptorSet> DescriptorAllocator::Allocate(const VkDescriptorSetLayout layout)
+{
+    VkDescriptorSet set;
+    TKIT_RETURN_IF_FAILED(Allocate(layout, set));
+    return DescriptorSet{m_Device, set};
+}
+
+Result<> DescriptorAllocator::Allocate(const TKit::Span<const VkDescriptorSetLayout> layouts,
+                                       const TKit::Span<VkDescriptorSet> sets)
+{
+    TKIT_ASSERT(!m_Pools.IsEmpty(), "[VULKIT][DESCRIPTOR-ALLOCATOR] The allocator has been destroyed");
+    if (layouts.GetSize() > m_Info.MaxSetsPerPool)
+        return Result<>::Error(
+            Error_BadInput,
+            TKit::TierString::Format(
+                "[VULKIT][DESCRIPTOR-ALLOCATOR] A batch of {} sets does not fit in a pool of at most {} sets",
+                layouts.GetSize(), m_Info.MaxSetsPerPool));
+    for (;;)
+    {
+        const auto result = m_Pools[m_Current].Allocate(layouts, sets);
+        if (result)
+        {
+            m_CurrentUsed = true;
+            return result;
+        }
+        if (!isPoolExhausted(result.GetError()))
+            return result;
+
+        // an untouched pool that cannot hold the request will only be followed by pools that cannot either unless the
+        // next one is larger (with a growth factor of 1, or once pools reach the maximum size, it never is). moving
+        // past it would leave it, and every pool created after it, unused
+        if (!m_CurrentUsed && getNextPoolSize() <= m_Pools[m_Current].GetInfo().MaxSets)
+            return result;
+
+        TKIT_RETURN_IF_FAILED(advance());
+    }
+}
+
+Result<> DescriptorAllocator::Reset(const VkDescriptorPoolResetFlags flags)
+{
+    for (u32 i = 0; i <= m_Current && i < m_Pools.GetSize(); ++i)
+    {
+        TKIT_RETURN_IF_FAILED(m_Pools[i].Reset(flags));
+    }
+    m_Current = 0;
+    m_CurrentUsed = false;
+    return Result<>::Ok();
+}
+
+DescriptorAllocator::Builder &DescriptorAllocator::Builder::SetSetsPerPool(const u32 sets)
+{
+    m_SetsPerPool = sets;
+    return *this;
+}
+DescriptorAllocator::Builder &DescriptorAllocator::Builder::SetMaxSetsPerPool(const u32 sets)
+{
+    m_MaxSetsPerPool = sets;
+    return *this;
+}
+DescriptorAllocator::Builder &DescriptorAllocator::Builder::SetGrowthFactor(const f32 factor)
+{
+    m_GrowthFactor = factor;
+    return *this;
+}
+DescriptorAllocator::Builder &DescriptorAllocator::Builder::SetFlags(const VkDescriptorPoolCreateFlags flags)
+{
+    m_Flags = flags;
+    return *this;
+}
+DescriptorAllocator::Builder &DescriptorAllocator::Builder::AddFlags(const VkDescriptorPoolCreateFlags flags)
+{
+    m_Flags |= flags;
+    return *this;
+}
+DescriptorAllocator::Builder &DescriptorAllocator::Builder::RemoveFlags(const VkDescriptorPoolCreateFlags flags)
+{
+    m_Flags &= ~flags;
+    return *this;
+}
+DescriptorAllocator::Builder &DescriptorAllocator::Builder::AddPoolSizeRatio(const VkDescriptorType type,
+                                                                             const f32 ratio)
+{
+    m_Ratios.Append(PoolSizeRatio{type, ratio});
+    return *this;
+}
+
+} // namespace VKit
@@ -0,0 +1,125 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_DESCRIPTORS
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_DESCRIPTORS"
+#endif
+
+#include "vkit/state/descriptor_pool.hpp"
+
+namespace VKit
+{
+/**
+ * @brief A growable list of descriptor pools that share the same pool size ratios.
+ *
+ * When the current pool runs out of memory or gets fragmented, the allocator moves to the next one, creating it if
+ * needed. Resetting the allocator resets every pool and makes all of them available again, so that pools are recycled
+ * instead of destroyed. Pools grow by `GrowthFactor` every time a new one is created, up to `MaxSetsPerPool`.
+ *
+ */
+class DescriptorAllocator
+{
+  public:
+    struct PoolSizeRatio
+    {
+        VkDescriptorType Type;
+        f32 Ratio;
+    };
+
+    class Builder
+    {
+      public:
+        Builder(const ProxyDevice &device) : m_Device(device)
+        {
+        }
+
+        VKIT_NO_DISCARD Result<DescriptorAllocator> Build() const;
+
+        Builder &SetSetsPerPool(u32 sets);
+        Builder &SetMaxSetsPerPool(u32 sets);
+        Builder &SetGrowthFactor(f32 factor);
+
+        Builder &SetFlags(VkDescriptorPoolCreateFlags flags);
+        Builder &AddFlags(VkDescriptorPoolCreateFlags flags);
+        Builder &RemoveFlags(VkDescriptorPoolCreateFlags flags);
+
+        // amount of descriptors of the given type per set
+        Builder &AddPoolSizeRatio(VkDescriptorType type, f32 ratio);
+
+      private:
+        ProxyDevice m_Device;
+
+        u32 m_SetsPerPool = 64;
+        u32 m_MaxSetsPerPool = 4096;
+        f32 m_GrowthFactor = 1.5f;
+        VkDescriptorPoolCreateFlags m_Flags = 0;
+        TKit::TierArray<PoolSizeRatio> m_Ratios{};
+    };
+
+    struct Info
+    {
+        u32 SetsPerPool;
+        u32 MaxSetsPerPool;
+        f32 GrowthFactor;
+        VkDescriptorPoolCreateFlags Flags;
+        TKit::TierArray<PoolSizeRatio> Ratios;
+    };
+
+    DescriptorAllocator() = default;
+    DescriptorAllocator(const ProxyDevice &device, const DescriptorPool &pool, const Info &info)
+        : m_Device(device), m_NextSetsPerPool(info.SetsPerPool), m_Info(info)
+    {
+        m_Pools.Append(pool);
+    }
+
+    void Destroy();
+
+    VKIT_NO_DISCARD Result<DescriptorSet> Allocate(VkDescriptorSetLayout layout);
+
+    /**
+     * @brief Allocate multiple descriptor sets with a single call to `vkAllocateDescriptorSets`.
+     *
+     * All sets are allocated from the same pool. If that pool cannot hold them, the whole batch is retried in the next
+     * one. Batches larger than `MaxSetsPerPool` are rejected, and so is any request that a fresh pool cannot hold when
+     * the pool following it would be no larger (as with a growth factor of 1).
+     *
+     * @param layouts The layouts of the sets to allocate.
+     * @param sets The output sets. Must have the same size as `layouts`.
+     */
+    VKIT_NO_DISCARD Result<> Allocate(TKit::Span<const VkDescriptorSetLayout> layouts,
+                                      TKit::Span<VkDescriptorSet> sets);
+
+    // resets every pool that has been used since the last reset. typically called once per frame, when the sets
+    // allocated during that frame are no longer in use by the device
+    VKIT_NO_DISCARD Result<> Reset(VkDescriptorPoolResetFlags flags = 0);
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    const Info &GetInfo() const
+    {
+        return m_Info;
+    }
+    u32 GetPoolCount() const
+    {
+        return m_Pools.GetSize();
+    }
+    operator bool() const
+    {
+        return !m_Pools.IsEmpty();
+    }
+
+  private:
+    u32 getNextPoolSize() const;
+    VKIT_NO_DISCARD Result<> advance();
+
+    ProxyDevice m_Device{};
+    TKit::TierArray<DescriptorPool> m_Pools{};
+    u32 m_Current = 0;
+    // whether a set has been allocated from the current pool since it became current
+    bool m_CurrentUsed = false;
+    u32 m_NextSetsPerPool = 0;
+    Info m_Info;
+};
+} // namespace VKit
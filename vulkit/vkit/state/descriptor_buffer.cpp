@@ -0,0 +1,289 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/descriptor_buffer.hpp"
+
+#ifdef VK_EXT_descriptor_buffer
+namespace VKit
+{
+static VkDeviceSize alignUp(const VkDeviceSize value, const VkDeviceSize alignment)
+{
+    return alignment == 0 ? value : (value + alignment - 1) & ~(alignment - 1);
+}
+
+bool DescriptorBuffer::IsSupported(const PhysicalDevice &device)
+{
+    return device.IsExtensionEnabled(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+}
+
+Result<DescriptorBuffer> DescriptorBuffer::Builder::Build() const
+{
+    const PhysicalDevice *physicalDevice = m_Device->GetInfo().PhysicalDevice;
+    if (!IsSupported(*physicalDevice))
+        return Result<DescriptorBuffer>::Error(Error_MissingExtension,
+                                               "[VULKIT][DESCRIPTOR-BUFFER] The 'VK_EXT_descriptor_buffer' extension "
+                                               "must be enabled to use descriptor buffers");
+    if (!(m_Flags & (DescriptorBufferFlag_Resources | DescriptorBufferFlag_Samplers)))
+        return Result<DescriptorBuffer>::Error(Error_BadInput, "[VULKIT][DESCRIPTOR-BUFFER] The descriptor buffer "
+                                                               "must hold resources, samplers or both");
+
+    const Vulkan::InstanceTable *itable = m_Device->GetInfo().Instance->GetInfo().Table;
+
+    DescriptorBuffer::Info info{};
+    info.Flags = m_Flags;
+    info.Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+
+    VkPhysicalDeviceProperties2KHR properties{};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+    properties.pNext = &info.Properties;
+#ifdef VKIT_API_VERSION_1_1
+    if (itable->vkGetPhysicalDeviceProperties2)
+        itable->GetPhysicalDeviceProperties2(physicalDevice->GetHandle(), &properties);
+    else
+#endif
+        itable->GetPhysicalDeviceProperties2KHR(physicalDevice->GetHandle(), &properties);
+    info.Properties.pNext = nullptr;
+    info.RobustBufferAccess = physicalDevice->GetInfo().EnabledFeatures.Core.robustBufferAccess == VK_TRUE;
+
+    info.Usage = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    if (m_Flags & DescriptorBufferFlag_Resources)
+        info.Usage |= VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT;
+    if (m_Flags & DescriptorBufferFlag_Samplers)
+        info.Usage |= VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+
+    const ProxyDevice proxy = m_Device->CreateProxy();
+    const auto result = DeviceBuffer::Builder{proxy, m_Allocator, DeviceBufferFlag_HostMapped}
+                            .SetSize(m_Size)
+                            .SetUsage(info.Usage)
+                            .Build();
+    TKIT_RETURN_ON_ERROR(result);
+
+    const DeviceBuffer &buffer = *result;
+    return Result<DescriptorBuffer>::Ok(proxy, buffer, buffer.GetDeviceAddress(), info);
+}
+
+void DescriptorBuffer::Destroy()
+{
+    m_Buffer.Destroy();
+    m_Address = 0;
+    m_Offset = 0;
+}
+
+Result<VkDeviceSize> DescriptorBuffer::Allocate(const DescriptorSetLayout &layout)
+{
+    const VkDeviceSize offset = alignUp(m_Offset, m_Info.Properties.descriptorBufferOffsetAlignment);
+    const VkDeviceSize size = layout.GetDescriptorBufferSize();
+    if (offset + size > m_Buffer.GetInfo().Size)
+        return Result<VkDeviceSize>::Error(
+            Error_InsufficientMemory,
+            TKit::TierString::Format("[VULKIT][DESCRIPTOR-BUFFER] Not enough space for a set of {} bytes. The buffer "
+                                     "holds {} bytes and {} are already in use",
+                                     size, m_Buffer.GetInfo().Size, m_Offset));
+
+    m_Offset = offset + size;
+    return offset;
+}
+
+void DescriptorBuffer::Reset()
+{
+    m_Offset = 0;
+}
+
+usize DescriptorBuffer::GetDescriptorSize(const VkDescriptorType type) const
+{
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT &props = m_Info.Properties;
+    // robust buffer descriptors may be larger, as they also store the range that accesses are clamped to
+    const bool robust = m_Info.RobustBufferAccess;
+    switch (type)
+    {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+        return props.samplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return props.combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        return props.sampledImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return props.storageImageDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        return robust ? props.robustUniformTexelBufferDescriptorSize : props.uniformTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return robust ? props.robustStorageTexelBufferDescriptorSize : props.storageTexelBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return robust ? props.robustUniformBufferDescriptorSize : props.uniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return robust ? props.robustStorageBufferDescriptorSize : props.storageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        return props.inputAttachmentDescriptorSize;
+    default:
+        TKIT_FATAL("[VULKIT][DESCRIPTOR-BUFFER] The descriptor type is not supported by descriptor buffers");
+        return 0;
+    }
+}
+
+void DescriptorBuffer::Write(const VkDeviceSize setOffset, const DescriptorSetLayout &layout, const u32 binding,
+                             const VkDescriptorGetInfoEXT &info, const u32 element)
+{
+    const usize size = GetDescriptorSize(info.type);
+    const VkDeviceSize offset = setOffset + layout.GetDescriptorBufferOffset(binding) + element * size;
+    TKIT_ASSERT(offset + size <= m_Buffer.GetInfo().Size,
+                "[VULKIT][DESCRIPTOR-BUFFER] Descriptor write at offset {} overflows the buffer", offset);
+
+    std::byte *data = static_cast<std::byte *>(m_Buffer.GetData());
+    m_Device.Table->GetDescriptorEXT(m_Device, &info, size, data + offset);
+}
+
+static void writeBuffer(DescriptorBuffer &buffer, const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                        const u32 binding, const VkDescriptorType type, const VkDeviceAddress address,
+                        const VkDeviceSize range, const u32 element)
+{
+    VkDescriptorAddressInfoEXT addressInfo{};
+    addressInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    addressInfo.address = address;
+    addressInfo.range = range;
+    addressInfo.format = VK_FORMAT_UNDEFINED;
+
+    VkDescriptorGetInfoEXT info{};
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    info.type = type;
+    if (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+        info.data.pUniformBuffer = &addressInfo;
+    else
+        info.data.pStorageBuffer = &addressInfo;
+
+    buffer.Write(setOffset, layout, binding, info, element);
+}
+
+static void writeImage(DescriptorBuffer &buffer, const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                       const u32 binding, const VkDescriptorType type, const VkSampler sampler,
+                       const VkImageView view, const VkImageLayout imageLayout, const u32 element)
+{
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = sampler;
+    imageInfo.imageView = view;
+    imageInfo.imageLayout = imageLayout;
+
+    VkDescriptorGetInfoEXT info{};
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    info.type = type;
+    switch (type)
+    {
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        info.data.pSampledImage = &imageInfo;
+        break;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        info.data.pStorageImage = &imageInfo;
+        break;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        info.data.pCombinedImageSampler = &imageInfo;
+        break;
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+        info.data.pSampler = &sampler;
+        break;
+    default:
+        TKIT_FATAL("[VULKIT][DESCRIPTOR-BUFFER] Unexpected image descriptor type");
+        return;
+    }
+
+    buffer.Write(setOffset, layout, binding, info, element);
+}
+
+void DescriptorBuffer::WriteUniformBuffer(const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                                          const u32 binding, const VkDeviceAddress address, const VkDeviceSize range,
+                                          const u32 element)
+{
+    writeBuffer(*this, setOffset, layout, binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, address, range, element);
+}
+void DescriptorBuffer::WriteStorageBuffer(const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                                          const u32 binding, const VkDeviceAddress address, const VkDeviceSize range,
+                                          const u32 element)
+{
+    writeBuffer(*this, setOffset, layout, binding, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, address, range, element);
+}
+
+void DescriptorBuffer::WriteSampledImage(const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                                         const u32 binding, const VkImageView view, const VkImageLayout imageLayout,
+                                         const u32 element)
+{
+    writeImage(*this, setOffset, layout, binding, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, VK_NULL_HANDLE, view, imageLayout,
+               element);
+}
+void DescriptorBuffer::WriteStorageImage(const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                                         const u32 binding, const VkImageView view, const VkImageLayout imageLayout,
+                                         const u32 element)
+{
+    writeImage(*this, setOffset, layout, binding, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_NULL_HANDLE, view, imageLayout,
+               element);
+}
+void DescriptorBuffer::WriteCombinedImageSampler(const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                                                 const u32 binding, const VkSampler sampler, const VkImageView view,
+                                                 const VkImageLayout imageLayout, const u32 element)
+{
+    writeImage(*this, setOffset, layout, binding, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, sampler, view,
+               imageLayout, element);
+}
+void DescriptorBuffer::WriteSampler(const VkDeviceSize setOffset, const DescriptorSetLayout &layout,
+                                    const u32 binding, const VkSampler sampler, const u32 element)
+{
+    writeImage(*this, setOffset, layout, binding, VK_DESCRIPTOR_TYPE_SAMPLER, sampler, VK_NULL_HANDLE,
+               VK_IMAGE_LAYOUT_UNDEFINED, element);
+}
+
+VkDescriptorBufferBindingInfoEXT DescriptorBuffer::CreateBindingInfo() const
+{
+    VkDescriptorBufferBindingInfoEXT info{};
+    info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+    info.address = m_Address;
+    info.usage = m_Info.Usage;
+    return info;
+}
+
+void DescriptorBuffer::Bind(const VkCommandBuffer commandBuffer) const
+{
+    const VkDescriptorBufferBindingInfoEXT info = CreateBindingInfo();
+    Bind(m_Device, commandBuffer, info);
+}
+void DescriptorBuffer::Bind(const ProxyDevice &device, const VkCommandBuffer commandBuffer,
+                            const TKit::Span<const VkDescriptorBufferBindingInfoEXT> buffers)
+{
+    device.Table->CmdBindDescriptorBuffersEXT(commandBuffer, buffers.GetSize(), buffers.GetData());
+}
+
+void DescriptorBuffer::SetOffset(const VkCommandBuffer commandBuffer, const VkPipelineBindPoint bindPoint,
+                                 const VkPipelineLayout layout, const u32 set, const VkDeviceSize setOffset,
+                                 const u32 bufferIndex) const
+{
+    SetOffsets(m_Device, commandBuffer, bindPoint, layout, set, bufferIndex, setOffset);
+}
+void DescriptorBuffer::SetOffsets(const ProxyDevice &device, const VkCommandBuffer commandBuffer,
+                                  const VkPipelineBindPoint bindPoint, const VkPipelineLayout layout,
+                                  const u32 firstSet, const TKit::Span<const u32> bufferIndices,
+                                  const TKit::Span<const VkDeviceSize> offsets)
+{
+    TKIT_ASSERT(bufferIndices.GetSize() == offsets.GetSize(),
+                "[VULKIT][DESCRIPTOR-BUFFER] The amount of buffer indices ({}) must match the amount of offsets ({})",
+                bufferIndices.GetSize(), offsets.GetSize());
+    device.Table->CmdSetDescriptorBufferOffsetsEXT(commandBuffer, bindPoint, layout, firstSet, bufferIndices.GetSize(),
+                                                   bufferIndices.GetData(), offsets.GetData());
+}
+
+DescriptorBuffer::Builder &DescriptorBuffer::Builder::SetSize(const VkDeviceSize size)
+{
+    m_Size = size;
+    return *this;
+}
+DescriptorBuffer::Builder &DescriptorBuffer::Builder::SetFlags(const DescriptorBufferFlags flags)
+{
+    m_Flags = flags;
+    return *this;
+}
+DescriptorBuffer::Builder &DescriptorBuffer::Builder::AddFlags(const DescriptorBufferFlags flags)
+{
+    m_Flags |= flags;
+    return *this;
+}
+DescriptorBuffer::Builder &DescriptorBuffer::Builder::RemoveFlags(const DescriptorBufferFlags flags)
+{
+    m_Flags &= ~flags;
+    return *this;
+}
+
+} // namespace VKit
+#endif
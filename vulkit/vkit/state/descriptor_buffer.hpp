@@ -0,0 +1,150 @@
+#pragma once
+
+#if !defined(VKIT_ENABLE_DESCRIPTORS) || !defined(VKIT_ENABLE_DEVICE_BUFFER)
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding features must be enabled in CMake with VULKIT_ENABLE_DESCRIPTORS and VULKIT_ENABLE_DEVICE_BUFFER"
+#endif
+
+#include "vkit/state/descriptor_set_layout.hpp"
+#include "vkit/resource/device_buffer.hpp"
+#include "vkit/device/logical_device.hpp"
+
+#ifdef VK_EXT_descriptor_buffer
+namespace VKit
+{
+using DescriptorBufferFlags = u8;
+enum DescriptorBufferFlagBit : DescriptorBufferFlags
+{
+    DescriptorBufferFlag_Resources = 1U << 0,
+    DescriptorBufferFlag_Samplers = 1U << 1,
+};
+
+/**
+ * @brief A descriptor backend that stores descriptors directly in a host-mapped `DeviceBuffer` through
+ * `VK_EXT_descriptor_buffer`.
+ *
+ * Set layouts must be built with `VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT`, and the allocator must
+ * have been created with buffer device address support. Sets are sub-allocated linearly from the buffer and written
+ * with `vkGetDescriptorEXT`, so writes are plain copies into mapped memory that need no pool or lock.
+ *
+ */
+class DescriptorBuffer
+{
+  public:
+    class Builder
+    {
+      public:
+        Builder(const LogicalDevice *device, VmaAllocator allocator,
+                DescriptorBufferFlags flags = DescriptorBufferFlag_Resources)
+            : m_Device(device), m_Allocator(allocator), m_Flags(flags)
+        {
+        }
+
+        VKIT_NO_DISCARD Result<DescriptorBuffer> Build() const;
+
+        Builder &SetSize(VkDeviceSize size);
+
+        Builder &SetFlags(DescriptorBufferFlags flags);
+        Builder &AddFlags(DescriptorBufferFlags flags);
+        Builder &RemoveFlags(DescriptorBufferFlags flags);
+
+      private:
+        const LogicalDevice *m_Device;
+        VmaAllocator m_Allocator;
+        VkDeviceSize m_Size = 64_kib;
+        DescriptorBufferFlags m_Flags;
+    };
+
+    struct Info
+    {
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT Properties;
+        VkBufferUsageFlags Usage;
+        DescriptorBufferFlags Flags;
+        // selects the robust buffer descriptor sizes
+        bool RobustBufferAccess;
+    };
+
+    // whether the descriptor buffer extension was enabled when selecting the physical device
+    static bool IsSupported(const PhysicalDevice &device);
+
+    DescriptorBuffer() = default;
+    DescriptorBuffer(const ProxyDevice &device, const DeviceBuffer &buffer, const VkDeviceAddress address,
+                     const Info &info)
+        : m_Device(device), m_Buffer(buffer), m_Address(address), m_Info(info)
+    {
+    }
+
+    void Destroy();
+
+    // returns the offset of the new set inside the buffer, to be used with Write*() and SetOffsets()
+    VKIT_NO_DISCARD Result<VkDeviceSize> Allocate(const DescriptorSetLayout &layout);
+    void Reset();
+
+    void Write(VkDeviceSize setOffset, const DescriptorSetLayout &layout, u32 binding,
+               const VkDescriptorGetInfoEXT &info, u32 element = 0);
+
+    void WriteUniformBuffer(VkDeviceSize setOffset, const DescriptorSetLayout &layout, u32 binding,
+                            VkDeviceAddress address, VkDeviceSize range, u32 element = 0);
+    void WriteStorageBuffer(VkDeviceSize setOffset, const DescriptorSetLayout &layout, u32 binding,
+                            VkDeviceAddress address, VkDeviceSize range, u32 element = 0);
+
+    void WriteSampledImage(VkDeviceSize setOffset, const DescriptorSetLayout &layout, u32 binding, VkImageView view,
+                           VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, u32 element = 0);
+    void WriteStorageImage(VkDeviceSize setOffset, const DescriptorSetLayout &layout, u32 binding, VkImageView view,
+                           VkImageLayout imageLayout = VK_IMAGE_LAYOUT_GENERAL, u32 element = 0);
+    void WriteCombinedImageSampler(VkDeviceSize setOffset, const DescriptorSetLayout &layout, u32 binding,
+                                   VkSampler sampler, VkImageView view,
+                                   VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                   u32 element = 0);
+    void WriteSampler(VkDeviceSize setOffset, const DescriptorSetLayout &layout, u32 binding, VkSampler sampler,
+                      u32 element = 0);
+
+    VkDescriptorBufferBindingInfoEXT CreateBindingInfo() const;
+
+    void Bind(VkCommandBuffer commandBuffer) const;
+    static void Bind(const ProxyDevice &device, VkCommandBuffer commandBuffer,
+                     TKit::Span<const VkDescriptorBufferBindingInfoEXT> buffers);
+
+    // bufferIndex refers to the position of this buffer in the last Bind() call
+    void SetOffset(VkCommandBuffer commandBuffer, VkPipelineBindPoint bindPoint, VkPipelineLayout layout, u32 set,
+                   VkDeviceSize setOffset, u32 bufferIndex = 0) const;
+    static void SetOffsets(const ProxyDevice &device, VkCommandBuffer commandBuffer, VkPipelineBindPoint bindPoint,
+                           VkPipelineLayout layout, u32 firstSet, TKit::Span<const u32> bufferIndices,
+                           TKit::Span<const VkDeviceSize> offsets);
+
+    usize GetDescriptorSize(VkDescriptorType type) const;
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    const DeviceBuffer &GetBuffer() const
+    {
+        return m_Buffer;
+    }
+    VkDeviceAddress GetDeviceAddress() const
+    {
+        return m_Address;
+    }
+    VkDeviceSize GetUsedSize() const
+    {
+        return m_Offset;
+    }
+    const Info &GetInfo() const
+    {
+        return m_Info;
+    }
+    operator bool() const
+    {
+        return m_Buffer.GetHandle() != VK_NULL_HANDLE;
+    }
+
+  private:
+    ProxyDevice m_Device{};
+    DeviceBuffer m_Buffer{};
+    VkDeviceAddress m_Address = 0;
+    VkDeviceSize m_Offset = 0;
+    Info m_Info;
+};
+} // namespace VKit
+#endif
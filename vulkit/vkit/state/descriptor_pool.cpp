@@ -46,6 +46,22 @@ Result<DescriptorSet> DescriptorPool::Allocate(const VkDescriptorSetLayout layou
     VKIT_RETURN_IF_FAILED(m_Device.Table->AllocateDescriptorSets(m_Device, &allocInfo, &set), Result<DescriptorSet>);
     return DescriptorSet{m_Device, set};
 }
+Result<> DescriptorPool::Allocate(const TKit::Span<const VkDescriptorSetLayout> layouts,
+                                  const TKit::Span<VkDescriptorSet> sets) const
+{
+    TKIT_ASSERT(layouts.GetSize() == sets.GetSize(),
+                "[VULKIT][DESCRIPTOR-POOL] The amount of layouts ({}) must match the amount of sets ({})",
+                layouts.GetSize(), sets.GetSize());
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = m_Pool;
+    allocInfo.descriptorSetCount = layouts.GetSize();
+    allocInfo.pSetLayouts = layouts.GetData();
+
+    VKIT_RETURN_IF_FAILED(m_Device.Table->AllocateDescriptorSets(m_Device, &allocInfo, sets.GetData()), Result<>);
+    return Result<>::Ok();
+}
 
 Result<> DescriptorPool::Deallocate(const TKit::Span<const VkDescriptorSet> sets) const
 {
@@ -60,6 +60,8 @@ class DescriptorPool
     }
 
     VKIT_NO_DISCARD Result<DescriptorSet> Allocate(VkDescriptorSetLayout layout) const;
+    VKIT_NO_DISCARD Result<> Allocate(TKit::Span<const VkDescriptorSetLayout> layouts,
+                                      TKit::Span<VkDescriptorSet> sets) const;
     VKIT_NO_DISCARD Result<> Deallocate(TKit::Span<const VkDescriptorSet> sets) const;
     VKIT_NO_DISCARD Result<> Reset(VkDescriptorPoolResetFlags flags = 0);
 
@@ -1,5 +1,6 @@
 #include "vkit/core/pch.hpp"
 #include "vkit/state/descriptor_set.hpp"
+#include <cstring>
 
 namespace VKit
 {
@@ -54,5 +55,105 @@ void DescriptorSet::Writer::Overwrite(const VkDescriptorSet set)
         write.dstSet = set;
     m_Device.Table->UpdateDescriptorSets(m_Device, m_Writes.GetSize(), m_Writes.GetData(), 0, nullptr);
 }
+#ifdef VK_KHR_push_descriptor
+void DescriptorSet::Writer::Push(const VkCommandBuffer commandBuffer, const VkPipelineBindPoint bindPoint,
+                                 const VkPipelineLayout layout, const u32 set) const
+{
+    TKIT_ASSERT(m_Layout->IsPushDescriptor(),
+                "[VULKIT][DESCRIPTOR-SET] The layout must be created with the push descriptor flag to push descriptors");
+#    ifdef VKIT_API_VERSION_1_4
+    if (m_Device.Table->vkCmdPushDescriptorSet)
+    {
+        m_Device.Table->CmdPushDescriptorSet(commandBuffer, bindPoint, layout, set, m_Writes.GetSize(),
+                                             m_Writes.GetData());
+        return;
+    }
+#    endif
+    m_Device.Table->CmdPushDescriptorSetKHR(commandBuffer, bindPoint, layout, set, m_Writes.GetSize(),
+                                            m_Writes.GetData());
+}
+#endif
+
+#ifdef VK_KHR_descriptor_update_template
+DescriptorSet::TemplateWriter::TemplateWriter(const ProxyDevice &device, const DescriptorSetLayout *layout)
+    : m_Device(device), m_Layout(layout)
+{
+    TKIT_ASSERT(!layout->GetTemplateInfo().Entries.IsEmpty(),
+                "[VULKIT][DESCRIPTOR-SET] The layout must have been built with an update template to use a template "
+                "writer");
+    m_Data.Resize(layout->GetTemplateInfo().Size, std::byte{0});
+}
+
+void DescriptorSet::TemplateWriter::write(const u32 binding, const void *data, const usize size, const u32 count,
+                                          const u32 dstElement)
+{
+    const auto &entries = m_Layout->GetTemplateInfo().Entries;
+    TKIT_ASSERT(binding < entries.GetSize() && entries[binding].descriptorCount != 0,
+                "[VULKIT][DESCRIPTOR-SET] Binding {} is not present in the layout", binding);
+
+    const VkDescriptorUpdateTemplateEntryKHR &entry = entries[binding];
+    TKIT_ASSERT(entry.stride == size, "[VULKIT][DESCRIPTOR-SET] The descriptor info written to binding {} does not "
+                                      "match its descriptor type",
+                binding);
+    TKIT_ASSERT(dstElement + count <= entry.descriptorCount,
+                "[VULKIT][DESCRIPTOR-SET] Writing {} descriptors starting at element {} overflows binding {}, which "
+                "only holds {}",
+                count, dstElement, binding, entry.descriptorCount);
+
+    std::memcpy(m_Data.GetData() + entry.offset + dstElement * entry.stride, data, count * size);
+}
+
+void DescriptorSet::TemplateWriter::WriteBuffer(const u32 binding,
+                                                const TKit::Span<const VkDescriptorBufferInfo> bufferInfo,
+                                                const u32 dstElement)
+{
+    write(binding, bufferInfo.GetData(), sizeof(VkDescriptorBufferInfo), bufferInfo.GetSize(), dstElement);
+}
+void DescriptorSet::TemplateWriter::WriteImage(const u32 binding,
+                                               const TKit::Span<const VkDescriptorImageInfo> imageInfo,
+                                               const u32 dstElement)
+{
+    write(binding, imageInfo.GetData(), sizeof(VkDescriptorImageInfo), imageInfo.GetSize(), dstElement);
+}
+void DescriptorSet::TemplateWriter::WriteTexelBuffer(const u32 binding, const TKit::Span<const VkBufferView> views,
+                                                     const u32 dstElement)
+{
+    write(binding, views.GetData(), sizeof(VkBufferView), views.GetSize(), dstElement);
+}
+
+void DescriptorSet::TemplateWriter::Overwrite(const VkDescriptorSet set) const
+{
+    TKIT_ASSERT(m_Layout->GetUpdateTemplate(), "[VULKIT][DESCRIPTOR-SET] The layout has no update template");
+#    ifdef VKIT_API_VERSION_1_1
+    if (m_Device.Table->vkUpdateDescriptorSetWithTemplate)
+    {
+        m_Device.Table->UpdateDescriptorSetWithTemplate(m_Device, set, m_Layout->GetUpdateTemplate(),
+                                                        m_Data.GetData());
+        return;
+    }
+#    endif
+    m_Device.Table->UpdateDescriptorSetWithTemplateKHR(m_Device, set, m_Layout->GetUpdateTemplate(),
+                                                       m_Data.GetData());
+}
+#ifdef VK_KHR_push_descriptor
+void DescriptorSet::TemplateWriter::Push(const VkCommandBuffer commandBuffer,
+                                         const DescriptorSetLayout::PushTemplate &pushTemplate) const
+{
+    TKIT_ASSERT(m_Layout->IsPushDescriptor() && pushTemplate,
+                "[VULKIT][DESCRIPTOR-SET] The layout must be a push descriptor layout and the push template must have "
+                "been created through DescriptorSetLayout::CreatePushTemplate()");
+#    ifdef VKIT_API_VERSION_1_4
+    if (m_Device.Table->vkCmdPushDescriptorSetWithTemplate)
+    {
+        m_Device.Table->CmdPushDescriptorSetWithTemplate(commandBuffer, pushTemplate, pushTemplate.GetPipelineLayout(),
+                                                         pushTemplate.GetSet(), m_Data.GetData());
+        return;
+    }
+#    endif
+    m_Device.Table->CmdPushDescriptorSetWithTemplateKHR(commandBuffer, pushTemplate, pushTemplate.GetPipelineLayout(),
+                                                        pushTemplate.GetSet(), m_Data.GetData());
+}
+#endif
+#endif
 
 } // namespace VKit
@@ -25,6 +25,12 @@ class DescriptorSet
         void WriteBuffer(u32 binding, TKit::Span<const VkDescriptorBufferInfo> bufferInfo, u32 dstElement = 0);
         void WriteImage(u32 binding, TKit::Span<const VkDescriptorImageInfo> imageInfo, u32 dstElement = 0);
         void Overwrite(const VkDescriptorSet set);
+#ifdef VK_KHR_push_descriptor
+        // records the writes directly into the command buffer. the layout must have been built with the push
+        // descriptor flag, and no descriptor set needs to be allocated
+        void Push(VkCommandBuffer commandBuffer, VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+                  u32 set = 0) const;
+#endif
 
       private:
         ProxyDevice m_Device;
@@ -33,6 +39,49 @@ class DescriptorSet
         TKit::TierArray<VkWriteDescriptorSet> m_Writes;
     };
 
+#ifdef VK_KHR_descriptor_update_template
+    /**
+     * @brief Fills the packed data described by the update template of a `DescriptorSetLayout` and applies it with
+     * `vkUpdateDescriptorSetWithTemplateKHR`.
+     *
+     * Unlike `Writer`, writes are plain copies into a buffer that can be reused across sets and frames. The layout must
+     * have been built with `DescriptorSetLayout::Builder::SetUpdateTemplate()`.
+     *
+     */
+    class TemplateWriter
+    {
+      public:
+        TemplateWriter(const ProxyDevice &device, const DescriptorSetLayout *layout);
+
+        void WriteBuffer(u32 binding, TKit::Span<const VkDescriptorBufferInfo> bufferInfo, u32 dstElement = 0);
+        void WriteImage(u32 binding, TKit::Span<const VkDescriptorImageInfo> imageInfo, u32 dstElement = 0);
+        void WriteTexelBuffer(u32 binding, TKit::Span<const VkBufferView> views, u32 dstElement = 0);
+        void Overwrite(const VkDescriptorSet set) const;
+#ifdef VK_KHR_push_descriptor
+        // the template must come from DescriptorSetLayout::CreatePushTemplate() on the writer's layout. the pipeline
+        // layout and set number are the ones it was created with
+        void Push(VkCommandBuffer commandBuffer, const DescriptorSetLayout::PushTemplate &pushTemplate) const;
+#endif
+
+        const void *GetData() const
+        {
+            return m_Data.GetData();
+        }
+        usize GetSize() const
+        {
+            return m_Data.GetSize();
+        }
+
+      private:
+        void write(u32 binding, const void *data, usize size, u32 count, u32 dstElement);
+
+        ProxyDevice m_Device;
+        const DescriptorSetLayout *m_Layout;
+
+        TKit::TierArray<std::byte> m_Data;
+    };
+#endif
+
     DescriptorSet() = default;
     DescriptorSet(const ProxyDevice &device, const VkDescriptorSet set) : m_Device(device), m_Set(set)
     {
@@ -1,8 +1,116 @@
 #include "vkit/core/pch.hpp"
 #include "vkit/state/descriptor_set_layout.hpp"
+#include "tkit/container/stack_array.hpp"
 
 namespace VKit
 {
+#ifdef VK_KHR_descriptor_update_template
+static usize getTemplateStride(const VkDescriptorType type)
+{
+    switch (type)
+    {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        return sizeof(VkDescriptorImageInfo);
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+        return sizeof(VkDescriptorBufferInfo);
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        return sizeof(VkBufferView);
+    default:
+        return 0;
+    }
+}
+
+static Result<DescriptorSetLayout::TemplateInfo> createTemplateInfo(
+    const ProxyDevice &device, const TKit::Span<const VkDescriptorSetLayoutBinding> bindings)
+{
+    using Res = Result<DescriptorSetLayout::TemplateInfo>;
+    bool supported = device.Table->vkCreateDescriptorUpdateTemplateKHR != VK_NULL_HANDLE;
+#    ifdef VKIT_API_VERSION_1_1
+    supported |= device.Table->vkCreateDescriptorUpdateTemplate != VK_NULL_HANDLE;
+#    endif
+    if (!supported)
+        return Res::Error(Error_MissingExtension,
+                          "[VULKIT][DESCRIPTOR-LAYOUT] To create an update template, the device must use API version "
+                          "1.1 or enable the 'VK_KHR_descriptor_update_template' extension");
+
+    DescriptorSetLayout::TemplateInfo info{};
+    u32 bindingCount = 0;
+    for (const VkDescriptorSetLayoutBinding &binding : bindings)
+        bindingCount = std::max(bindingCount, binding.binding + 1);
+
+    info.Entries.Resize(bindingCount, VkDescriptorUpdateTemplateEntryKHR{});
+
+    // the entries are laid out in binding order so that the packed data mirrors the layout
+    for (u32 i = 0; i < info.Entries.GetSize(); ++i)
+        for (const VkDescriptorSetLayoutBinding &binding : bindings)
+            if (binding.binding == i && binding.descriptorCount > 0)
+            {
+                const usize stride = getTemplateStride(binding.descriptorType);
+                if (stride == 0)
+                    return Res::Error(
+                        Error_BadInput,
+                        TKit::TierString::Format("[VULKIT][DESCRIPTOR-LAYOUT] The descriptor type of binding {} is "
+                                                 "not supported by update templates",
+                                                 i));
+
+                VkDescriptorUpdateTemplateEntryKHR &entry = info.Entries[i];
+                entry.dstBinding = i;
+                entry.dstArrayElement = 0;
+                entry.descriptorCount = binding.descriptorCount;
+                entry.descriptorType = binding.descriptorType;
+                entry.offset = info.Size;
+                entry.stride = stride;
+
+                info.Size += stride * binding.descriptorCount;
+                break;
+            }
+    return info;
+}
+
+static VkResult createTemplate(const ProxyDevice &device, const DescriptorSetLayout::TemplateInfo &info,
+                               VkDescriptorUpdateTemplateCreateInfoKHR &createInfo,
+                               VkDescriptorUpdateTemplateKHR &updateTemplate)
+{
+    TKit::StackArray<VkDescriptorUpdateTemplateEntryKHR> entries{};
+    entries.Reserve(info.Entries.GetSize());
+    for (const VkDescriptorUpdateTemplateEntryKHR &entry : info.Entries)
+        if (entry.descriptorCount > 0)
+            entries.Append(entry);
+
+    createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR;
+    createInfo.descriptorUpdateEntryCount = entries.GetSize();
+    createInfo.pDescriptorUpdateEntries = entries.GetData();
+
+#    ifdef VKIT_API_VERSION_1_1
+    if (device.Table->vkCreateDescriptorUpdateTemplate)
+        return device.Table->CreateDescriptorUpdateTemplate(device, &createInfo, device.AllocationCallbacks,
+                                                            &updateTemplate);
+#    endif
+    return device.Table->CreateDescriptorUpdateTemplateKHR(device, &createInfo, device.AllocationCallbacks,
+                                                           &updateTemplate);
+}
+
+static void destroyTemplate(const ProxyDevice &device, const VkDescriptorUpdateTemplateKHR updateTemplate)
+{
+#    ifdef VKIT_API_VERSION_1_1
+    if (device.Table->vkDestroyDescriptorUpdateTemplate)
+    {
+        device.Table->DestroyDescriptorUpdateTemplate(device, updateTemplate, device.AllocationCallbacks);
+        return;
+    }
+#    endif
+    device.Table->DestroyDescriptorUpdateTemplateKHR(device, updateTemplate, device.AllocationCallbacks);
+}
+#endif
+
 Result<DescriptorSetLayout> DescriptorSetLayout::Builder::Build() const
 {
     TKit::StackArray<VkDescriptorSetLayoutBinding> bindings{};
@@ -43,22 +151,122 @@ Result<DescriptorSetLayout> DescriptorSetLayout::Builder::Build() const
     for (const VkDescriptorSetLayoutBinding &b : bindings)
         bindingMap[b.binding] = b;
 
-    return Result<DescriptorSetLayout>::Ok(m_Device, layout, bindingMap);
+#ifdef VK_KHR_descriptor_update_template
+    if (m_UpdateTemplate)
+    {
+        const auto cleanup = [this, layout] {
+            m_Device.Table->DestroyDescriptorSetLayout(m_Device, layout, m_Device.AllocationCallbacks);
+        };
+
+        const auto tresult = createTemplateInfo(m_Device, bindings);
+        TKIT_RETURN_ON_ERROR(tresult, cleanup());
+        TemplateInfo tinfo = *tresult;
+
+        // push descriptor templates depend on the pipeline layout, so they are created later with CreatePushTemplate()
+#    ifdef VK_KHR_push_descriptor
+        if (!(m_Flags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR))
+#    endif
+        {
+            VkDescriptorUpdateTemplateCreateInfoKHR createInfo{};
+            createInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR;
+            createInfo.descriptorSetLayout = layout;
+            VKIT_RETURN_IF_FAILED(createTemplate(m_Device, tinfo, createInfo, tinfo.Template),
+                                  Result<DescriptorSetLayout>, cleanup());
+        }
+
+        return Result<DescriptorSetLayout>::Ok(m_Device, layout, bindingMap, tinfo, m_Flags);
+    }
+#endif
+    return Result<DescriptorSetLayout>::Ok(m_Device, layout, bindingMap, m_Flags);
+}
+
+#if defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)
+Result<DescriptorSetLayout::PushTemplate> DescriptorSetLayout::CreatePushTemplate(const VkPipelineBindPoint bindPoint,
+                                                                                  const VkPipelineLayout layout,
+                                                                                  const u32 set) const
+{
+    using Res = Result<PushTemplate>;
+    if (!IsPushDescriptor())
+        return Res::Error(Error_BadInput, "[VULKIT][DESCRIPTOR-LAYOUT] Push templates can only be created for layouts "
+                                          "built with the push descriptor flag");
+    if (m_TemplateInfo.Entries.IsEmpty())
+        return Res::Error(Error_BadInput, "[VULKIT][DESCRIPTOR-LAYOUT] The layout must have been built with "
+                                          "SetUpdateTemplate() to create a push template");
+
+    VkDescriptorUpdateTemplateCreateInfoKHR createInfo{};
+    createInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR;
+    createInfo.descriptorSetLayout = m_Layout;
+    createInfo.pipelineBindPoint = bindPoint;
+    createInfo.pipelineLayout = layout;
+    createInfo.set = set;
+
+    VkDescriptorUpdateTemplateKHR updateTemplate;
+    VKIT_RETURN_IF_FAILED(createTemplate(m_Device, m_TemplateInfo, createInfo, updateTemplate), Res);
+    return Res::Ok(m_Device, updateTemplate, layout, set);
 }
 
+void DescriptorSetLayout::PushTemplate::Destroy()
+{
+    if (m_Template)
+    {
+        destroyTemplate(m_Device, m_Template);
+        m_Template = VK_NULL_HANDLE;
+    }
+}
+#endif
+
 void DescriptorSetLayout::Destroy()
 {
+#ifdef VK_KHR_descriptor_update_template
+    if (m_TemplateInfo.Template)
+    {
+        destroyTemplate(m_Device, m_TemplateInfo.Template);
+        m_TemplateInfo.Template = VK_NULL_HANDLE;
+    }
+#endif
     if (m_Layout)
     {
         m_Device.Table->DestroyDescriptorSetLayout(m_Device, m_Layout, m_Device.AllocationCallbacks);
         m_Layout = VK_NULL_HANDLE;
     }
 }
+#ifdef VK_EXT_descriptor_buffer
+VkDeviceSize DescriptorSetLayout::GetDescriptorBufferSize() const
+{
+    VkDeviceSize size;
+    m_Device.Table->GetDescriptorSetLayoutSizeEXT(m_Device, m_Layout, &size);
+    return size;
+}
+VkDeviceSize DescriptorSetLayout::GetDescriptorBufferOffset(const u32 binding) const
+{
+    VkDeviceSize offset;
+    m_Device.Table->GetDescriptorSetLayoutBindingOffsetEXT(m_Device, m_Layout, binding, &offset);
+    return offset;
+}
+#endif
+
 DescriptorSetLayout::Builder &DescriptorSetLayout::Builder::SetFlags(const VkDescriptorSetLayoutCreateFlags flags)
 {
     m_Flags = flags;
     return *this;
 }
+DescriptorSetLayout::Builder &DescriptorSetLayout::Builder::AddFlags(const VkDescriptorSetLayoutCreateFlags flags)
+{
+    m_Flags |= flags;
+    return *this;
+}
+DescriptorSetLayout::Builder &DescriptorSetLayout::Builder::RemoveFlags(const VkDescriptorSetLayoutCreateFlags flags)
+{
+    m_Flags &= ~flags;
+    return *this;
+}
+#ifdef VK_KHR_descriptor_update_template
+DescriptorSetLayout::Builder &DescriptorSetLayout::Builder::SetUpdateTemplate(const bool enable)
+{
+    m_UpdateTemplate = enable;
+    return *this;
+}
+#endif
 #if defined(VKIT_API_VERSION_1_2) || defined(VK_EXT_descriptor_indexing)
 DescriptorSetLayout::Builder &DescriptorSetLayout::Builder::AddBinding2(const u32 binding, const VkDescriptorType type,
                                                                         const VkShaderStageFlags stageFlags,
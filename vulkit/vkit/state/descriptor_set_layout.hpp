@@ -29,8 +29,18 @@ class DescriptorSetLayout
 #endif
         Builder &AddBinding(u32 binding, VkDescriptorType type, VkShaderStageFlags stageFlags, u32 count = 1);
         Builder &SetFlags(VkDescriptorSetLayoutCreateFlags flags);
+        Builder &AddFlags(VkDescriptorSetLayoutCreateFlags flags);
+        Builder &RemoveFlags(VkDescriptorSetLayoutCreateFlags flags);
+#ifdef VK_KHR_descriptor_update_template
+        // also create a descriptor update template covering every binding of the layout. requires the
+        // VK_KHR_descriptor_update_template extension to be enabled. for push descriptor layouts, the template itself
+        // is created afterwards with DescriptorSetLayout::CreatePushTemplate()
+        Builder &SetUpdateTemplate(bool enable = true);
+#endif
 
       private:
+        friend class LayoutCache;
+
         struct BindingInfo
         {
             VkDescriptorSetLayoutBinding Binding;
@@ -41,22 +51,121 @@ class DescriptorSetLayout
         ProxyDevice m_Device;
         TKit::TierHashMap<u32, BindingInfo> m_Bindings;
         VkDescriptorSetLayoutCreateFlags m_Flags = 0;
+#ifdef VK_KHR_descriptor_update_template
+        bool m_UpdateTemplate = false;
+#endif
+    };
+
+#ifdef VK_KHR_descriptor_update_template
+    struct TemplateInfo
+    {
+        VkDescriptorUpdateTemplateKHR Template = VK_NULL_HANDLE;
+        // indexed by binding. each entry holds the offset and stride of the binding inside the packed data the
+        // template reads from. holes in the binding numbers have a descriptor count of zero
+        TKit::TierArray<VkDescriptorUpdateTemplateEntryKHR> Entries{};
+        usize Size = 0;
+    };
+#endif
+
+#if defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)
+    // a push descriptor template for the pipeline layout and set number it was created with. it is owned by the caller
+    // and must be destroyed before the set layout it was created from
+    class PushTemplate
+    {
+      public:
+        PushTemplate() = default;
+        PushTemplate(const ProxyDevice &device, const VkDescriptorUpdateTemplateKHR updateTemplate,
+                     const VkPipelineLayout layout, const u32 set)
+            : m_Device(device), m_Template(updateTemplate), m_PipelineLayout(layout), m_Set(set)
+        {
+        }
+
+        void Destroy();
+
+        VkPipelineLayout GetPipelineLayout() const
+        {
+            return m_PipelineLayout;
+        }
+        u32 GetSet() const
+        {
+            return m_Set;
+        }
+        VkDescriptorUpdateTemplateKHR GetHandle() const
+        {
+            return m_Template;
+        }
+        operator VkDescriptorUpdateTemplateKHR() const
+        {
+            return m_Template;
+        }
+        operator bool() const
+        {
+            return m_Template != VK_NULL_HANDLE;
+        }
+
+      private:
+        ProxyDevice m_Device{};
+        VkDescriptorUpdateTemplateKHR m_Template = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        u32 m_Set = 0;
     };
+#endif
 
     DescriptorSetLayout() = default;
     DescriptorSetLayout(const ProxyDevice &device, const VkDescriptorSetLayout layout,
-                        const TKit::TierHashMap<u32, VkDescriptorSetLayoutBinding> &bindings)
-        : m_Device(device), m_Layout(layout), m_Bindings{bindings}
+                        const TKit::TierHashMap<u32, VkDescriptorSetLayoutBinding> &bindings,
+                        const VkDescriptorSetLayoutCreateFlags flags = 0)
+        : m_Device(device), m_Layout(layout), m_Bindings{bindings}, m_Flags(flags)
+    {
+    }
+#ifdef VK_KHR_descriptor_update_template
+    DescriptorSetLayout(const ProxyDevice &device, const VkDescriptorSetLayout layout,
+                        const TKit::TierHashMap<u32, VkDescriptorSetLayoutBinding> &bindings,
+                        const TemplateInfo &templateInfo, const VkDescriptorSetLayoutCreateFlags flags = 0)
+        : m_Device(device), m_Layout(layout), m_Bindings{bindings}, m_Flags(flags), m_TemplateInfo(templateInfo)
     {
     }
+#endif
 
     void Destroy();
+
+#if defined(VK_KHR_push_descriptor) && defined(VK_KHR_descriptor_update_template)
+    // push descriptor templates are tied to a pipeline layout and set number, so they cannot be created along with
+    // the set layout. the layout is left untouched, so any number of templates may be created from it
+    VKIT_NO_DISCARD Result<PushTemplate> CreatePushTemplate(VkPipelineBindPoint bindPoint, VkPipelineLayout layout,
+                                                            u32 set = 0) const;
+#endif
+#ifdef VK_EXT_descriptor_buffer
+    // the layout must have been built with VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT
+    VkDeviceSize GetDescriptorBufferSize() const;
+    VkDeviceSize GetDescriptorBufferOffset(u32 binding) const;
+#endif
+#ifdef VK_KHR_push_descriptor
+    bool IsPushDescriptor() const
+    {
+        return m_Flags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+    }
+#endif
     VKIT_SET_DEBUG_NAME(m_Layout, VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT)
 
     const TKit::TierHashMap<u32, VkDescriptorSetLayoutBinding> &GetBindings() const
     {
         return m_Bindings;
     }
+#ifdef VK_KHR_descriptor_update_template
+    const TemplateInfo &GetTemplateInfo() const
+    {
+        return m_TemplateInfo;
+    }
+    VkDescriptorUpdateTemplateKHR GetUpdateTemplate() const
+    {
+        return m_TemplateInfo.Template;
+    }
+#endif
+    VkDescriptorSetLayoutCreateFlags GetFlags() const
+    {
+        return m_Flags;
+    }
     const ProxyDevice &GetDevice() const
     {
         return m_Device;
@@ -78,5 +187,9 @@ class DescriptorSetLayout
     ProxyDevice m_Device{};
     VkDescriptorSetLayout m_Layout = VK_NULL_HANDLE;
     TKit::TierHashMap<u32, VkDescriptorSetLayoutBinding> m_Bindings;
+    VkDescriptorSetLayoutCreateFlags m_Flags = 0;
+#ifdef VK_KHR_descriptor_update_template
+    TemplateInfo m_TemplateInfo{};
+#endif
 };
 } // namespace VKit
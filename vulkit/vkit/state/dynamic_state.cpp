@@ -0,0 +1,336 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/dynamic_state.hpp"
+#include "tkit/container/stack_array.hpp"
+
+#include <cstring>
+
+#ifdef VK_EXT_extended_dynamic_state3
+namespace VKit
+{
+namespace
+{
+enum StateBit : u32
+{
+    State_CullMode = 1U << 0,
+    State_FrontFace = 1U << 1,
+    State_Topology = 1U << 2,
+    State_DepthTest = 1U << 3,
+    State_DepthWrite = 1U << 4,
+    State_DepthCompareOp = 1U << 5,
+    State_DepthBoundsTest = 1U << 6,
+    State_StencilTest = 1U << 7,
+    State_StencilFront = 1U << 8,
+    State_StencilBack = 1U << 9,
+    State_RasterizerDiscard = 1U << 10,
+    State_DepthBias = 1U << 11,
+    State_PrimitiveRestart = 1U << 12,
+    State_PolygonMode = 1U << 13,
+    State_DepthClamp = 1U << 14,
+    State_AlphaToCoverage = 1U << 15,
+    State_BlendEnables = 1U << 16,
+    State_BlendEquations = 1U << 17,
+    State_WriteMasks = 1U << 18,
+    State_VertexLayout = 1U << 19,
+};
+
+// the values attachments take when they are grown past or seeded without being set
+constexpr VkBool32 s_NeutralBlendEnable = VK_FALSE;
+constexpr VkColorBlendEquationEXT s_NeutralBlendEquation{VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ZERO, VK_BLEND_OP_ADD,
+                                                         VK_BLEND_FACTOR_ONE, VK_BLEND_FACTOR_ZERO, VK_BLEND_OP_ADD};
+constexpr VkColorComponentFlags s_NeutralWriteMask =
+    VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+} // namespace
+
+template <typename T> DynamicState &DynamicState::set(T &current, const T &value, const u32 bit)
+{
+    // compared as raw memory, as some of the states are plain structs without an equality operator
+    if ((m_Set & bit) && std::memcmp(&current, &value, sizeof(T)) == 0)
+        return *this;
+    current = value;
+    m_Set |= bit;
+    m_Dirty |= bit;
+    return *this;
+}
+
+template <typename T>
+DynamicState &DynamicState::setAttachment(TKit::TierArray<T> &current, const u32 attachment, const T &value,
+                                          const T &neutral, const u32 bit)
+{
+    if (attachment >= current.GetSize())
+        current.Resize(attachment + 1, neutral);
+    else if ((m_Set & bit) && std::memcmp(&current[attachment], &value, sizeof(T)) == 0)
+        return *this;
+
+    current[attachment] = value;
+    m_Set |= bit;
+    m_Dirty |= bit;
+    return *this;
+}
+
+template <typename T> void DynamicState::seed(T &current, const T &value, const u32 bit)
+{
+    if (m_Set & bit)
+        return;
+    current = value;
+    m_Set |= bit;
+    m_Dirty |= bit;
+}
+
+template <typename T>
+void DynamicState::seedAttachments(TKit::TierArray<T> &current, const u32 count, const T &neutral, const u32 bit)
+{
+    if (count <= current.GetSize())
+        return;
+    current.Resize(count, neutral);
+    m_Set |= bit;
+    m_Dirty |= bit;
+}
+
+DynamicState &DynamicState::AddDynamicStates(const DynamicStateFlags flags, const u32 colorAttachmentCount)
+{
+    if (flags & DynamicStateFlag_Extended)
+    {
+        const StencilOperation stencilOp{VK_STENCIL_OP_KEEP, VK_STENCIL_OP_KEEP, VK_STENCIL_OP_KEEP,
+                                         VK_COMPARE_OP_ALWAYS};
+        seed(m_CullMode, VkCullModeFlags{VK_CULL_MODE_NONE}, State_CullMode);
+        seed(m_FrontFace, VK_FRONT_FACE_COUNTER_CLOCKWISE, State_FrontFace);
+        seed(m_Topology, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, State_Topology);
+        seed(m_DepthTest, VkBool32{VK_FALSE}, State_DepthTest);
+        seed(m_DepthWrite, VkBool32{VK_FALSE}, State_DepthWrite);
+        seed(m_DepthCompareOp, VK_COMPARE_OP_LESS, State_DepthCompareOp);
+        seed(m_DepthBoundsTest, VkBool32{VK_FALSE}, State_DepthBoundsTest);
+        seed(m_StencilTest, VkBool32{VK_FALSE}, State_StencilTest);
+        seed(m_StencilFront, stencilOp, State_StencilFront);
+        seed(m_StencilBack, stencilOp, State_StencilBack);
+    }
+    if (flags & DynamicStateFlag_Extended2)
+    {
+        seed(m_RasterizerDiscard, VkBool32{VK_FALSE}, State_RasterizerDiscard);
+        seed(m_DepthBias, VkBool32{VK_FALSE}, State_DepthBias);
+        seed(m_PrimitiveRestart, VkBool32{VK_FALSE}, State_PrimitiveRestart);
+    }
+    if (flags & DynamicStateFlag_Extended3)
+    {
+        seed(m_PolygonMode, VK_POLYGON_MODE_FILL, State_PolygonMode);
+        seed(m_DepthClamp, VkBool32{VK_FALSE}, State_DepthClamp);
+        seed(m_AlphaToCoverage, VkBool32{VK_FALSE}, State_AlphaToCoverage);
+        seedAttachments(m_BlendEnables, colorAttachmentCount, s_NeutralBlendEnable, State_BlendEnables);
+        seedAttachments(m_BlendEquations, colorAttachmentCount, s_NeutralBlendEquation, State_BlendEquations);
+        seedAttachments(m_WriteMasks, colorAttachmentCount, s_NeutralWriteMask, State_WriteMasks);
+    }
+#ifdef VK_EXT_vertex_input_dynamic_state
+    // a null layout is emitted as an empty vertex input state
+    if (flags & DynamicStateFlag_VertexInput)
+        seed(m_VertexLayout, static_cast<const VertexLayout *>(nullptr), State_VertexLayout);
+#endif
+    return *this;
+}
+
+void DynamicState::Apply(const VkCommandBuffer commandBuffer)
+{
+    if (m_Dirty == 0)
+        return;
+
+    const auto table = m_Device.Table;
+    const auto dirty = [this](const u32 bit) { return (m_Dirty & bit) != 0; };
+
+    // the extended dynamic state and extended dynamic state 2 commands are core since 1.3, where the EXT entry points
+    // are only loaded if the extensions are enabled as well. the extended dynamic state 3 ones have no core equivalent
+#ifdef VKIT_API_VERSION_1_3
+    const bool core = table->vkCmdSetCullMode != VK_NULL_HANDLE;
+#    define SET_STATE(name, ...)                                                                                       \
+        core ? table->CmdSet##name(commandBuffer, __VA_ARGS__) : table->CmdSet##name##EXT(commandBuffer, __VA_ARGS__)
+#else
+#    define SET_STATE(name, ...) table->CmdSet##name##EXT(commandBuffer, __VA_ARGS__)
+#endif
+
+    if (dirty(State_CullMode))
+        SET_STATE(CullMode, m_CullMode);
+    if (dirty(State_FrontFace))
+        SET_STATE(FrontFace, m_FrontFace);
+    if (dirty(State_Topology))
+        SET_STATE(PrimitiveTopology, m_Topology);
+    if (dirty(State_DepthTest))
+        SET_STATE(DepthTestEnable, m_DepthTest);
+    if (dirty(State_DepthWrite))
+        SET_STATE(DepthWriteEnable, m_DepthWrite);
+    if (dirty(State_DepthCompareOp))
+        SET_STATE(DepthCompareOp, m_DepthCompareOp);
+    if (dirty(State_DepthBoundsTest))
+        SET_STATE(DepthBoundsTestEnable, m_DepthBoundsTest);
+    if (dirty(State_StencilTest))
+        SET_STATE(StencilTestEnable, m_StencilTest);
+
+    const auto setStencilOp = [&](const VkStencilFaceFlags faces, const StencilOperation &op) {
+        SET_STATE(StencilOp, faces, op.FailOp, op.PassOp, op.DepthFailOp, op.CompareOp);
+    };
+    const bool front = dirty(State_StencilFront);
+    const bool back = dirty(State_StencilBack);
+    if (front && back && std::memcmp(&m_StencilFront, &m_StencilBack, sizeof(StencilOperation)) == 0)
+        setStencilOp(VK_STENCIL_FACE_FRONT_AND_BACK, m_StencilFront);
+    else
+    {
+        if (front)
+            setStencilOp(VK_STENCIL_FACE_FRONT_BIT, m_StencilFront);
+        if (back)
+            setStencilOp(VK_STENCIL_FACE_BACK_BIT, m_StencilBack);
+    }
+
+    if (dirty(State_RasterizerDiscard))
+        SET_STATE(RasterizerDiscardEnable, m_RasterizerDiscard);
+    if (dirty(State_DepthBias))
+        SET_STATE(DepthBiasEnable, m_DepthBias);
+    if (dirty(State_PrimitiveRestart))
+        SET_STATE(PrimitiveRestartEnable, m_PrimitiveRestart);
+#undef SET_STATE
+
+    if (dirty(State_PolygonMode))
+        table->CmdSetPolygonModeEXT(commandBuffer, m_PolygonMode);
+    if (dirty(State_DepthClamp))
+        table->CmdSetDepthClampEnableEXT(commandBuffer, m_DepthClamp);
+    if (dirty(State_AlphaToCoverage))
+        table->CmdSetAlphaToCoverageEnableEXT(commandBuffer, m_AlphaToCoverage);
+    if (dirty(State_BlendEnables))
+        table->CmdSetColorBlendEnableEXT(commandBuffer, 0, m_BlendEnables.GetSize(), m_BlendEnables.GetData());
+    if (dirty(State_BlendEquations))
+        table->CmdSetColorBlendEquationEXT(commandBuffer, 0, m_BlendEquations.GetSize(), m_BlendEquations.GetData());
+    if (dirty(State_WriteMasks))
+        table->CmdSetColorWriteMaskEXT(commandBuffer, 0, m_WriteMasks.GetSize(), m_WriteMasks.GetData());
+
+#ifdef VK_EXT_vertex_input_dynamic_state
+    if (dirty(State_VertexLayout) && !m_VertexLayout)
+        table->CmdSetVertexInputEXT(commandBuffer, 0, nullptr, 0, nullptr);
+    else if (dirty(State_VertexLayout))
+    {
+        const auto &bindings = m_VertexLayout->GetBindings();
+        const auto &attributes = m_VertexLayout->GetAttributes();
+
+        TKit::StackArray<VkVertexInputBindingDescription2EXT> bindings2{};
+        TKit::StackArray<VkVertexInputAttributeDescription2EXT> attributes2{};
+        bindings2.Reserve(bindings.GetSize());
+        attributes2.Reserve(attributes.GetSize());
+        for (const VkVertexInputBindingDescription &binding : bindings)
+        {
+            VkVertexInputBindingDescription2EXT &desc = bindings2.Append();
+            desc = {};
+            desc.sType = VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT;
+            desc.binding = binding.binding;
+            desc.stride = binding.stride;
+            desc.inputRate = binding.inputRate;
+            desc.divisor = 1;
+        }
+        for (const VkVertexInputAttributeDescription &attribute : attributes)
+        {
+            VkVertexInputAttributeDescription2EXT &desc = attributes2.Append();
+            desc = {};
+            desc.sType = VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT;
+            desc.location = attribute.location;
+            desc.binding = attribute.binding;
+            desc.format = attribute.format;
+            desc.offset = attribute.offset;
+        }
+        table->CmdSetVertexInputEXT(commandBuffer, bindings2.GetSize(), bindings2.GetData(), attributes2.GetSize(),
+                                    attributes2.GetData());
+    }
+#endif
+
+    m_Dirty = 0;
+}
+
+void DynamicState::Invalidate()
+{
+    m_Dirty = m_Set;
+}
+
+DynamicState &DynamicState::SetCullMode(const VkCullModeFlags mode)
+{
+    return set(m_CullMode, mode, State_CullMode);
+}
+DynamicState &DynamicState::SetFrontFace(const VkFrontFace frontFace)
+{
+    return set(m_FrontFace, frontFace, State_FrontFace);
+}
+DynamicState &DynamicState::SetTopology(const VkPrimitiveTopology topology)
+{
+    return set(m_Topology, topology, State_Topology);
+}
+DynamicState &DynamicState::EnableDepthTest(const VkBool32 enable)
+{
+    return set(m_DepthTest, enable, State_DepthTest);
+}
+DynamicState &DynamicState::EnableDepthWrite(const VkBool32 enable)
+{
+    return set(m_DepthWrite, enable, State_DepthWrite);
+}
+DynamicState &DynamicState::SetDepthCompareOperation(const VkCompareOp op)
+{
+    return set(m_DepthCompareOp, op, State_DepthCompareOp);
+}
+DynamicState &DynamicState::EnableDepthBoundsTest(const VkBool32 enable)
+{
+    return set(m_DepthBoundsTest, enable, State_DepthBoundsTest);
+}
+DynamicState &DynamicState::EnableStencilTest(const VkBool32 enable)
+{
+    return set(m_StencilTest, enable, State_StencilTest);
+}
+DynamicState &DynamicState::SetStencilOperation(const VkStencilOp failOp, const VkStencilOp passOp,
+                                                const VkStencilOp depthFailOp, const VkCompareOp compareOp,
+                                                const StencilOperationFlags flags)
+{
+    const StencilOperation op{failOp, passOp, depthFailOp, compareOp};
+    if (flags & StencilOperationFlag_Front)
+        set(m_StencilFront, op, State_StencilFront);
+    if (flags & StencilOperationFlag_Back)
+        set(m_StencilBack, op, State_StencilBack);
+    return *this;
+}
+
+DynamicState &DynamicState::EnableRasterizerDiscard(const VkBool32 enable)
+{
+    return set(m_RasterizerDiscard, enable, State_RasterizerDiscard);
+}
+DynamicState &DynamicState::EnableDepthBias(const VkBool32 enable)
+{
+    return set(m_DepthBias, enable, State_DepthBias);
+}
+DynamicState &DynamicState::EnablePrimitiveRestart(const VkBool32 enable)
+{
+    return set(m_PrimitiveRestart, enable, State_PrimitiveRestart);
+}
+
+DynamicState &DynamicState::SetPolygonMode(const VkPolygonMode mode)
+{
+    return set(m_PolygonMode, mode, State_PolygonMode);
+}
+DynamicState &DynamicState::EnableDepthClamp(const VkBool32 enable)
+{
+    return set(m_DepthClamp, enable, State_DepthClamp);
+}
+DynamicState &DynamicState::EnableAlphaToCoverage(const VkBool32 enable)
+{
+    return set(m_AlphaToCoverage, enable, State_AlphaToCoverage);
+}
+DynamicState &DynamicState::EnableBlending(const u32 attachment, const VkBool32 enable)
+{
+    return setAttachment(m_BlendEnables, attachment, enable, s_NeutralBlendEnable, State_BlendEnables);
+}
+DynamicState &DynamicState::SetColorBlendEquation(const u32 attachment, const VkColorBlendEquationEXT &equation)
+{
+    return setAttachment(m_BlendEquations, attachment, equation, s_NeutralBlendEquation, State_BlendEquations);
+}
+DynamicState &DynamicState::SetColorWriteMask(const u32 attachment, const VkColorComponentFlags mask)
+{
+    return setAttachment(m_WriteMasks, attachment, mask, s_NeutralWriteMask, State_WriteMasks);
+}
+
+#ifdef VK_EXT_vertex_input_dynamic_state
+DynamicState &DynamicState::SetVertexLayout(const VertexLayout *layout)
+{
+    TKIT_ASSERT(layout, "[VULKIT][DYNAMIC-STATE] Vertex layout must not be null");
+    return set(m_VertexLayout, layout, State_VertexLayout);
+}
+#endif
+
+} // namespace VKit
+#endif
@@ -0,0 +1,132 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_GRAPHICS_PIPELINE
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_GRAPHICS_PIPELINE"
+#endif
+
+#include "vkit/state/graphics_pipeline.hpp"
+#include "vkit/state/vertex_layout.hpp"
+#include "tkit/container/tier_array.hpp"
+#include <vulkan/vulkan.h>
+
+#ifdef VK_EXT_extended_dynamic_state3
+namespace VKit
+{
+/**
+ * @brief Records the state made dynamic with `GraphicsPipeline::Builder::AddDynamicStates()`.
+ *
+ * Setters only store the requested values. `Apply()` then emits the `vkCmdSet*` commands for the ones that changed
+ * since the previous call, so the same object can be kept around while recording and fed the state of every draw
+ * without emitting redundant commands. Every command buffer starts with undefined dynamic state, so `Invalidate()` must
+ * be called when switching to a new one. The core 1.3 commands are preferred over the EXT ones when available.
+ *
+ * Only the setters matching the groups enabled on the device may be used. `AddDynamicStates()` should be called with
+ * the same groups given to `GraphicsPipeline::Builder::AddDynamicStates()`, so that every dynamic state has a value
+ * before the first draw even if its setter is never called.
+ *
+ */
+class DynamicState
+{
+  public:
+    DynamicState() = default;
+    DynamicState(const ProxyDevice &device) : m_Device(device)
+    {
+    }
+
+    // seeds every state of the groups that was not set yet with its default value, which is the same
+    // `ShaderObject::SetDefaultState()` uses. attachment states are seeded for the first `colorAttachmentCount`
+    // attachments
+    DynamicState &AddDynamicStates(DynamicStateFlags flags, u32 colorAttachmentCount = 0);
+
+    // emits the commands for every state that changed since the last call
+    void Apply(VkCommandBuffer commandBuffer);
+    // marks every state set so far to be emitted again on the next `Apply()`
+    void Invalidate();
+
+    // Extended Dynamic State
+    DynamicState &SetCullMode(VkCullModeFlags mode);
+    DynamicState &SetFrontFace(VkFrontFace frontFace);
+    DynamicState &SetTopology(VkPrimitiveTopology topology);
+    DynamicState &EnableDepthTest(VkBool32 enable = VK_TRUE);
+    DynamicState &EnableDepthWrite(VkBool32 enable = VK_TRUE);
+    DynamicState &SetDepthCompareOperation(VkCompareOp op);
+    DynamicState &EnableDepthBoundsTest(VkBool32 enable = VK_TRUE);
+    DynamicState &EnableStencilTest(VkBool32 enable = VK_TRUE);
+    DynamicState &SetStencilOperation(VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp,
+                                      VkCompareOp compareOp, StencilOperationFlags flags);
+
+    // Extended Dynamic State 2
+    DynamicState &EnableRasterizerDiscard(VkBool32 enable = VK_TRUE);
+    DynamicState &EnableDepthBias(VkBool32 enable = VK_TRUE);
+    DynamicState &EnablePrimitiveRestart(VkBool32 enable = VK_TRUE);
+
+    // Extended Dynamic State 3
+    DynamicState &SetPolygonMode(VkPolygonMode mode);
+    DynamicState &EnableDepthClamp(VkBool32 enable = VK_TRUE);
+    DynamicState &EnableAlphaToCoverage(VkBool32 enable = VK_TRUE);
+    // attachments below the one set that were never set take their default value
+    DynamicState &EnableBlending(u32 attachment, VkBool32 enable = VK_TRUE);
+    DynamicState &SetColorBlendEquation(u32 attachment, const VkColorBlendEquationEXT &equation);
+    DynamicState &SetColorWriteMask(u32 attachment, VkColorComponentFlags mask);
+
+#ifdef VK_EXT_vertex_input_dynamic_state
+    // Vertex Input Dynamic State
+    // layouts are compared by address, so they should come from a `VertexLayoutCache`. the layout must outlive the
+    // next `Apply()` and must not be modified while set
+    DynamicState &SetVertexLayout(const VertexLayout *layout);
+#endif
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+
+  private:
+    struct StencilOperation
+    {
+        VkStencilOp FailOp;
+        VkStencilOp PassOp;
+        VkStencilOp DepthFailOp;
+        VkCompareOp CompareOp;
+    };
+
+    template <typename T> DynamicState &set(T &current, const T &value, u32 bit);
+    template <typename T>
+    DynamicState &setAttachment(TKit::TierArray<T> &current, u32 attachment, const T &value, const T &neutral,
+                                u32 bit);
+    template <typename T> void seed(T &current, const T &value, u32 bit);
+    template <typename T> void seedAttachments(TKit::TierArray<T> &current, u32 count, const T &neutral, u32 bit);
+
+    ProxyDevice m_Device{};
+
+    // states ever set, and states that changed since the last `Apply()`
+    u32 m_Set = 0;
+    u32 m_Dirty = 0;
+
+    VkCullModeFlags m_CullMode = VK_CULL_MODE_NONE;
+    VkFrontFace m_FrontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    VkPrimitiveTopology m_Topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkBool32 m_DepthTest = VK_FALSE;
+    VkBool32 m_DepthWrite = VK_FALSE;
+    VkCompareOp m_DepthCompareOp = VK_COMPARE_OP_LESS;
+    VkBool32 m_DepthBoundsTest = VK_FALSE;
+    VkBool32 m_StencilTest = VK_FALSE;
+    StencilOperation m_StencilFront{};
+    StencilOperation m_StencilBack{};
+
+    VkBool32 m_RasterizerDiscard = VK_FALSE;
+    VkBool32 m_DepthBias = VK_FALSE;
+    VkBool32 m_PrimitiveRestart = VK_FALSE;
+
+    VkPolygonMode m_PolygonMode = VK_POLYGON_MODE_FILL;
+    VkBool32 m_DepthClamp = VK_FALSE;
+    VkBool32 m_AlphaToCoverage = VK_FALSE;
+    TKit::TierArray<VkBool32> m_BlendEnables{};
+    TKit::TierArray<VkColorBlendEquationEXT> m_BlendEquations{};
+    TKit::TierArray<VkColorComponentFlags> m_WriteMasks{};
+
+    const VertexLayout *m_VertexLayout = nullptr;
+};
+} // namespace VKit
+#endif
@@ -1,5 +1,7 @@
 #include "vkit/core/pch.hpp"
 #include "vkit/state/graphics_pipeline.hpp"
+#include "vkit/state/pipeline_stats.hpp"
+#include "vkit/state/vertex_layout.hpp"
 #include "tkit/container/stack_array.hpp"
 
 namespace VKit
@@ -77,15 +79,43 @@ void GraphicsPipeline::Builder::initialize()
     m_VertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
 }
 
+// feedback is only chained when the device can report it, as the structure is unknown to it otherwise
+static bool usesStats(const PipelineStats *stats)
+{
+    return stats && stats->IsSupported();
+}
+
+static void recordStats(PipelineStats *stats, const char *name, const PipelineStats::Feedback &feedback,
+                        const TKit::Span<const VkPipelineShaderStageCreateInfo> shaderStages)
+{
+    TKit::StackArray<VkShaderStageFlagBits> stages{};
+    stages.Reserve(shaderStages.GetSize());
+    for (const VkPipelineShaderStageCreateInfo &stage : shaderStages)
+        stages.Append(stage.stage);
+    stats->Record(name, feedback, stages);
+}
+
 Result<GraphicsPipeline> GraphicsPipeline::Builder::Build() const
 {
-    const VkGraphicsPipelineCreateInfo pipelineInfo = CreatePipelineInfo();
+    return Build(m_Cache);
+}
+
+Result<GraphicsPipeline> GraphicsPipeline::Builder::Build(const VkPipelineCache cache) const
+{
+    VkGraphicsPipelineCreateInfo pipelineInfo = CreatePipelineInfo();
+
+    const bool stats = usesStats(m_Stats);
+    PipelineStats::Feedback feedback{stats ? m_ShaderStages.GetSize() : 0};
+    if (stats)
+        pipelineInfo.pNext = feedback.Chain(pipelineInfo.pNext);
 
     VkPipeline pipeline;
-    VKIT_RETURN_IF_FAILED(m_Device.Table->CreateGraphicsPipelines(m_Device, m_Cache, 1, &pipelineInfo,
+    VKIT_RETURN_IF_FAILED(m_Device.Table->CreateGraphicsPipelines(m_Device, cache, 1, &pipelineInfo,
                                                                   m_Device.AllocationCallbacks, &pipeline),
                           Result<GraphicsPipeline>);
 
+    if (stats)
+        recordStats(m_Stats, m_StatsName, feedback, m_ShaderStages);
     return Result<GraphicsPipeline>::Ok(m_Device, pipeline);
 }
 
@@ -97,12 +127,23 @@ Result<> GraphicsPipeline::Create(const ProxyDevice &device, const TKit::Span<co
                 pipelines.GetSize());
     TKIT_ASSERT(!builders.IsEmpty(), "[VULKIT][PIPELINE] Specs and pipelines must not be empty");
 
+    const u32 count = builders.GetSize();
+
+    // reserved up front, as the create infos point into the feedback storage
+    TKit::TierArray<PipelineStats::Feedback> feedbacks{};
+    feedbacks.Reserve(count);
+
     TKit::StackArray<VkGraphicsPipelineCreateInfo> pipelineInfos;
-    pipelineInfos.Reserve(builders.GetSize());
+    pipelineInfos.Reserve(count);
     for (const Builder &builder : builders)
-        pipelineInfos.Append(builder.CreatePipelineInfo());
+    {
+        VkGraphicsPipelineCreateInfo &info = pipelineInfos.Append(builder.CreatePipelineInfo());
+        const bool stats = usesStats(builder.m_Stats);
+        PipelineStats::Feedback &feedback = feedbacks.Append(stats ? builder.m_ShaderStages.GetSize() : 0);
+        if (stats)
+            info.pNext = feedback.Chain(info.pNext);
+    }
 
-    const u32 count = builders.GetSize();
     TKit::StackArray<VkPipeline> vkpipelines{count};
 
     VKIT_RETURN_IF_FAILED(device.Table->CreateGraphicsPipelines(device, cache, count, pipelineInfos.GetData(),
@@ -110,7 +151,12 @@ Result<> GraphicsPipeline::Create(const ProxyDevice &device, const TKit::Span<co
                           Result<>);
 
     for (u32 i = 0; i < count; ++i)
+    {
+        const Builder &builder = builders[i];
+        if (usesStats(builder.m_Stats))
+            recordStats(builder.m_Stats, builder.m_StatsName, feedbacks[i], builder.m_ShaderStages);
         pipelines[i] = GraphicsPipeline(device, vkpipelines[i]);
+    }
 
     return Result<>::Ok();
 }
@@ -186,6 +232,12 @@ GraphicsPipeline::Builder &GraphicsPipeline::Builder::SetCache(const VkPipelineC
     m_Cache = cache;
     return *this;
 }
+GraphicsPipeline::Builder &GraphicsPipeline::Builder::SetStats(PipelineStats *stats, const char *name)
+{
+    m_Stats = stats;
+    m_StatsName = name;
+    return *this;
+}
 
 // Input Assembly
 GraphicsPipeline::Builder &GraphicsPipeline::Builder::SetTopology(const VkPrimitiveTopology topology)
@@ -453,6 +505,16 @@ GraphicsPipeline::Builder &GraphicsPipeline::Builder::AddAttributeDescription(co
     m_AttributeDescriptions.Append(attribute);
     return *this;
 }
+GraphicsPipeline::Builder &GraphicsPipeline::Builder::SetVertexLayout(const VertexLayout &layout)
+{
+    m_BindingDescriptions.Clear();
+    m_AttributeDescriptions.Clear();
+    for (const VkVertexInputBindingDescription &binding : layout.GetBindings())
+        m_BindingDescriptions.Append(binding);
+    for (const VkVertexInputAttributeDescription &attribute : layout.GetAttributes())
+        m_AttributeDescriptions.Append(attribute);
+    return *this;
+}
 
 // Shader Stages
 GraphicsPipeline::Builder &GraphicsPipeline::Builder::AddShaderStage(const VkShaderModule module,
@@ -471,13 +533,65 @@ GraphicsPipeline::Builder &GraphicsPipeline::Builder::AddShaderStage(const VkSha
     m_ShaderStages.Append(stage);
     return *this;
 }
+GraphicsPipeline::Builder &GraphicsPipeline::Builder::SetSpecializationInfo(const VkSpecializationInfo *info,
+                                                                            const VkShaderStageFlags stages)
+{
+    for (VkPipelineShaderStageCreateInfo &stage : m_ShaderStages)
+        if (stage.stage & stages)
+            stage.pSpecializationInfo = info;
+    return *this;
+}
 
 // Dynamic State
 GraphicsPipeline::Builder &GraphicsPipeline::Builder::AddDynamicState(const VkDynamicState state)
 {
+    for (const VkDynamicState dstate : m_DynamicStates)
+        if (dstate == state)
+            return *this;
     m_DynamicStates.Append(state);
     return *this;
 }
+GraphicsPipeline::Builder &GraphicsPipeline::Builder::AddDynamicStates(const DynamicStateFlags flags)
+{
+#ifdef VK_EXT_extended_dynamic_state
+    if (flags & DynamicStateFlag_Extended)
+    {
+        AddDynamicState(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+    }
+#endif
+#ifdef VK_EXT_extended_dynamic_state2
+    if (flags & DynamicStateFlag_Extended2)
+    {
+        AddDynamicState(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT);
+    }
+#endif
+#ifdef VK_EXT_extended_dynamic_state3
+    if (flags & DynamicStateFlag_Extended3)
+    {
+        AddDynamicState(VK_DYNAMIC_STATE_POLYGON_MODE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT);
+        AddDynamicState(VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT);
+    }
+#endif
+#ifdef VK_EXT_vertex_input_dynamic_state
+    if (flags & DynamicStateFlag_VertexInput)
+        AddDynamicState(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT);
+#endif
+    return *this;
+}
 
 GraphicsPipeline::ColorAttachmentBuilder::ColorAttachmentBuilder(Builder *builder) : m_Builder(builder)
 {
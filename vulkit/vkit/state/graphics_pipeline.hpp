@@ -11,12 +11,30 @@
 
 namespace VKit
 {
+class PipelineStats;
+class VertexLayout;
+
 using StencilOperationFlags = u8;
 enum StencilOperationFlagBit : StencilOperationFlags
 {
     StencilOperationFlag_Front = 1U << 0,
     StencilOperationFlag_Back = 1U << 1,
 };
+
+// groups of states made dynamic at once with `GraphicsPipeline::Builder::AddDynamicStates()`. each group requires the
+// corresponding extension (or core version) and, for the third one, its per-state features
+using DynamicStateFlags = u8;
+enum DynamicStateFlagBit : DynamicStateFlags
+{
+    // cull mode, front face, primitive topology, depth test, write, compare op and bounds test, stencil test and ops
+    DynamicStateFlag_Extended = 1U << 0,
+    // rasterizer discard, depth bias enable and primitive restart
+    DynamicStateFlag_Extended2 = 1U << 1,
+    // polygon mode, depth clamp, alpha to coverage, color blend enable, color blend equation and color write mask
+    DynamicStateFlag_Extended3 = 1U << 2,
+    // the whole vertex input state, set with a `VertexLayout`
+    DynamicStateFlag_VertexInput = 1U << 3,
+};
 // no pNext hooks for now. must retrieve create info and add them yourself
 class GraphicsPipeline
 {
@@ -72,6 +90,8 @@ class GraphicsPipeline
          * @return A `Result` containing the created `GraphicsPipeline` or an error if the creation fails.
          */
         VKIT_NO_DISCARD Result<GraphicsPipeline> Build() const;
+        // same as `Build()`, but overriding the cache set with `SetCache()`
+        VKIT_NO_DISCARD Result<GraphicsPipeline> Build(VkPipelineCache cache) const;
 
         /**
          * @brief Generates the `VkGraphicsPipelineCreateInfo` object.
@@ -90,6 +110,9 @@ class GraphicsPipeline
         Builder &SetBasePipeline(VkPipeline basePipeline);
         Builder &SetBasePipelineIndex(i32 basePipelineIndex);
         Builder &SetCache(VkPipelineCache cache);
+        // chains creation feedback and records it into `stats` under `name` if the device supports it. both must
+        // outlive the builds
+        Builder &SetStats(PipelineStats *stats, const char *name = nullptr);
 
         // Input Assembly
         Builder &SetTopology(VkPrimitiveTopology topology);
@@ -150,17 +173,25 @@ class GraphicsPipeline
             return *this;
         }
         Builder &AddAttributeDescription(u32 binding, VkFormat format, u32 offset);
+        // replaces every binding and attribute description with the ones of the layout
+        Builder &SetVertexLayout(const VertexLayout &layout);
 
         // Shader Stages
         Builder &AddShaderStage(VkShaderModule module, VkShaderStageFlagBits stage,
                                 VkPipelineShaderStageCreateFlags flags = 0, const VkSpecializationInfo *info = nullptr,
                                 const char *entryPoint = "main");
+        // replaces the specialization info of every already added stage included in `stages`
+        Builder &SetSpecializationInfo(const VkSpecializationInfo *info,
+                                       VkShaderStageFlags stages = VK_SHADER_STAGE_ALL_GRAPHICS);
 
         // Dynamic State
         Builder &AddDynamicState(VkDynamicState state);
+        // states made dynamic are excluded from `PipelineStateKey`, and must be set with `DynamicState` when recording
+        Builder &AddDynamicStates(DynamicStateFlags flags);
 
       private:
         void initialize();
+
         ProxyDevice m_Device;
         VkPipelineLayout m_Layout;
         VkRenderPass m_RenderPass;
@@ -179,6 +210,9 @@ class GraphicsPipeline
         VkPipelineCache m_Cache = VK_NULL_HANDLE;
         i32 m_BasePipelineIndex = -1;
 
+        PipelineStats *m_Stats = nullptr;
+        const char *m_StatsName = nullptr;
+
         u32 m_Subpass;
 
         TKit::TierArray<VkDynamicState> m_DynamicStates{};
@@ -193,6 +227,10 @@ class GraphicsPipeline
         TKit::TierArray<ViewportInfo> m_Viewports{};
 
         friend class ColorAttachmentBuilder;
+        friend class GraphicsPipeline;
+        friend class PipelineLibrary;
+        friend struct PipelineStateKey;
+        friend class ShaderWatcher;
     };
 
     VKIT_NO_DISCARD static Result<> Create(const ProxyDevice &device, TKit::Span<const Builder> builders,
@@ -0,0 +1,193 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/layout_cache.hpp"
+#include "tkit/container/stack_array.hpp"
+
+namespace VKit
+{
+static u64 hashKey(const TKit::TierArray<u64> &key)
+{
+    // fnv-1a over the key words
+    u64 hash = 14695981039346656037ULL;
+    for (const u64 word : key)
+    {
+        hash ^= word;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static bool equalKeys(const TKit::TierArray<u64> &lhs, const TKit::TierArray<u64> &rhs)
+{
+    if (lhs.GetSize() != rhs.GetSize())
+        return false;
+    for (u32 i = 0; i < lhs.GetSize(); ++i)
+        if (lhs[i] != rhs[i])
+            return false;
+    return true;
+}
+
+template <typename Storage>
+static typename Storage::EntryType *find(const Storage &storage, const u64 hash, const TKit::TierArray<u64> &key)
+{
+    const auto [begin, end] = storage.ByKey.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+        if (equalKeys(it->second->Key, key))
+            return it->second;
+    return nullptr;
+}
+
+template <typename Layout, typename Storage, typename Create>
+static Result<Layout> acquire(Storage &storage, std::shared_mutex &mutex, const TKit::TierArray<u64> &key,
+                              const Create &create)
+{
+    const u64 hash = hashKey(key);
+    {
+        std::shared_lock lock{mutex};
+        if (auto *entry = find(storage, hash, key))
+        {
+            entry->References.fetch_add(1, std::memory_order_relaxed);
+            return entry->Layout;
+        }
+    }
+
+    std::unique_lock lock{mutex};
+    // another thread may have created the same layout while no lock was held
+    if (auto *entry = find(storage, hash, key))
+    {
+        entry->References.fetch_add(1, std::memory_order_relaxed);
+        return entry->Layout;
+    }
+
+    const auto result = create();
+    TKIT_RETURN_ON_ERROR(result);
+
+    auto *entry = new typename Storage::EntryType{*result, key, 1};
+    storage.ByKey.emplace(hash, entry);
+    storage.ByHandle.emplace(entry->Layout.GetHandle(), entry);
+    return entry->Layout;
+}
+
+template <typename Storage, typename Handle>
+static void release(Storage &storage, std::shared_mutex &mutex, const Handle handle)
+{
+    std::unique_lock lock{mutex};
+    const auto it = storage.ByHandle.find(handle);
+    TKIT_ASSERT(it != storage.ByHandle.end(), "[VULKIT][LAYOUT-CACHE] The layout to release is not in the cache");
+    if (it == storage.ByHandle.end())
+        return;
+
+    auto *entry = it->second;
+    if (entry->References.fetch_sub(1, std::memory_order_relaxed) != 1)
+        return;
+
+    const auto [begin, end] = storage.ByKey.equal_range(hashKey(entry->Key));
+    for (auto kit = begin; kit != end; ++kit)
+        if (kit->second == entry)
+        {
+            storage.ByKey.erase(kit);
+            break;
+        }
+    storage.ByHandle.erase(it);
+
+    entry->Layout.Destroy();
+    delete entry;
+}
+
+template <typename Storage> static void destroy(Storage &storage)
+{
+    for (const auto &[handle, entry] : storage.ByHandle)
+    {
+        entry->Layout.Destroy();
+        delete entry;
+    }
+    storage.ByHandle.clear();
+    storage.ByKey.clear();
+}
+
+TKit::TierArray<u64> LayoutCache::createKey(const DescriptorSetLayout::Builder &builder)
+{
+    using BindingInfo = DescriptorSetLayout::Builder::BindingInfo;
+    TKit::StackArray<const BindingInfo *> bindings{};
+    bindings.Reserve(builder.m_Bindings.GetSize());
+    for (const auto &kv : builder.m_Bindings)
+        bindings.Append(&kv.Value);
+
+    // the builder stores bindings in a hash map, so they are sorted to get an order independent key
+    std::sort(bindings.begin(), bindings.end(), [](const BindingInfo *lhs, const BindingInfo *rhs) {
+        return lhs->Binding.binding < rhs->Binding.binding;
+    });
+
+    TKit::TierArray<u64> key{};
+    key.Append(builder.m_Flags);
+#ifdef VK_KHR_descriptor_update_template
+    key.Append(builder.m_UpdateTemplate);
+#endif
+    for (const BindingInfo *info : bindings)
+    {
+        key.Append(info->Binding.binding);
+        key.Append(info->Binding.descriptorType);
+        key.Append(info->Binding.descriptorCount);
+        key.Append(info->Binding.stageFlags);
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_EXT_descriptor_indexing)
+        key.Append(info->Flags);
+#endif
+    }
+    return key;
+}
+
+TKit::TierArray<u64> LayoutCache::createKey(const PipelineLayout::Builder &builder)
+{
+    TKit::TierArray<u64> key{};
+    key.Append(builder.m_Flags);
+    key.Append(builder.m_DescriptorSetLayouts.GetSize());
+    for (const VkDescriptorSetLayout layout : builder.m_DescriptorSetLayouts)
+        key.Append(rcast<u64>(layout));
+    for (const VkPushConstantRange &range : builder.m_PushConstantRanges)
+    {
+        key.Append(range.stageFlags);
+        key.Append(range.offset);
+        key.Append(range.size);
+    }
+    return key;
+}
+
+void LayoutCache::Destroy()
+{
+    std::unique_lock lock{m_Mutex};
+    // pipeline layouts go first, as they may reference the set layouts
+    destroy(m_PipelineLayouts);
+    destroy(m_SetLayouts);
+}
+
+Result<DescriptorSetLayout> LayoutCache::AcquireDescriptorSetLayout(const DescriptorSetLayout::Builder &builder)
+{
+    return acquire<DescriptorSetLayout>(m_SetLayouts, m_Mutex, createKey(builder),
+                                        [&builder] { return builder.Build(); });
+}
+Result<PipelineLayout> LayoutCache::AcquirePipelineLayout(const PipelineLayout::Builder &builder)
+{
+    return acquire<PipelineLayout>(m_PipelineLayouts, m_Mutex, createKey(builder),
+                                   [&builder] { return builder.Build(); });
+}
+
+void LayoutCache::ReleaseDescriptorSetLayout(const VkDescriptorSetLayout layout)
+{
+    release(m_SetLayouts, m_Mutex, layout);
+}
+void LayoutCache::ReleasePipelineLayout(const VkPipelineLayout layout)
+{
+    release(m_PipelineLayouts, m_Mutex, layout);
+}
+
+u32 LayoutCache::GetDescriptorSetLayoutCount() const
+{
+    std::shared_lock lock{m_Mutex};
+    return static_cast<u32>(m_SetLayouts.ByHandle.size());
+}
+u32 LayoutCache::GetPipelineLayoutCount() const
+{
+    std::shared_lock lock{m_Mutex};
+    return static_cast<u32>(m_PipelineLayouts.ByHandle.size());
+}
+
+} // namespace VKit
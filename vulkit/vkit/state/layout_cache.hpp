@@ -0,0 +1,79 @@
+#pragma once
+
+#if !defined(VKIT_ENABLE_DESCRIPTORS) || !defined(VKIT_ENABLE_PIPELINE_LAYOUT)
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding features must be enabled in CMake with VULKIT_ENABLE_DESCRIPTORS and VULKIT_ENABLE_PIPELINE_LAYOUT"
+#endif
+
+#include "vkit/state/descriptor_set_layout.hpp"
+#include "vkit/state/pipeline_layout.hpp"
+#include <unordered_map>
+#include <shared_mutex>
+#include <atomic>
+
+namespace VKit
+{
+/**
+ * @brief Interns descriptor set layouts and pipeline layouts so that identical builders share the same Vulkan object.
+ *
+ * Layouts are keyed by their full description: bindings (type, count, stages and binding flags) and creation flags for
+ * set layouts, set layout handles, push constant ranges and flags for pipeline layouts. Because set layouts are
+ * interned, pipeline layouts built from them also compare equal, which keeps them compatible for set rebinding.
+ *
+ * Every successful acquire increases the reference count of the layout, and must be paired with a release. Layouts
+ * returned by the cache must not be destroyed directly. Lookups of existing layouts only take a shared lock, so that
+ * concurrent acquisitions from multiple threads do not serialize.
+ *
+ */
+class LayoutCache
+{
+  public:
+    LayoutCache() = default;
+    LayoutCache(const ProxyDevice &device) : m_Device(device)
+    {
+    }
+
+    LayoutCache(const LayoutCache &) = delete;
+    LayoutCache &operator=(const LayoutCache &) = delete;
+
+    // destroys every cached layout, regardless of its reference count
+    void Destroy();
+
+    VKIT_NO_DISCARD Result<DescriptorSetLayout> AcquireDescriptorSetLayout(const DescriptorSetLayout::Builder &builder);
+    VKIT_NO_DISCARD Result<PipelineLayout> AcquirePipelineLayout(const PipelineLayout::Builder &builder);
+
+    // the layout is destroyed once its reference count reaches zero
+    void ReleaseDescriptorSetLayout(VkDescriptorSetLayout layout);
+    void ReleasePipelineLayout(VkPipelineLayout layout);
+
+    u32 GetDescriptorSetLayoutCount() const;
+    u32 GetPipelineLayoutCount() const;
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+
+  private:
+    template <typename T> struct Entry
+    {
+        T Layout;
+        TKit::TierArray<u64> Key;
+        std::atomic<u32> References;
+    };
+    template <typename T, typename Handle> struct Storage
+    {
+        using EntryType = Entry<T>;
+        std::unordered_multimap<u64, Entry<T> *> ByKey;
+        std::unordered_map<Handle, Entry<T> *> ByHandle;
+    };
+
+    static TKit::TierArray<u64> createKey(const DescriptorSetLayout::Builder &builder);
+    static TKit::TierArray<u64> createKey(const PipelineLayout::Builder &builder);
+
+    ProxyDevice m_Device{};
+    Storage<DescriptorSetLayout, VkDescriptorSetLayout> m_SetLayouts{};
+    Storage<PipelineLayout, VkPipelineLayout> m_PipelineLayouts{};
+    mutable std::shared_mutex m_Mutex{};
+};
+} // namespace VKit
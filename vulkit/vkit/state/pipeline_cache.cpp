@@ -0,0 +1,189 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/pipeline_cache.hpp"
+
+#include <fstream>
+#include <cstring>
+
+namespace VKit
+{
+bool PipelineCache::IsCompatible(const TKit::Span<const std::byte> data, const VkPhysicalDeviceProperties &properties)
+{
+    VkPipelineCacheHeaderVersionOne header;
+    if (data.GetSize() < sizeof(header))
+        return false;
+
+    // the blob comes from disk and carries no alignment guarantees
+    std::memcpy(&header, data.GetData(), sizeof(header));
+    return header.headerSize >= sizeof(header) && header.headerSize <= data.GetSize() &&
+           header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header.vendorID == properties.vendorID &&
+           header.deviceID == properties.deviceID &&
+           std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+static TKit::TierArray<std::byte> readBlob(const std::filesystem::path &path)
+{
+    TKit::TierArray<std::byte> data{};
+    std::ifstream file{path, std::ios::ate | std::ios::binary};
+    if (!file.is_open())
+        return data;
+
+    const auto size = file.tellg();
+    if (size <= 0)
+        return data;
+
+    data.Resize(static_cast<usize>(size));
+    file.seekg(0);
+    file.read(rcast<char *>(data.GetData()), size);
+    if (!file)
+        data.Clear();
+    return data;
+}
+
+Result<PipelineCache> PipelineCache::Builder::Build() const
+{
+    TKit::TierArray<std::byte> data{};
+    if (!m_Path.empty())
+    {
+        data = readBlob(m_Path);
+        const TKit::Span<const std::byte> blob{data.GetData(), data.GetSize()};
+        if (!data.IsEmpty() && !IsCompatible(blob, m_Properties))
+        {
+            TKIT_LOG_WARNING("[VULKIT][PIPELINE-CACHE] The cache at '{}' was created by a different device or driver "
+                             "and will be discarded",
+                             m_Path.string());
+            data.Clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.flags = m_Flags;
+    createInfo.initialDataSize = data.GetSize();
+    createInfo.pInitialData = data.IsEmpty() ? nullptr : data.GetData();
+
+    VkPipelineCache cache;
+    VKIT_RETURN_IF_FAILED(
+        m_Device.Table->CreatePipelineCache(m_Device, &createInfo, m_Device.AllocationCallbacks, &cache),
+        Result<PipelineCache>);
+
+    PipelineCache::Info info{};
+    info.Properties = m_Properties;
+    info.Path = m_Path;
+    info.LoadedSize = data.GetSize();
+    info.Flags = m_Flags;
+    return Result<PipelineCache>::Ok(m_Device, cache, info);
+}
+
+void PipelineCache::Destroy()
+{
+    if (m_Cache)
+    {
+        m_Device.Table->DestroyPipelineCache(m_Device, m_Cache, m_Device.AllocationCallbacks);
+        m_Cache = VK_NULL_HANDLE;
+    }
+}
+
+Result<TKit::TierArray<std::byte>> PipelineCache::GetData() const
+{
+    using Res = Result<TKit::TierArray<std::byte>>;
+    TKit::TierArray<std::byte> data{};
+    for (;;)
+    {
+        size_t size;
+        VKIT_RETURN_IF_FAILED(m_Device.Table->GetPipelineCacheData(m_Device, m_Cache, &size, nullptr), Res);
+        data.Resize(static_cast<usize>(size));
+
+        // other threads may keep adding to the cache between both calls. if it outgrew the buffer, the driver writes
+        // what fits and returns VK_INCOMPLETE, so the query is repeated with the new size
+        const VkResult result = m_Device.Table->GetPipelineCacheData(m_Device, m_Cache, &size, data.GetData());
+        if (result == VK_INCOMPLETE)
+            continue;
+        VKIT_RETURN_ON_ERROR(result, Res);
+
+        // the size may also shrink
+        data.Resize(static_cast<usize>(size));
+        return data;
+    }
+}
+
+Result<> PipelineCache::Save() const
+{
+    if (m_Info.Path.empty())
+        return Result<>::Error(Error_BadInput,
+                               "[VULKIT][PIPELINE-CACHE] The cache was built without a path. Use Save(path) instead");
+    return Save(m_Info.Path);
+}
+
+Result<> PipelineCache::Save(const std::filesystem::path &destination) const
+{
+    const auto result = GetData();
+    TKIT_RETURN_ON_ERROR(result);
+    const TKit::TierArray<std::byte> &data = *result;
+
+    std::filesystem::path temporary = destination;
+    temporary += ".tmp";
+
+    {
+        std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+        if (!file.is_open())
+            return Result<>::Error(Error_FileWriteFailed,
+                                   TKit::TierString::Format("[VULKIT][PIPELINE-CACHE] Failed to open '{}' for writing",
+                                                            temporary.string()));
+
+        file.write(rcast<const char *>(data.GetData()), static_cast<std::streamsize>(data.GetSize()));
+        file.flush();
+        if (!file)
+        {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(temporary, ec);
+            return Result<>::Error(Error_FileWriteFailed,
+                                   TKit::TierString::Format("[VULKIT][PIPELINE-CACHE] Failed to write {} bytes to '{}'",
+                                                            data.GetSize(), temporary.string()));
+        }
+    }
+
+    // renaming replaces the destination in a single step, so readers never observe a partially written cache
+    std::error_code ec;
+    std::filesystem::rename(temporary, destination, ec);
+    if (ec)
+    {
+        std::filesystem::remove(temporary, ec);
+        return Result<>::Error(Error_FileWriteFailed,
+                               TKit::TierString::Format("[VULKIT][PIPELINE-CACHE] Failed to move the cache to '{}'",
+                                                        destination.string()));
+    }
+    return Result<>::Ok();
+}
+
+Result<> PipelineCache::Merge(const TKit::Span<const VkPipelineCache> caches)
+{
+    if (caches.GetSize() == 0)
+        return Result<>::Ok();
+    VKIT_RETURN_IF_FAILED(m_Device.Table->MergePipelineCaches(m_Device, m_Cache, caches.GetSize(), caches.GetData()),
+                          Result<>);
+    return Result<>::Ok();
+}
+
+PipelineCache::Builder &PipelineCache::Builder::SetPath(const std::filesystem::path &path)
+{
+    m_Path = path;
+    return *this;
+}
+PipelineCache::Builder &PipelineCache::Builder::SetFlags(const VkPipelineCacheCreateFlags flags)
+{
+    m_Flags = flags;
+    return *this;
+}
+PipelineCache::Builder &PipelineCache::Builder::AddFlags(const VkPipelineCacheCreateFlags flags)
+{
+    m_Flags |= flags;
+    return *this;
+}
+PipelineCache::Builder &PipelineCache::Builder::RemoveFlags(const VkPipelineCacheCreateFlags flags)
+{
+    m_Flags &= ~flags;
+    return *this;
+}
+
+} // namespace VKit
@@ -0,0 +1,111 @@
+#pragma once
+
+#if !defined(VKIT_ENABLE_PIPELINE_CACHE) || !defined(VKIT_ENABLE_PHYSICAL_DEVICE)
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding features must be enabled in CMake with VULKIT_ENABLE_PIPELINE_CACHE and VULKIT_ENABLE_PHYSICAL_DEVICE"
+#endif
+
+#include "vkit/device/proxy_device.hpp"
+#include "vkit/device/physical_device.hpp"
+#include "tkit/container/span.hpp"
+#include <filesystem>
+
+namespace VKit
+{
+/**
+ * @brief A `VkPipelineCache` that can be persisted to disk.
+ *
+ * When built with a path, the blob stored there is loaded only if its `VkPipelineCacheHeaderVersionOne` header matches
+ * the vendor, device and pipeline cache UUID of the device the cache is created for. Otherwise, the blob is discarded
+ * and the cache starts empty, so that a stale or foreign file never reaches the driver.
+ *
+ * Saving writes to a temporary file next to the destination and renames it afterwards, so that an interrupted write
+ * never leaves a truncated cache behind.
+ *
+ */
+class PipelineCache
+{
+  public:
+    class Builder
+    {
+      public:
+        Builder(const ProxyDevice &device, const DeviceProperties &properties)
+            : m_Device(device), m_Properties(properties.Core)
+        {
+        }
+
+        VKIT_NO_DISCARD Result<PipelineCache> Build() const;
+
+        // a missing or incompatible file is not an error. the cache will just start empty
+        Builder &SetPath(const std::filesystem::path &path);
+
+        Builder &SetFlags(VkPipelineCacheCreateFlags flags);
+        Builder &AddFlags(VkPipelineCacheCreateFlags flags);
+        Builder &RemoveFlags(VkPipelineCacheCreateFlags flags);
+
+      private:
+        ProxyDevice m_Device;
+        VkPhysicalDeviceProperties m_Properties;
+        std::filesystem::path m_Path{};
+        VkPipelineCacheCreateFlags m_Flags = 0;
+    };
+
+    struct Info
+    {
+        VkPhysicalDeviceProperties Properties;
+        // empty if the cache was built without a path
+        std::filesystem::path Path;
+        // size of the blob the cache was initialized with. zero if nothing was loaded
+        usize LoadedSize;
+        VkPipelineCacheCreateFlags Flags;
+    };
+
+    // whether the header of the blob was produced by a device compatible with the given properties
+    static bool IsCompatible(TKit::Span<const std::byte> data, const VkPhysicalDeviceProperties &properties);
+
+    PipelineCache() = default;
+    PipelineCache(const ProxyDevice &device, const VkPipelineCache cache, const Info &info)
+        : m_Device(device), m_Cache(cache), m_Info(info)
+    {
+    }
+
+    void Destroy();
+
+    VKIT_NO_DISCARD Result<TKit::TierArray<std::byte>> GetData() const;
+
+    // saves to the path the cache was built with
+    VKIT_NO_DISCARD Result<> Save() const;
+    VKIT_NO_DISCARD Result<> Save(const std::filesystem::path &path) const;
+
+    // merges the contents of other caches, typically per-thread ones, into this one
+    VKIT_NO_DISCARD Result<> Merge(TKit::Span<const VkPipelineCache> caches);
+
+    VKIT_SET_DEBUG_NAME(m_Cache, VK_OBJECT_TYPE_PIPELINE_CACHE)
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    const Info &GetInfo() const
+    {
+        return m_Info;
+    }
+    VkPipelineCache GetHandle() const
+    {
+        return m_Cache;
+    }
+    operator VkPipelineCache() const
+    {
+        return m_Cache;
+    }
+    operator bool() const
+    {
+        return m_Cache != VK_NULL_HANDLE;
+    }
+
+  private:
+    ProxyDevice m_Device{};
+    VkPipelineCache m_Cache = VK_NULL_HANDLE;
+    Info m_Info;
+};
+} // namespace VKit
@@ -0,0 +1,142 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/pipeline_compiler.hpp"
+
+namespace VKit
+{
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+static Result<GraphicsPipeline> createPipeline(const ProxyDevice &, const VkPipelineCache cache,
+                                               const GraphicsPipeline::Builder &builder)
+{
+    return builder.Build(cache);
+}
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+static Result<ComputePipeline> createPipeline(const ProxyDevice &device, const VkPipelineCache cache,
+                                              const ComputePipelineSpecs &specs)
+{
+    ComputePipelineSpecs spc = specs;
+    spc.Cache = cache;
+    return ComputePipeline::Create(device, spc);
+}
+#endif
+
+PipelineCompiler::PipelineCompiler(const ProxyDevice &device, const u32 workerCount)
+    : m_Device(device), m_WorkerCount(workerCount)
+{
+    if (m_WorkerCount == 0)
+        m_WorkerCount = std::max(1U, std::thread::hardware_concurrency());
+}
+
+PipelineCompiler::~PipelineCompiler()
+{
+    join();
+}
+
+template <typename T, typename Input>
+Result<> PipelineCompiler::dispatch(const TKit::Span<const Input> inputs,
+                                    const TKit::Span<std::future<Compilation<T>>> futures)
+{
+    TKIT_ASSERT(inputs.GetSize() == futures.GetSize(),
+                "[VULKIT][PIPELINE-COMPILER] Inputs size ({}) and futures size ({}) must be equal", inputs.GetSize(),
+                futures.GetSize());
+
+    const u32 count = inputs.GetSize();
+    if (count == 0)
+        return Result<>::Ok();
+
+    if (m_Caches.IsEmpty())
+    {
+        VkPipelineCacheCreateInfo cacheInfo{};
+        cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        for (u32 i = 0; i < m_WorkerCount; ++i)
+        {
+            VkPipelineCache cache;
+            VKIT_RETURN_IF_FAILED(
+                m_Device.Table->CreatePipelineCache(m_Device, &cacheInfo, m_Device.AllocationCallbacks, &cache),
+                Result<>, destroyCaches());
+            m_Caches.Append(cache);
+        }
+    }
+
+    const u32 workers = std::min(m_WorkerCount, count);
+    const u32 shardSize = count / workers;
+    const u32 remainder = count % workers;
+
+    u32 start = 0;
+    for (u32 i = 0; i < workers; ++i)
+    {
+        // the first shards take one extra element each so that the remainder is spread evenly
+        const u32 size = shardSize + (i < remainder ? 1 : 0);
+
+        TKit::TierArray<std::promise<Compilation<T>>> promises{};
+        promises.Reserve(size);
+        for (u32 j = 0; j < size; ++j)
+        {
+            promises.Append();
+            futures[start + j] = promises[j].get_future();
+        }
+
+        const Input *shard = inputs.GetData() + start;
+        m_Threads.Append([device = m_Device, cache = m_Caches[i], shard, promises = std::move(promises)]() mutable {
+            for (u32 j = 0; j < promises.GetSize(); ++j)
+            {
+                const auto begin = std::chrono::steady_clock::now();
+                Result<T> result = createPipeline(device, cache, shard[j]);
+                const auto end = std::chrono::steady_clock::now();
+                promises[j].set_value(Compilation<T>{std::move(result), end - begin});
+            }
+        });
+        start += size;
+    }
+    return Result<>::Ok();
+}
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+Result<> PipelineCompiler::Compile(const TKit::Span<const GraphicsPipeline::Builder> builders,
+                                   const TKit::Span<GraphicsFuture> futures)
+{
+    return dispatch<GraphicsPipeline>(builders, futures);
+}
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+Result<> PipelineCompiler::Compile(const TKit::Span<const ComputePipelineSpecs> specs,
+                                   const TKit::Span<ComputeFuture> futures)
+{
+    return dispatch<ComputePipeline>(specs, futures);
+}
+#endif
+
+Result<> PipelineCompiler::Finish(const VkPipelineCache cache)
+{
+    join();
+    if (cache && !m_Caches.IsEmpty())
+        VKIT_RETURN_IF_FAILED(
+            m_Device.Table->MergePipelineCaches(m_Device, cache, m_Caches.GetSize(), m_Caches.GetData()), Result<>,
+            destroyCaches());
+
+    destroyCaches();
+    return Result<>::Ok();
+}
+
+void PipelineCompiler::Destroy()
+{
+    join();
+    destroyCaches();
+}
+
+void PipelineCompiler::join()
+{
+    for (std::thread &thread : m_Threads)
+        if (thread.joinable())
+            thread.join();
+    m_Threads.Clear();
+}
+
+void PipelineCompiler::destroyCaches()
+{
+    for (const VkPipelineCache cache : m_Caches)
+        m_Device.Table->DestroyPipelineCache(m_Device, cache, m_Device.AllocationCallbacks);
+    m_Caches.Clear();
+}
+
+} // namespace VKit
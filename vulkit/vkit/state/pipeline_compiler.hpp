@@ -0,0 +1,88 @@
+#pragma once
+
+#if !defined(VKIT_ENABLE_GRAPHICS_PIPELINE) && !defined(VKIT_ENABLE_COMPUTE_PIPELINE)
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding features must be enabled in CMake with VULKIT_ENABLE_GRAPHICS_PIPELINE or VULKIT_ENABLE_COMPUTE_PIPELINE"
+#endif
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+#    include "vkit/state/graphics_pipeline.hpp"
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+#    include "vkit/state/compute_pipeline.hpp"
+#endif
+#include "tkit/container/span.hpp"
+#include <future>
+
+namespace VKit
+{
+/**
+ * @brief Compiles batches of pipelines on a set of worker threads.
+ *
+ * Every batch is split into contiguous shards, one per worker. Each worker owns a `VkPipelineCache` so that workers
+ * never contend on the same cache, and those caches are merged into a destination cache when calling `Finish()`.
+ *
+ * Pipelines are created one at a time so that each one gets its own future and compile time. The builders or specs
+ * passed to `Compile()` must stay alive (and, for graphics pipelines, baked) until their futures are ready.
+ *
+ */
+class PipelineCompiler
+{
+  public:
+    template <typename T> struct Compilation
+    {
+        Result<T> Pipeline;
+        std::chrono::nanoseconds CompileTime;
+    };
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    using GraphicsFuture = std::future<Compilation<GraphicsPipeline>>;
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    using ComputeFuture = std::future<Compilation<ComputePipeline>>;
+#endif
+
+    PipelineCompiler() = default;
+    // a worker count of zero uses as many workers as hardware threads
+    PipelineCompiler(const ProxyDevice &device, u32 workerCount = 0);
+
+    PipelineCompiler(const PipelineCompiler &) = delete;
+    PipelineCompiler &operator=(const PipelineCompiler &) = delete;
+
+    ~PipelineCompiler();
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    VKIT_NO_DISCARD Result<> Compile(TKit::Span<const GraphicsPipeline::Builder> builders,
+                                     TKit::Span<GraphicsFuture> futures);
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    VKIT_NO_DISCARD Result<> Compile(TKit::Span<const ComputePipelineSpecs> specs, TKit::Span<ComputeFuture> futures);
+#endif
+
+    // waits for every worker to finish and merges the per-worker caches into `cache`, if provided
+    VKIT_NO_DISCARD Result<> Finish(VkPipelineCache cache = VK_NULL_HANDLE);
+
+    // waits for every worker to finish and discards the per-worker caches
+    void Destroy();
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    u32 GetWorkerCount() const
+    {
+        return m_WorkerCount;
+    }
+
+  private:
+    template <typename T, typename Input>
+    Result<> dispatch(TKit::Span<const Input> inputs, TKit::Span<std::future<Compilation<T>>> futures);
+
+    void join();
+    void destroyCaches();
+
+    ProxyDevice m_Device{};
+    u32 m_WorkerCount = 0;
+    TKit::TierArray<VkPipelineCache> m_Caches{};
+    TKit::TierArray<std::thread> m_Threads{};
+};
+} // namespace VKit
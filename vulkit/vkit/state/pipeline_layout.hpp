@@ -33,6 +33,8 @@ class PipelineLayout
         Builder &RemoveFlags(VkPipelineLayoutCreateFlags flags);
 
       private:
+        friend class LayoutCache;
+
         ProxyDevice m_Device;
 
         TKit::TierArray<VkDescriptorSetLayout> m_DescriptorSetLayouts;
@@ -0,0 +1,369 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/pipeline_library.hpp"
+#include "tkit/container/stack_array.hpp"
+
+#include <cstring>
+
+#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+namespace VKit
+{
+namespace
+{
+// fnv-1a. good enough to tell apart pipeline states, and cheap compared to compiling a library
+class Hasher
+{
+  public:
+    void Add(const u64 value)
+    {
+        AddBytes(&value, sizeof(value));
+    }
+    // only for structs without pointers, as those would hash addresses instead of contents
+    void AddBytes(const void *data, const usize size)
+    {
+        const auto *bytes = scast<const u8 *>(data);
+        for (usize i = 0; i < size; ++i)
+        {
+            m_Hash ^= bytes[i];
+            m_Hash *= 1099511628211ULL;
+        }
+    }
+    template <typename T> void AddArray(const TKit::TierArray<T> &array)
+    {
+        Add(array.GetSize());
+        if (!array.IsEmpty())
+            AddBytes(array.GetData(), array.GetSize() * sizeof(T));
+    }
+
+    u64 Get() const
+    {
+        return m_Hash;
+    }
+
+  private:
+    u64 m_Hash = 14695981039346656037ULL;
+};
+} // namespace
+
+static VkGraphicsPipelineLibraryFlagsEXT getLibraryFlag(const PipelineLibraryType type)
+{
+    switch (type)
+    {
+    case PipelineLibrary_VertexInput:
+        return VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+    case PipelineLibrary_PreRasterization:
+        return VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+    case PipelineLibrary_FragmentShader:
+        return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+    case PipelineLibrary_FragmentOutput:
+        return VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+    default:
+        TKIT_FATAL("[VULKIT][PIPELINE-LIBRARY] Unknown library type");
+        return 0;
+    }
+}
+
+static bool belongsToLibrary(const VkShaderStageFlagBits stage, const PipelineLibraryType type)
+{
+    if (type == PipelineLibrary_FragmentShader)
+        return stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+    if (type == PipelineLibrary_PreRasterization)
+        return stage != VK_SHADER_STAGE_FRAGMENT_BIT;
+    return false;
+}
+
+u64 PipelineLibrary::hashLibrary(const GraphicsPipeline::Builder &builder, const PipelineLibraryType type)
+{
+    Hasher hasher{};
+    hasher.Add(type);
+    hasher.AddArray(builder.m_DynamicStates);
+
+    const auto addRenderTarget = [&builder, &hasher] {
+        hasher.Add(rcast<u64>(builder.m_RenderPass));
+        hasher.Add(builder.m_Subpass);
+        if (builder.m_RenderPass)
+            return;
+        const VkPipelineRenderingCreateInfoKHR &info = builder.m_RenderingInfo;
+        hasher.Add(info.viewMask);
+        hasher.Add(info.colorAttachmentCount);
+        if (info.colorAttachmentCount > 0)
+            hasher.AddBytes(info.pColorAttachmentFormats, info.colorAttachmentCount * sizeof(VkFormat));
+        hasher.Add(info.depthAttachmentFormat);
+        hasher.Add(info.stencilAttachmentFormat);
+    };
+    const auto addStages = [&builder, &hasher, type] {
+        for (const VkPipelineShaderStageCreateInfo &stage : builder.m_ShaderStages)
+        {
+            if (!belongsToLibrary(stage.stage, type))
+                continue;
+            hasher.Add(stage.stage);
+            hasher.Add(stage.flags);
+            hasher.Add(rcast<u64>(stage.module));
+            hasher.AddBytes(stage.pName, std::strlen(stage.pName));
+            if (const VkSpecializationInfo *spec = stage.pSpecializationInfo)
+            {
+                hasher.AddBytes(spec->pMapEntries, spec->mapEntryCount * sizeof(VkSpecializationMapEntry));
+                hasher.AddBytes(spec->pData, spec->dataSize);
+            }
+        }
+    };
+    const auto addMultisample = [&builder, &hasher] {
+        const VkPipelineMultisampleStateCreateInfo &info = builder.m_MultisampleInfo;
+        hasher.Add(info.rasterizationSamples);
+        hasher.Add(info.sampleShadingEnable);
+        hasher.AddBytes(&info.minSampleShading, sizeof(f32));
+        hasher.Add(info.alphaToCoverageEnable);
+        hasher.Add(info.alphaToOneEnable);
+        if (info.pSampleMask)
+            hasher.AddBytes(info.pSampleMask, ((info.rasterizationSamples + 31) / 32) * sizeof(VkSampleMask));
+    };
+
+    switch (type)
+    {
+    case PipelineLibrary_VertexInput:
+        hasher.Add(builder.m_InputAssemblyInfo.topology);
+        hasher.Add(builder.m_InputAssemblyInfo.primitiveRestartEnable);
+        hasher.AddArray(builder.m_BindingDescriptions);
+        hasher.AddArray(builder.m_AttributeDescriptions);
+        break;
+    case PipelineLibrary_PreRasterization: {
+        const VkPipelineRasterizationStateCreateInfo &raster = builder.m_RasterizationInfo;
+        hasher.Add(rcast<u64>(builder.m_Layout));
+        addRenderTarget();
+        addStages();
+        hasher.Add(builder.m_ViewportInfo.viewportCount);
+        hasher.AddArray(builder.m_Viewports);
+        hasher.Add(raster.depthClampEnable);
+        hasher.Add(raster.rasterizerDiscardEnable);
+        hasher.Add(raster.polygonMode);
+        hasher.Add(raster.cullMode);
+        hasher.Add(raster.frontFace);
+        hasher.Add(raster.depthBiasEnable);
+        hasher.AddBytes(&raster.depthBiasConstantFactor, 4 * sizeof(f32));
+        break;
+    }
+    case PipelineLibrary_FragmentShader: {
+        const VkPipelineDepthStencilStateCreateInfo &ds = builder.m_DepthStencilInfo;
+        hasher.Add(rcast<u64>(builder.m_Layout));
+        addRenderTarget();
+        addStages();
+        addMultisample();
+        hasher.Add(ds.depthTestEnable);
+        hasher.Add(ds.depthWriteEnable);
+        hasher.Add(ds.depthCompareOp);
+        hasher.Add(ds.depthBoundsTestEnable);
+        hasher.Add(ds.stencilTestEnable);
+        hasher.AddBytes(&ds.front, sizeof(VkStencilOpState));
+        hasher.AddBytes(&ds.back, sizeof(VkStencilOpState));
+        hasher.AddBytes(&ds.minDepthBounds, 2 * sizeof(f32));
+        break;
+    }
+    case PipelineLibrary_FragmentOutput: {
+        const VkPipelineColorBlendStateCreateInfo &blend = builder.m_ColorBlendInfo;
+        addRenderTarget();
+        addMultisample();
+        hasher.Add(blend.logicOpEnable);
+        hasher.Add(blend.logicOp);
+        hasher.AddBytes(blend.blendConstants, 4 * sizeof(f32));
+        hasher.AddArray(builder.m_ColorAttachments);
+        break;
+    }
+    default:
+        TKIT_FATAL("[VULKIT][PIPELINE-LIBRARY] Unknown library type");
+    }
+    return hasher.Get();
+}
+
+VkResult PipelineLibrary::createLibrary(const GraphicsPipeline::Builder &builder, const PipelineLibraryType type,
+                                        const VkPipelineCache cache, VkPipeline *library)
+{
+    VkGraphicsPipelineCreateInfo pipelineInfo = builder.CreatePipelineInfo();
+
+    // state that does not belong to the library is ignored by the driver, but shader stages must be filtered out
+    TKit::StackArray<VkPipelineShaderStageCreateInfo> stages{};
+    stages.Reserve(builder.m_ShaderStages.GetSize());
+    for (const VkPipelineShaderStageCreateInfo &stage : builder.m_ShaderStages)
+        if (belongsToLibrary(stage.stage, type))
+            stages.Append(stage);
+
+    pipelineInfo.stageCount = stages.GetSize();
+    pipelineInfo.pStages = stages.IsEmpty() ? nullptr : stages.GetData();
+    pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+    pipelineInfo.basePipelineIndex = -1;
+    pipelineInfo.flags |=
+        VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+    VkGraphicsPipelineLibraryCreateInfoEXT libraryInfo{};
+    libraryInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    libraryInfo.flags = getLibraryFlag(type);
+    libraryInfo.pNext = const_cast<void *>(pipelineInfo.pNext);
+    pipelineInfo.pNext = &libraryInfo;
+
+    const ProxyDevice &device = builder.m_Device;
+    return device.Table->CreateGraphicsPipelines(device, cache, 1, &pipelineInfo, device.AllocationCallbacks,
+                                                 library);
+}
+
+static Result<GraphicsPipeline> linkPipeline(const ProxyDevice &device, const VkPipelineCache cache,
+                                             const VkPipelineLayout layout, const VkPipeline *libraries,
+                                             const VkPipelineCreateFlags flags)
+{
+    VkPipelineLibraryCreateInfoKHR libraryInfo{};
+    libraryInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    libraryInfo.libraryCount = PipelineLibrary_Count;
+    libraryInfo.pLibraries = libraries;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.pNext = &libraryInfo;
+    pipelineInfo.flags = flags;
+    pipelineInfo.layout = layout;
+    pipelineInfo.basePipelineIndex = -1;
+
+    VkPipeline pipeline;
+    VKIT_RETURN_IF_FAILED(
+        device.Table->CreateGraphicsPipelines(device, cache, 1, &pipelineInfo, device.AllocationCallbacks, &pipeline),
+        Result<GraphicsPipeline>);
+    return Result<GraphicsPipeline>::Ok(device, pipeline);
+}
+
+PipelineLibrary::~PipelineLibrary()
+{
+    // background links reference the libraries, so they must finish before anything goes away
+    for (Linked &linked : m_Linked)
+        if (linked.Optimized.valid())
+            linked.Optimized.wait();
+}
+
+void PipelineLibrary::Destroy()
+{
+    std::scoped_lock lock{m_Mutex};
+    for (Linked &linked : m_Linked)
+    {
+        if (linked.Optimized.valid())
+        {
+            auto result = linked.Optimized.get();
+            if (result)
+                result->Destroy();
+        }
+        linked.Pipeline.Destroy();
+    }
+    for (Retired &retired : m_Retired)
+        retired.Pipeline.Destroy();
+    for (auto &libraries : m_Libraries)
+    {
+        for (const auto &[hash, library] : libraries)
+            m_Device.Table->DestroyPipeline(m_Device, library, m_Device.AllocationCallbacks);
+        libraries.clear();
+    }
+    m_Linked.Clear();
+    m_Retired.Clear();
+}
+
+Result<VkPipeline> PipelineLibrary::getLibrary(const GraphicsPipeline::Builder &builder,
+                                               const PipelineLibraryType type)
+{
+    // 64 bit hashes are used as keys directly. a collision would need billions of distinct library states
+    const u64 hash = hashLibrary(builder, type);
+    auto &libraries = m_Libraries[type];
+    if (const auto it = libraries.find(hash); it != libraries.end())
+        return it->second;
+
+    VkPipeline library;
+    VKIT_RETURN_IF_FAILED(createLibrary(builder, type, m_Cache, &library), Result<VkPipeline>);
+    libraries.emplace(hash, library);
+    return library;
+}
+
+Result<u32> PipelineLibrary::Link(const GraphicsPipeline::Builder &builder, const bool optimize)
+{
+    std::scoped_lock lock{m_Mutex};
+
+    TKit::FixedArray<VkPipeline, PipelineLibrary_Count> libraries;
+    for (u32 i = 0; i < PipelineLibrary_Count; ++i)
+    {
+        const auto result = getLibrary(builder, static_cast<PipelineLibraryType>(i));
+        TKIT_RETURN_ON_ERROR(result);
+        libraries[i] = *result;
+    }
+
+    const auto result = linkPipeline(m_Device, m_Cache, builder.m_Layout, libraries.GetData(), 0);
+    TKIT_RETURN_ON_ERROR(result);
+
+    Linked &linked = m_Linked.Append();
+    linked.Pipeline = *result;
+    linked.IsOptimized = false;
+    if (optimize)
+        linked.Optimized =
+            std::async(std::launch::async, [device = m_Device, cache = m_Cache, layout = builder.m_Layout, libraries] {
+                return linkPipeline(device, cache, layout, libraries.GetData(),
+                                    VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+            });
+
+    return m_Linked.GetSize() - 1;
+}
+
+GraphicsPipeline PipelineLibrary::GetPipeline(const u32 id) const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Linked[id].Pipeline;
+}
+bool PipelineLibrary::IsOptimized(const u32 id) const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Linked[id].IsOptimized;
+}
+
+u32 PipelineLibrary::Update(const u64 timeline)
+{
+    std::scoped_lock lock{m_Mutex};
+    u32 swapped = 0;
+    for (Linked &linked : m_Linked)
+    {
+        if (!linked.Optimized.valid() ||
+            linked.Optimized.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+
+        const auto result = linked.Optimized.get();
+        if (!result)
+        {
+            // the fast-linked pipeline remains perfectly usable
+            TKIT_LOG_WARNING("[VULKIT][PIPELINE-LIBRARY] Failed to build an optimized pipeline: {}",
+                             result.GetError().ToString());
+            continue;
+        }
+
+        m_Retired.Append(Retired{linked.Pipeline, timeline});
+        linked.Pipeline = *result;
+        linked.IsOptimized = true;
+        ++swapped;
+    }
+    return swapped;
+}
+
+void PipelineLibrary::Reclaim(const u64 completedTimeline)
+{
+    std::scoped_lock lock{m_Mutex};
+    u32 pending = 0;
+    for (Retired &retired : m_Retired)
+    {
+        if (retired.Timeline <= completedTimeline)
+            retired.Pipeline.Destroy();
+        else
+            m_Retired[pending++] = retired;
+    }
+    m_Retired.Resize(pending);
+}
+
+u32 PipelineLibrary::GetLibraryCount(const PipelineLibraryType type) const
+{
+    std::scoped_lock lock{m_Mutex};
+    return static_cast<u32>(m_Libraries[type].size());
+}
+u32 PipelineLibrary::GetRetiredCount() const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Retired.GetSize();
+}
+
+} // namespace VKit
+#endif
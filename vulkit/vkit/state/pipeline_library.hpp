@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_GRAPHICS_PIPELINE
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_GRAPHICS_PIPELINE"
+#endif
+
+#include "vkit/state/graphics_pipeline.hpp"
+#include "tkit/container/fixed_array.hpp"
+#include <unordered_map>
+#include <future>
+#include <mutex>
+
+#if defined(VK_EXT_graphics_pipeline_library) && defined(VK_KHR_pipeline_library)
+namespace VKit
+{
+enum PipelineLibraryType : u8
+{
+    PipelineLibrary_VertexInput,
+    PipelineLibrary_PreRasterization,
+    PipelineLibrary_FragmentShader,
+    PipelineLibrary_FragmentOutput,
+    PipelineLibrary_Count
+};
+
+/**
+ * @brief Builds graphics pipelines out of `VK_EXT_graphics_pipeline_library` parts.
+ *
+ * The state of a `GraphicsPipeline::Builder` is split into the four library parts: vertex input, pre-rasterization,
+ * fragment shader and fragment output. Each part is hashed and cached on its own, so that a new permutation only
+ * compiles the parts that actually changed. Complete pipelines are then linked from the cached parts, which is cheap
+ * enough to happen when a new material first shows up.
+ *
+ * When requested, an optimized pipeline is linked with `VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT` on a
+ * background thread. `Update()` swaps it in place of the fast-linked one once ready, and the replaced pipeline is
+ * destroyed in `Reclaim()` once the GPU no longer uses it, following the same timeline scheme as `BindlessHeap`.
+ *
+ * Requires the `graphicsPipelineLibrary` feature. Builders must be baked before linking.
+ *
+ */
+class PipelineLibrary
+{
+  public:
+    PipelineLibrary() = default;
+    PipelineLibrary(const ProxyDevice &device, VkPipelineCache cache = VK_NULL_HANDLE)
+        : m_Device(device), m_Cache(cache)
+    {
+    }
+
+    PipelineLibrary(const PipelineLibrary &) = delete;
+    PipelineLibrary &operator=(const PipelineLibrary &) = delete;
+
+    ~PipelineLibrary();
+
+    // waits for pending optimizations and destroys every library and linked pipeline
+    void Destroy();
+
+    /**
+     * @brief Link a pipeline from the library parts of the builder, creating the ones that are not cached yet.
+     *
+     * @param builder The baked builder describing the pipeline.
+     * @param optimize Whether to also build a link-time optimized pipeline in the background.
+     * @return An id that can be used with `GetPipeline()`.
+     */
+    VKIT_NO_DISCARD Result<u32> Link(const GraphicsPipeline::Builder &builder, bool optimize = true);
+
+    // the best pipeline available for the id: the optimized one if it is ready and has been swapped in
+    GraphicsPipeline GetPipeline(u32 id) const;
+    bool IsOptimized(u32 id) const;
+
+    // swaps in optimized pipelines that have finished. the replaced ones are retired with `timeline`. returns the
+    // amount of pipelines swapped
+    u32 Update(u64 timeline);
+    // destroys every retired pipeline whose timeline value is less or equal than `completedTimeline`
+    void Reclaim(u64 completedTimeline);
+
+    u32 GetLibraryCount(PipelineLibraryType type) const;
+    // the amount of replaced pipelines still waiting for `Reclaim()`
+    u32 GetRetiredCount() const;
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+
+  private:
+    struct Linked
+    {
+        GraphicsPipeline Pipeline;
+        std::future<Result<GraphicsPipeline>> Optimized;
+        bool IsOptimized;
+    };
+    struct Retired
+    {
+        GraphicsPipeline Pipeline;
+        u64 Timeline;
+    };
+
+    Result<VkPipeline> getLibrary(const GraphicsPipeline::Builder &builder, PipelineLibraryType type);
+
+    static u64 hashLibrary(const GraphicsPipeline::Builder &builder, PipelineLibraryType type);
+    static VkResult createLibrary(const GraphicsPipeline::Builder &builder, PipelineLibraryType type,
+                                  VkPipelineCache cache, VkPipeline *library);
+
+    ProxyDevice m_Device{};
+    VkPipelineCache m_Cache = VK_NULL_HANDLE;
+
+    TKit::FixedArray<std::unordered_map<u64, VkPipeline>, PipelineLibrary_Count> m_Libraries{};
+    TKit::TierArray<Linked> m_Linked{};
+    TKit::TierArray<Retired> m_Retired{};
+    mutable std::mutex m_Mutex{};
+};
+} // namespace VKit
+#endif
@@ -0,0 +1,356 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/pipeline_state_key.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace VKit
+{
+static u64 hashBytes(const void *data, const usize size)
+{
+    // fnv-1a
+    u64 hash = 14695981039346656037ULL;
+    const auto *bytes = scast<const u8 *>(data);
+    for (usize i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static VkPrimitiveTopology getTopologyClass(const VkPrimitiveTopology topology)
+{
+    switch (topology)
+    {
+    case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+        return VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+    case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+    case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+    case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+    case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+        return VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+    case VK_PRIMITIVE_TOPOLOGY_PATCH_LIST:
+        return VK_PRIMITIVE_TOPOLOGY_PATCH_LIST;
+    default:
+        return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    }
+}
+
+// zeroes the parts of the key the driver ignores because they are set at record time instead
+static void clearDynamicState(PipelineStateKey &key, const VkDynamicState state)
+{
+    const auto forEachStencil = [&key](const auto &fun) {
+        fun(key.StencilFront);
+        fun(key.StencilBack);
+    };
+    const auto forEachAttachment = [&key](const auto &fun) {
+        for (u32 i = 0; i < key.ColorAttachmentCount; ++i)
+            fun(key.ColorAttachments[i]);
+    };
+
+    switch (state)
+    {
+    case VK_DYNAMIC_STATE_LINE_WIDTH:
+        key.LineWidth = 0.f;
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_BIAS:
+        key.DepthBiasConstantFactor = 0.f;
+        key.DepthBiasClamp = 0.f;
+        key.DepthBiasSlopeFactor = 0.f;
+        break;
+    case VK_DYNAMIC_STATE_BLEND_CONSTANTS:
+        for (u32 i = 0; i < 4; ++i)
+            key.BlendConstants[i] = 0.f;
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_BOUNDS:
+        key.MinDepthBounds = 0.f;
+        key.MaxDepthBounds = 0.f;
+        break;
+    case VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK:
+        forEachStencil([](VkStencilOpState &op) { op.compareMask = 0; });
+        break;
+    case VK_DYNAMIC_STATE_STENCIL_WRITE_MASK:
+        forEachStencil([](VkStencilOpState &op) { op.writeMask = 0; });
+        break;
+    case VK_DYNAMIC_STATE_STENCIL_REFERENCE:
+        forEachStencil([](VkStencilOpState &op) { op.reference = 0; });
+        break;
+#ifdef VK_EXT_extended_dynamic_state
+    case VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT:
+        for (u32 i = 0; i < key.VertexBindingCount; ++i)
+            key.VertexBindings[i].stride = 0;
+        break;
+    case VK_DYNAMIC_STATE_CULL_MODE_EXT:
+        key.CullMode = 0;
+        break;
+    case VK_DYNAMIC_STATE_FRONT_FACE_EXT:
+        key.FrontFace = VkFrontFace(0);
+        break;
+    case VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT:
+        // only the topology class must match, unless dynamicPrimitiveTopologyUnrestricted is supported
+        key.Topology = getTopologyClass(key.Topology);
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT:
+        key.DepthTest = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT:
+        key.DepthWrite = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT:
+        key.DepthCompareOp = VkCompareOp(0);
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE_EXT:
+        key.DepthBoundsTest = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT:
+        key.StencilTest = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_STENCIL_OP_EXT:
+        forEachStencil([](VkStencilOpState &op) {
+            op.failOp = VkStencilOp(0);
+            op.passOp = VkStencilOp(0);
+            op.depthFailOp = VkStencilOp(0);
+            op.compareOp = VkCompareOp(0);
+        });
+        break;
+#endif
+#ifdef VK_EXT_extended_dynamic_state2
+    case VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT:
+        key.RasterizerDiscard = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT:
+        key.DepthBias = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT:
+        key.PrimitiveRestart = VK_FALSE;
+        break;
+#endif
+#ifdef VK_EXT_extended_dynamic_state3
+    case VK_DYNAMIC_STATE_POLYGON_MODE_EXT:
+        key.PolygonMode = VkPolygonMode(0);
+        break;
+    case VK_DYNAMIC_STATE_DEPTH_CLAMP_ENABLE_EXT:
+        key.DepthClamp = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT:
+        key.AlphaToCoverage = VK_FALSE;
+        break;
+    case VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT:
+        forEachAttachment([](VkPipelineColorBlendAttachmentState &att) { att.blendEnable = VK_FALSE; });
+        break;
+    case VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT:
+        forEachAttachment([](VkPipelineColorBlendAttachmentState &att) {
+            att.srcColorBlendFactor = VkBlendFactor(0);
+            att.dstColorBlendFactor = VkBlendFactor(0);
+            att.colorBlendOp = VkBlendOp(0);
+            att.srcAlphaBlendFactor = VkBlendFactor(0);
+            att.dstAlphaBlendFactor = VkBlendFactor(0);
+            att.alphaBlendOp = VkBlendOp(0);
+        });
+        break;
+    case VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT:
+        forEachAttachment([](VkPipelineColorBlendAttachmentState &att) { att.colorWriteMask = 0; });
+        break;
+#endif
+#ifdef VK_EXT_vertex_input_dynamic_state
+    case VK_DYNAMIC_STATE_VERTEX_INPUT_EXT:
+        key.VertexBindingCount = 0;
+        key.VertexAttributeCount = 0;
+        std::memset(key.VertexBindings, 0, sizeof(key.VertexBindings));
+        std::memset(key.VertexAttributes, 0, sizeof(key.VertexAttributes));
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+Result<PipelineStateKey> PipelineStateKey::Create(const GraphicsPipeline::Builder &builder)
+{
+    using Res = Result<PipelineStateKey>;
+    const auto checkCapacity = [](const u32 count, const u32 max, const char *name) -> Result<> {
+        if (count > max)
+            return Result<>::Error(
+                Error_BadInput,
+                TKit::TierString::Format("[VULKIT][PIPELINE-KEY] The builder has {} {}, but a key can only hold {}",
+                                         count, name, max));
+        return Result<>::Ok();
+    };
+    TKIT_RETURN_IF_FAILED(checkCapacity(builder.m_ShaderStages.GetSize(), MaxShaderStages, "shader stages"));
+    TKIT_RETURN_IF_FAILED(
+        checkCapacity(builder.m_BindingDescriptions.GetSize(), MaxVertexBindings, "vertex bindings"));
+    TKIT_RETURN_IF_FAILED(
+        checkCapacity(builder.m_AttributeDescriptions.GetSize(), MaxVertexAttributes, "vertex attributes"));
+    TKIT_RETURN_IF_FAILED(
+        checkCapacity(builder.m_ColorAttachments.GetSize(), MaxColorAttachments, "color attachments"));
+    TKIT_RETURN_IF_FAILED(checkCapacity(builder.m_DynamicStates.GetSize(), MaxDynamicStates, "dynamic states"));
+    if (!builder.m_RenderPass)
+        TKIT_RETURN_IF_FAILED(checkCapacity(builder.m_RenderingInfo.colorAttachmentCount, MaxColorAttachments,
+                                            "rendering color formats"));
+
+    PipelineStateKey key;
+    // padding must be zero as well, because the key is hashed and compared as raw memory
+    std::memset(&key, 0, sizeof(PipelineStateKey));
+
+    key.Layout = builder.m_Layout;
+    key.RenderPass = builder.m_RenderPass;
+    key.Subpass = builder.m_Subpass;
+    if (!builder.m_RenderPass)
+    {
+        const VkPipelineRenderingCreateInfoKHR &info = builder.m_RenderingInfo;
+        key.ViewMask = info.viewMask;
+        key.ColorFormatCount = info.colorAttachmentCount;
+        for (u32 i = 0; i < info.colorAttachmentCount; ++i)
+            key.ColorFormats[i] = info.pColorAttachmentFormats[i];
+        key.DepthFormat = info.depthAttachmentFormat;
+        key.StencilFormat = info.stencilAttachmentFormat;
+    }
+
+    key.ShaderStageCount = builder.m_ShaderStages.GetSize();
+    for (u32 i = 0; i < key.ShaderStageCount; ++i)
+    {
+        const VkPipelineShaderStageCreateInfo &src = builder.m_ShaderStages[i];
+        ShaderStage &dst = key.ShaderStages[i];
+        dst.Module = src.module;
+        dst.Stage = src.stage;
+        dst.Flags = src.flags;
+        dst.EntryPointHash = hashBytes(src.pName, std::strlen(src.pName));
+        if (const VkSpecializationInfo *spec = src.pSpecializationInfo)
+            dst.SpecializationHash =
+                hashBytes(spec->pMapEntries, spec->mapEntryCount * sizeof(VkSpecializationMapEntry)) ^
+                (hashBytes(spec->pData, spec->dataSize) * 31);
+    }
+
+    key.VertexBindingCount = builder.m_BindingDescriptions.GetSize();
+    for (u32 i = 0; i < key.VertexBindingCount; ++i)
+        key.VertexBindings[i] = builder.m_BindingDescriptions[i];
+    key.VertexAttributeCount = builder.m_AttributeDescriptions.GetSize();
+    for (u32 i = 0; i < key.VertexAttributeCount; ++i)
+        key.VertexAttributes[i] = builder.m_AttributeDescriptions[i];
+
+    key.Topology = builder.m_InputAssemblyInfo.topology;
+    key.PrimitiveRestart = builder.m_InputAssemblyInfo.primitiveRestartEnable;
+
+    key.ViewportCount = builder.m_ViewportInfo.viewportCount;
+    if (!builder.m_Viewports.IsEmpty())
+        key.ViewportHash = hashBytes(builder.m_Viewports.GetData(),
+                                     builder.m_Viewports.GetSize() * sizeof(GraphicsPipeline::ViewportInfo));
+
+    const VkPipelineRasterizationStateCreateInfo &raster = builder.m_RasterizationInfo;
+    key.DepthClamp = raster.depthClampEnable;
+    key.RasterizerDiscard = raster.rasterizerDiscardEnable;
+    key.PolygonMode = raster.polygonMode;
+    key.CullMode = raster.cullMode;
+    key.FrontFace = raster.frontFace;
+    key.DepthBias = raster.depthBiasEnable;
+    key.DepthBiasConstantFactor = raster.depthBiasConstantFactor;
+    key.DepthBiasClamp = raster.depthBiasClamp;
+    key.DepthBiasSlopeFactor = raster.depthBiasSlopeFactor;
+    key.LineWidth = raster.lineWidth;
+
+    const VkPipelineMultisampleStateCreateInfo &multisample = builder.m_MultisampleInfo;
+    key.SampleCount = multisample.rasterizationSamples;
+    key.SampleShading = multisample.sampleShadingEnable;
+    key.MinSampleShading = multisample.minSampleShading;
+    key.SampleMask = multisample.pSampleMask ? *multisample.pSampleMask : ~VkSampleMask{0};
+    key.AlphaToCoverage = multisample.alphaToCoverageEnable;
+    key.AlphaToOne = multisample.alphaToOneEnable;
+
+    const VkPipelineDepthStencilStateCreateInfo &depthStencil = builder.m_DepthStencilInfo;
+    key.DepthTest = depthStencil.depthTestEnable;
+    key.DepthWrite = depthStencil.depthWriteEnable;
+    key.DepthCompareOp = depthStencil.depthCompareOp;
+    key.DepthBoundsTest = depthStencil.depthBoundsTestEnable;
+    key.StencilTest = depthStencil.stencilTestEnable;
+    key.StencilFront = depthStencil.front;
+    key.StencilBack = depthStencil.back;
+    key.MinDepthBounds = depthStencil.minDepthBounds;
+    key.MaxDepthBounds = depthStencil.maxDepthBounds;
+
+    const VkPipelineColorBlendStateCreateInfo &blend = builder.m_ColorBlendInfo;
+    key.LogicOpEnable = blend.logicOpEnable;
+    key.LogicOp = blend.logicOp;
+    for (u32 i = 0; i < 4; ++i)
+        key.BlendConstants[i] = blend.blendConstants[i];
+    key.ColorAttachmentCount = builder.m_ColorAttachments.GetSize();
+    for (u32 i = 0; i < key.ColorAttachmentCount; ++i)
+        key.ColorAttachments[i] = builder.m_ColorAttachments[i];
+
+    key.DynamicStateCount = builder.m_DynamicStates.GetSize();
+    for (u32 i = 0; i < key.DynamicStateCount; ++i)
+        key.DynamicStates[i] = builder.m_DynamicStates[i];
+    std::sort(key.DynamicStates, key.DynamicStates + key.DynamicStateCount);
+    for (u32 i = 0; i < key.DynamicStateCount; ++i)
+        clearDynamicState(key, key.DynamicStates[i]);
+
+    return Res::Ok(key);
+}
+
+u64 PipelineStateKey::Hash() const
+{
+    // the key is 8 byte aligned and sized, so it can be consumed a word at a time, which is much faster than fnv-1a
+    // over individual bytes
+    static_assert(sizeof(PipelineStateKey) % sizeof(u64) == 0);
+    constexpr u64 prime = 0x9E3779B97F4A7C15ULL;
+
+    u64 hash = sizeof(PipelineStateKey);
+    const auto *words = rcast<const u64 *>(this);
+    for (usize i = 0; i < sizeof(PipelineStateKey) / sizeof(u64); ++i)
+    {
+        hash ^= words[i];
+        hash *= prime;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+bool PipelineStateKey::operator==(const PipelineStateKey &other) const
+{
+    return std::memcmp(this, &other, sizeof(PipelineStateKey)) == 0;
+}
+
+void PipelineStateCache::Destroy()
+{
+    std::unique_lock lock{m_Mutex};
+    for (auto &[key, pipeline] : m_Pipelines)
+        pipeline.Destroy();
+    m_Pipelines.clear();
+}
+
+Result<GraphicsPipeline> PipelineStateCache::Acquire(const GraphicsPipeline::Builder &builder)
+{
+    const auto kresult = PipelineStateKey::Create(builder);
+    TKIT_RETURN_ON_ERROR(kresult);
+    const PipelineStateKey &key = *kresult;
+    {
+        std::shared_lock lock{m_Mutex};
+        if (const auto it = m_Pipelines.find(key); it != m_Pipelines.end())
+            return Result<GraphicsPipeline>::Ok(it->second);
+    }
+
+    std::unique_lock lock{m_Mutex};
+    // another thread may have created the same pipeline while no lock was held
+    if (const auto it = m_Pipelines.find(key); it != m_Pipelines.end())
+        return it->second;
+
+    const auto presult = builder.Build();
+    TKIT_RETURN_ON_ERROR(presult);
+    m_Pipelines.emplace(key, *presult);
+    return presult;
+}
+
+GraphicsPipeline PipelineStateCache::Find(const PipelineStateKey &key) const
+{
+    std::shared_lock lock{m_Mutex};
+    const auto it = m_Pipelines.find(key);
+    return it != m_Pipelines.end() ? it->second : GraphicsPipeline{};
+}
+
+u32 PipelineStateCache::GetPipelineCount() const
+{
+    std::shared_lock lock{m_Mutex};
+    return static_cast<u32>(m_Pipelines.size());
+}
+
+} // namespace VKit
@@ -0,0 +1,159 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_GRAPHICS_PIPELINE
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_GRAPHICS_PIPELINE"
+#endif
+
+#include "vkit/state/graphics_pipeline.hpp"
+#include <unordered_map>
+#include <shared_mutex>
+
+namespace VKit
+{
+/**
+ * @brief A flat, fixed-size description of everything that makes a graphics pipeline unique.
+ *
+ * It is extracted from a `GraphicsPipeline::Builder` and contains no pointers: variable-sized data is either stored
+ * inline up to a fixed capacity or folded into a hash (entry point names and specialization data). The whole struct is
+ * zeroed before being filled, so it can be hashed and compared as raw memory.
+ *
+ * State the builder declares dynamic is left zeroed, so builders that only differ in it share a key (and a pipeline).
+ *
+ */
+struct alignas(8) PipelineStateKey
+{
+    static constexpr u32 MaxShaderStages = 5;
+    static constexpr u32 MaxVertexBindings = 8;
+    static constexpr u32 MaxVertexAttributes = 16;
+    static constexpr u32 MaxColorAttachments = 8;
+    static constexpr u32 MaxDynamicStates = 32;
+
+    struct ShaderStage
+    {
+        VkShaderModule Module;
+        u64 EntryPointHash;
+        u64 SpecializationHash;
+        VkShaderStageFlagBits Stage;
+        VkPipelineShaderStageCreateFlags Flags;
+    };
+
+    VKIT_NO_DISCARD static Result<PipelineStateKey> Create(const GraphicsPipeline::Builder &builder);
+
+    u64 Hash() const;
+
+    bool operator==(const PipelineStateKey &other) const;
+    bool operator!=(const PipelineStateKey &other) const
+    {
+        return !(*this == other);
+    }
+
+    VkPipelineLayout Layout;
+    VkRenderPass RenderPass;
+    u32 Subpass;
+
+    u32 ViewMask;
+    u32 ColorFormatCount;
+    VkFormat ColorFormats[MaxColorAttachments];
+    VkFormat DepthFormat;
+    VkFormat StencilFormat;
+
+    u32 ShaderStageCount;
+    ShaderStage ShaderStages[MaxShaderStages];
+
+    u32 VertexBindingCount;
+    u32 VertexAttributeCount;
+    VkVertexInputBindingDescription VertexBindings[MaxVertexBindings];
+    VkVertexInputAttributeDescription VertexAttributes[MaxVertexAttributes];
+
+    VkPrimitiveTopology Topology;
+    VkBool32 PrimitiveRestart;
+
+    u32 ViewportCount;
+    u64 ViewportHash;
+
+    VkBool32 DepthClamp;
+    VkBool32 RasterizerDiscard;
+    VkPolygonMode PolygonMode;
+    VkCullModeFlags CullMode;
+    VkFrontFace FrontFace;
+    VkBool32 DepthBias;
+    f32 DepthBiasConstantFactor;
+    f32 DepthBiasClamp;
+    f32 DepthBiasSlopeFactor;
+    f32 LineWidth;
+
+    VkSampleCountFlagBits SampleCount;
+    VkBool32 SampleShading;
+    f32 MinSampleShading;
+    VkSampleMask SampleMask;
+    VkBool32 AlphaToCoverage;
+    VkBool32 AlphaToOne;
+
+    VkBool32 DepthTest;
+    VkBool32 DepthWrite;
+    VkCompareOp DepthCompareOp;
+    VkBool32 DepthBoundsTest;
+    VkBool32 StencilTest;
+    VkStencilOpState StencilFront;
+    VkStencilOpState StencilBack;
+    f32 MinDepthBounds;
+    f32 MaxDepthBounds;
+
+    VkBool32 LogicOpEnable;
+    VkLogicOp LogicOp;
+    f32 BlendConstants[4];
+    u32 ColorAttachmentCount;
+    VkPipelineColorBlendAttachmentState ColorAttachments[MaxColorAttachments];
+
+    // sorted, as the order in which dynamic states are declared does not matter
+    u32 DynamicStateCount;
+    VkDynamicState DynamicStates[MaxDynamicStates];
+};
+
+struct PipelineStateKeyHash
+{
+    usize operator()(const PipelineStateKey &key) const
+    {
+        return static_cast<usize>(key.Hash());
+    }
+};
+
+/**
+ * @brief Maps pipeline state keys to graphics pipelines so that equivalent builders share a single pipeline.
+ *
+ * Not to be confused with `PipelineCache`, which persists driver compilation results. Lookups of existing pipelines
+ * only take a shared lock. Pipelines returned by the cache are owned by it and are destroyed with `Destroy()`.
+ *
+ */
+class PipelineStateCache
+{
+  public:
+    PipelineStateCache() = default;
+    PipelineStateCache(const ProxyDevice &device) : m_Device(device)
+    {
+    }
+
+    PipelineStateCache(const PipelineStateCache &) = delete;
+    PipelineStateCache &operator=(const PipelineStateCache &) = delete;
+
+    void Destroy();
+
+    // returns the existing pipeline for the builder state, or builds and stores a new one. the builder must be baked
+    VKIT_NO_DISCARD Result<GraphicsPipeline> Acquire(const GraphicsPipeline::Builder &builder);
+    // returns a null pipeline if there is no pipeline for the key
+    GraphicsPipeline Find(const PipelineStateKey &key) const;
+
+    u32 GetPipelineCount() const;
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+
+  private:
+    ProxyDevice m_Device{};
+    std::unordered_map<PipelineStateKey, GraphicsPipeline, PipelineStateKeyHash> m_Pipelines{};
+    mutable std::shared_mutex m_Mutex{};
+};
+} // namespace VKit
@@ -0,0 +1,131 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/pipeline_stats.hpp"
+
+namespace VKit
+{
+PipelineStats::PipelineStats(const u32 apiVersion, const NameSet &enabledExtensions)
+{
+#ifdef VKIT_API_VERSION_1_3
+    m_Supported = apiVersion >= VKIT_API_VERSION_1_3;
+#else
+    (void)apiVersion;
+#endif
+#ifdef VK_EXT_pipeline_creation_feedback
+    m_Supported |= enabledExtensions.Contains(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+#else
+    (void)enabledExtensions;
+#endif
+}
+
+PipelineStats::Feedback::Feedback(const u32 stageCount)
+{
+    m_Stages.Resize(stageCount);
+}
+
+const void *PipelineStats::Feedback::Chain(const void *next)
+{
+    m_Info = {};
+    m_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+    m_Info.pNext = next;
+    m_Info.pPipelineCreationFeedback = &m_Pipeline;
+    m_Info.pipelineStageCreationFeedbackCount = m_Stages.GetSize();
+    m_Info.pPipelineStageCreationFeedbacks = m_Stages.IsEmpty() ? nullptr : m_Stages.GetData();
+    return &m_Info;
+}
+
+static bool isValid(const VkPipelineCreationFeedbackEXT &feedback)
+{
+    return feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT;
+}
+static bool isCacheHit(const VkPipelineCreationFeedbackEXT &feedback)
+{
+    return feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT;
+}
+
+void PipelineStats::Record(const char *name, const Feedback &feedback,
+                           const TKit::Span<const VkShaderStageFlagBits> stages)
+{
+    TKIT_ASSERT(stages.GetSize() == feedback.m_Stages.GetSize(),
+                "[VULKIT][PIPELINE-STATS] Stage count ({}) does not match the feedback stage count ({})",
+                stages.GetSize(), feedback.m_Stages.GetSize());
+
+    Entry entry{};
+    entry.Name = name ? name : "unnamed";
+    entry.Valid = isValid(feedback.m_Pipeline);
+    entry.CacheHit = isCacheHit(feedback.m_Pipeline);
+    entry.Duration = std::chrono::nanoseconds(feedback.m_Pipeline.duration);
+    for (u32 i = 0; i < stages.GetSize(); ++i)
+    {
+        const VkPipelineCreationFeedbackEXT &stage = feedback.m_Stages[i];
+        entry.Stages.Append(
+            Stage{stages[i], std::chrono::nanoseconds(stage.duration), isCacheHit(stage), isValid(stage)});
+    }
+
+    std::scoped_lock lock{m_Mutex};
+    m_Entries.Append(entry);
+}
+
+void PipelineStats::Clear()
+{
+    std::scoped_lock lock{m_Mutex};
+    m_Entries.Clear();
+}
+
+TKit::TierArray<PipelineStats::Entry> PipelineStats::GetEntries() const
+{
+    TKit::TierArray<Entry> entries{};
+    {
+        std::scoped_lock lock{m_Mutex};
+        entries = m_Entries;
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) { return a.Duration > b.Duration; });
+    return entries;
+}
+
+u32 PipelineStats::GetEntryCount() const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Entries.GetSize();
+}
+
+f32 PipelineStats::GetCacheHitRate() const
+{
+    std::scoped_lock lock{m_Mutex};
+    u32 valid = 0;
+    u32 hits = 0;
+    for (const Entry &entry : m_Entries)
+        if (entry.Valid)
+        {
+            ++valid;
+            hits += entry.CacheHit;
+        }
+    return valid == 0 ? 0.f : static_cast<f32>(hits) / static_cast<f32>(valid);
+}
+
+TKit::TierString PipelineStats::Dump(const u32 maxEntries) const
+{
+    const TKit::TierArray<Entry> entries = GetEntries();
+    const u32 count = maxEntries == 0 ? entries.GetSize() : std::min(maxEntries, entries.GetSize());
+
+    TKit::TierString report = TKit::TierString::Format("[VULKIT][PIPELINE-STATS] {} pipelines, {:.1f}% cache hits\n",
+                                                       entries.GetSize(), 100.f * GetCacheHitRate());
+    for (u32 i = 0; i < count; ++i)
+    {
+        const Entry &entry = entries[i];
+        if (!entry.Valid)
+        {
+            report += TKit::TierString::Format("  {}: no feedback\n", entry.Name);
+            continue;
+        }
+        report += TKit::TierString::Format("  {}: {:.3f} ms{}\n", entry.Name, entry.Duration.count() * 1e-6,
+                                           entry.CacheHit ? " (cache hit)" : "");
+        for (const Stage &stage : entry.Stages)
+            if (stage.Valid)
+                report += TKit::TierString::Format("    stage {:#x}: {:.3f} ms{}\n", static_cast<u32>(stage.Stage),
+                                                   stage.Duration.count() * 1e-6, stage.CacheHit ? " (cache hit)" : "");
+    }
+    return report;
+}
+
+} // namespace VKit
@@ -0,0 +1,97 @@
+#pragma once
+
+#if !defined(VKIT_ENABLE_GRAPHICS_PIPELINE) && !defined(VKIT_ENABLE_COMPUTE_PIPELINE)
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding features must be enabled in CMake with VULKIT_ENABLE_GRAPHICS_PIPELINE or VULKIT_ENABLE_COMPUTE_PIPELINE"
+#endif
+
+#include "vkit/vulkan/vulkan.hpp"
+#include "vkit/core/name_registry.hpp"
+#include "tkit/container/span.hpp"
+#include "tkit/container/tier_array.hpp"
+#include <vulkan/vulkan.h>
+#include <chrono>
+#include <mutex>
+
+namespace VKit
+{
+/**
+ * @brief Registry of pipeline creation feedback, as reported by `VK_EXT_pipeline_creation_feedback`.
+ *
+ * Pipelines are registered by setting a `PipelineStats` on their `GraphicsPipeline::Builder` or
+ * `ComputePipelineSpecs`, which then chain a `VkPipelineCreationFeedbackCreateInfoEXT` on creation and record the
+ * durations and pipeline cache hits of the pipeline and its stages here. Entries can be retrieved or dumped sorted by
+ * cost, to find the pipelines worth prewarming and to check how effective a pipeline cache is.
+ *
+ * Feedback is only chained if the device uses Vulkan 1.3 or has `VK_EXT_pipeline_creation_feedback` enabled, which is
+ * checked on construction. Otherwise, pipelines are created as usual and nothing is recorded. Recording is thread safe.
+ * Drivers are allowed to report nothing, in which case entries are marked invalid.
+ *
+ */
+class PipelineStats
+{
+  public:
+    struct Stage
+    {
+        VkShaderStageFlagBits Stage;
+        std::chrono::nanoseconds Duration;
+        bool CacheHit;
+        bool Valid;
+    };
+    struct Entry
+    {
+        TKit::TierString Name;
+        std::chrono::nanoseconds Duration;
+        bool CacheHit;
+        bool Valid;
+        TKit::TierArray<Stage> Stages;
+    };
+
+    // storage for the feedback of a single pipeline creation. it must not move once chained
+    class Feedback
+    {
+      public:
+        Feedback(u32 stageCount);
+
+        // returns the feedback create info, to be set as the `pNext` of the pipeline create info
+        const void *Chain(const void *next);
+
+      private:
+        VkPipelineCreationFeedbackEXT m_Pipeline{};
+        TKit::TierArray<VkPipelineCreationFeedbackEXT> m_Stages{};
+        VkPipelineCreationFeedbackCreateInfoEXT m_Info{};
+
+        friend class PipelineStats;
+    };
+
+    // `apiVersion` and `enabledExtensions` are the ones of the device, as found in `PhysicalDevice::Info`
+    PipelineStats(u32 apiVersion, const NameSet &enabledExtensions);
+
+    PipelineStats(const PipelineStats &) = delete;
+    PipelineStats &operator=(const PipelineStats &) = delete;
+
+    // `stages` must hold the stage of every shader stage of the pipeline, in creation order
+    void Record(const char *name, const Feedback &feedback, TKit::Span<const VkShaderStageFlagBits> stages);
+    void Clear();
+
+    // whether the device can report creation feedback
+    bool IsSupported() const
+    {
+        return m_Supported;
+    }
+
+    // every entry, most expensive first
+    TKit::TierArray<Entry> GetEntries() const;
+    u32 GetEntryCount() const;
+    // fraction of valid entries that hit the pipeline cache
+    f32 GetCacheHitRate() const;
+
+    // a human readable report of the entries, most expensive first. a `maxEntries` of 0 includes all of them
+    TKit::TierString Dump(u32 maxEntries = 0) const;
+
+  private:
+    TKit::TierArray<Entry> m_Entries{};
+    mutable std::mutex m_Mutex{};
+    bool m_Supported = false;
+};
+} // namespace VKit
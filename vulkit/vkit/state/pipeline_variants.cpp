@@ -0,0 +1,172 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/pipeline_variants.hpp"
+
+namespace VKit
+{
+PipelineVariants::PipelineVariants(const GraphicsPipeline::Builder &builder, const VkShaderStageFlags stages)
+    : m_Builder(builder), m_Stages(stages)
+{
+}
+
+PipelineVariants::~PipelineVariants()
+{
+    stop();
+}
+
+void PipelineVariants::stop()
+{
+    {
+        std::scoped_lock lock{m_Mutex};
+        m_Stop = true;
+    }
+    m_Condition.notify_all();
+    if (m_Thread.joinable())
+        m_Thread.join();
+}
+
+void PipelineVariants::Destroy()
+{
+    stop();
+    for (Variant &variant : m_Variants)
+        if (variant.Pipeline)
+            variant.Pipeline.Destroy();
+    m_Variants.Clear();
+    m_ByKey.clear();
+    m_Queue.Clear();
+    if (m_Fallback)
+        m_Fallback.Destroy();
+    m_Stop = false;
+}
+
+Result<> PipelineVariants::SetFallback(const Key &key)
+{
+    const auto result = compile(key.Values);
+    TKIT_RETURN_ON_ERROR(result);
+
+    std::scoped_lock lock{m_Mutex};
+    if (m_Fallback)
+        m_Fallback.Destroy();
+    m_Fallback = *result;
+    return Result<>::Ok();
+}
+
+GraphicsPipeline PipelineVariants::Get(const Key &key)
+{
+    std::scoped_lock lock{m_Mutex};
+    const Variant &variant = m_Variants[request(key)];
+    return variant.Status == VariantStatus_Ready ? variant.Pipeline : m_Fallback;
+}
+
+void PipelineVariants::Prepare(const Key &key)
+{
+    std::scoped_lock lock{m_Mutex};
+    request(key);
+}
+
+bool PipelineVariants::IsReady(const Key &key) const
+{
+    std::scoped_lock lock{m_Mutex};
+    const i32 index = find(key, hashKey(key));
+    return index != -1 && m_Variants[index].Status == VariantStatus_Ready;
+}
+
+u32 PipelineVariants::GetVariantCount() const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Variants.GetSize();
+}
+
+u32 PipelineVariants::request(const Key &key)
+{
+    TKIT_ASSERT(key.Values.GetSize() == m_Entries.GetSize(),
+                "[VULKIT][PIPELINE-VARIANTS] The key has {} values, but {} constants were declared",
+                key.Values.GetSize(), m_Entries.GetSize());
+
+    const u64 hash = hashKey(key);
+    const i32 index = find(key, hash);
+    if (index != -1)
+        return static_cast<u32>(index);
+
+    const u32 newIndex = m_Variants.GetSize();
+    m_Variants.Append(Variant{key.Values, GraphicsPipeline{}, VariantStatus_Pending});
+    m_ByKey.emplace(hash, newIndex);
+    m_Queue.Append(newIndex);
+
+    if (!m_Thread.joinable())
+        m_Thread = std::thread([this] { work(); });
+    m_Condition.notify_one();
+    return newIndex;
+}
+
+i32 PipelineVariants::find(const Key &key, const u64 hash) const
+{
+    const auto [begin, end] = m_ByKey.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        const TKit::TierArray<u32> &values = m_Variants[it->second].Values;
+        if (std::memcmp(values.GetData(), key.Values.GetData(), values.GetSize() * sizeof(u32)) == 0)
+            return static_cast<i32>(it->second);
+    }
+    return -1;
+}
+
+Result<GraphicsPipeline> PipelineVariants::compile(const TKit::TierArray<u32> &values) const
+{
+    VkSpecializationInfo info{};
+    info.mapEntryCount = m_Entries.GetSize();
+    info.pMapEntries = m_Entries.GetData();
+    info.dataSize = values.GetSize() * sizeof(u32);
+    info.pData = values.GetData();
+
+    // copies must be baked again, as the baked state points into the original builder
+    GraphicsPipeline::Builder builder = m_Builder;
+    builder.SetSpecializationInfo(&info, m_Stages).Bake();
+    return builder.Build();
+}
+
+void PipelineVariants::work()
+{
+    std::unique_lock lock{m_Mutex};
+    for (;;)
+    {
+        m_Condition.wait(lock, [this] { return m_Stop || !m_Queue.IsEmpty(); });
+        if (m_Stop)
+            return;
+
+        const u32 index = m_Queue.GetBack();
+        m_Queue.Pop();
+        // the variant array may grow while compiling, so values are copied and the variant is looked up again
+        const TKit::TierArray<u32> values = m_Variants[index].Values;
+
+        lock.unlock();
+        const auto result = compile(values);
+        lock.lock();
+
+        Variant &variant = m_Variants[index];
+        if (result)
+        {
+            variant.Pipeline = *result;
+            variant.Status = VariantStatus_Ready;
+        }
+        else
+        {
+            TKIT_LOG_WARNING("[VULKIT][PIPELINE-VARIANTS] Failed to compile a variant, the fallback will be used: {}",
+                             result.GetError().ToString());
+            variant.Status = VariantStatus_Failed;
+        }
+    }
+}
+
+u64 PipelineVariants::hashKey(const Key &key)
+{
+    // fnv-1a over whole words, which is plenty for a handful of constants
+    u64 hash = 14695981039346656037ULL;
+    for (const u32 value : key.Values)
+    {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace VKit
@@ -0,0 +1,155 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_GRAPHICS_PIPELINE
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_GRAPHICS_PIPELINE"
+#endif
+
+#include "vkit/state/graphics_pipeline.hpp"
+#include <unordered_map>
+#include <cstring>
+#include <condition_variable>
+#include <thread>
+#include <mutex>
+#include <type_traits>
+
+namespace VKit
+{
+/**
+ * @brief Manages the specialization constant variants of a graphics pipeline.
+ *
+ * Constants are declared up front with their types and default values. A `Key` holds one value per declared constant
+ * and identifies a variant. Variants are compiled lazily: the first time a key is requested it is queued for
+ * compilation on a background thread, and a caller-designated fallback variant is returned until it is ready. This
+ * allows specializing shaders instead of branching at runtime without compiling every variant at startup.
+ *
+ * The builder passed on construction is used as a template for every variant, and only its specialization info is
+ * replaced. Shader modules and layouts it references must outlive this object.
+ *
+ */
+class PipelineVariants
+{
+  public:
+    // every supported constant type is 4 bytes wide, so values are stored as raw 32-bit words
+    struct Key
+    {
+        template <typename T> Key &Set(const u32 index, const T value)
+        {
+            static_assert(std::is_same_v<T, bool> || std::is_same_v<T, i32> || std::is_same_v<T, u32> ||
+                              std::is_same_v<T, f32>,
+                          "[VULKIT][PIPELINE-VARIANTS] Specialization constants must be bool, i32, u32 or f32");
+            TKIT_ASSERT(index < Values.GetSize(), "[VULKIT][PIPELINE-VARIANTS] Constant index {} is out of bounds ({})",
+                        index, Values.GetSize());
+            if constexpr (std::is_same_v<T, bool>)
+                Values[index] = value ? VK_TRUE : VK_FALSE;
+            else
+                std::memcpy(&Values[index], &value, sizeof(u32));
+            return *this;
+        }
+
+        TKit::TierArray<u32> Values;
+    };
+
+    PipelineVariants(const GraphicsPipeline::Builder &builder,
+                     VkShaderStageFlags stages = VK_SHADER_STAGE_ALL_GRAPHICS);
+
+    PipelineVariants(const PipelineVariants &) = delete;
+    PipelineVariants &operator=(const PipelineVariants &) = delete;
+
+    // only stops the background thread. compiled variants must be destroyed with `Destroy()`
+    ~PipelineVariants();
+
+    // stops the background thread and destroys every compiled variant
+    void Destroy();
+
+    /**
+     * @brief Declare a specialization constant. All constants must be declared before any variant is requested.
+     *
+     * @param constantId The `constant_id` of the constant in the shaders.
+     * @param defaultValue The value used by keys created with `CreateKey()`.
+     * @return The index of the constant, to be used with `Key::Set()`.
+     */
+    template <typename T> u32 AddConstant(const u32 constantId, const T defaultValue)
+    {
+        TKIT_ASSERT(m_Variants.IsEmpty(),
+                    "[VULKIT][PIPELINE-VARIANTS] Constants must be declared before any variant is requested");
+        VkSpecializationMapEntry entry;
+        entry.constantID = constantId;
+        entry.offset = m_Entries.GetSize() * sizeof(u32);
+        entry.size = sizeof(u32);
+        m_Entries.Append(entry);
+
+        m_Defaults.Values.Append(0);
+        m_Defaults.Set(m_Entries.GetSize() - 1, defaultValue);
+        return m_Entries.GetSize() - 1;
+    }
+
+    // a key with every constant set to its default value
+    Key CreateKey() const
+    {
+        return m_Defaults;
+    }
+
+    // compiles the fallback variant right away. it is returned by `Get()` while the requested variant is not ready
+    VKIT_NO_DISCARD Result<> SetFallback(const Key &key);
+
+    /**
+     * @brief Get the pipeline for a variant, queueing it for compilation if it has not been requested yet.
+     *
+     * @return The pipeline of the variant if it is ready, or the fallback pipeline otherwise. The fallback is also
+     * returned if the variant failed to compile.
+     */
+    GraphicsPipeline Get(const Key &key);
+
+    // queues a variant for compilation without waiting for it
+    void Prepare(const Key &key);
+    bool IsReady(const Key &key) const;
+
+    u32 GetConstantCount() const
+    {
+        return m_Entries.GetSize();
+    }
+    u32 GetVariantCount() const;
+
+  private:
+    enum VariantStatus : u8
+    {
+        VariantStatus_Pending,
+        VariantStatus_Ready,
+        VariantStatus_Failed
+    };
+    struct Variant
+    {
+        TKit::TierArray<u32> Values;
+        GraphicsPipeline Pipeline;
+        VariantStatus Status;
+    };
+
+    // must be called with the mutex held. returns the index of the variant, requesting it if needed
+    u32 request(const Key &key);
+    i32 find(const Key &key, u64 hash) const;
+
+    Result<GraphicsPipeline> compile(const TKit::TierArray<u32> &values) const;
+    void work();
+    void stop();
+
+    static u64 hashKey(const Key &key);
+
+    GraphicsPipeline::Builder m_Builder;
+    VkShaderStageFlags m_Stages = 0;
+
+    TKit::TierArray<VkSpecializationMapEntry> m_Entries{};
+    Key m_Defaults{};
+    GraphicsPipeline m_Fallback{};
+
+    TKit::TierArray<Variant> m_Variants{};
+    std::unordered_multimap<u64, u32> m_ByKey{};
+    // processed in LIFO order, so the most recently requested variants are compiled first
+    TKit::TierArray<u32> m_Queue{};
+
+    std::thread m_Thread{};
+    std::condition_variable m_Condition{};
+    mutable std::mutex m_Mutex{};
+    bool m_Stop = false;
+};
+} // namespace VKit
@@ -2,6 +2,8 @@
 #include "vkit/state/render_pass.hpp"
 #include "tkit/container/stack_array.hpp"
 
+#include <cstring>
+
 namespace VKit
 {
 Result<RenderPass> RenderPass::Builder::Build() const
@@ -44,6 +46,11 @@ Result<RenderPass> RenderPass::Builder::Build() const
 
         Attachment att = attachment.m_Attachment;
         att.Description.format = *result;
+        // transient contents are never written back to memory
+        TKIT_ASSERT(!(att.Flags & DeviceImageFlag_Transient) ||
+                        (att.Description.storeOp == VK_ATTACHMENT_STORE_OP_DONT_CARE &&
+                         att.Description.stencilStoreOp == VK_ATTACHMENT_STORE_OP_DONT_CARE),
+                    "[VULKIT][RENDER-PASS] Transient attachments must not be stored");
 
         attachments.Append(att);
         attDescriptions.Append(att.Description);
@@ -94,12 +101,167 @@ void RenderPass::Resources::Destroy()
     for (DeviceImage image : m_Images)
         image.Destroy();
 
-    for (const VkFramebuffer &frameBuffer : m_Framebuffers)
-        m_Device.Table->DestroyFramebuffer(m_Device, frameBuffer, m_Device.AllocationCallbacks);
+    if (!m_Imageless)
+        for (const VkFramebuffer &frameBuffer : m_Framebuffers)
+            m_Device.Table->DestroyFramebuffer(m_Device, frameBuffer, m_Device.AllocationCallbacks);
 
     m_Images.Clear();
+    m_Views.Clear();
     m_Framebuffers.Clear();
+    m_SavedMemory = 0;
+}
+
+VkDeviceSize RenderPass::Resources::GetMemorySize() const
+{
+    VkDeviceSize size = 0;
+    for (const DeviceImage &image : m_Images)
+        size += image.GetMemorySize();
+    return size;
+}
+
+void RenderPass::Resources::addImage(const DeviceImage &image, const Attachment &attachment, const u32 imageCount)
+{
+    TKIT_ASSERT(!(attachment.Flags & DeviceImageFlag_Transient) ||
+                    (image.GetInfo().Usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT),
+                "[VULKIT][RENDER-PASS] Images of transient attachments must be created with the transient flag");
+    m_Images.Append(image);
+    m_Views.Append(image.GetViews()[0]);
+    if (attachment.Shared)
+        m_SavedMemory += image.GetMemorySize() * (imageCount - 1);
+}
+void RenderPass::Resources::addSharedImage(const u32 attachmentIndex)
+{
+    // views of the first image index come first, so the shared one is always there
+    const VkImageView view = m_Views[attachmentIndex];
+    m_Views.Append(view);
+}
+
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_imageless_framebuffer)
+bool FramebufferCache::Key::operator==(const Key &other) const
+{
+    return Words.GetSize() == other.Words.GetSize() &&
+           std::memcmp(Words.GetData(), other.Words.GetData(), Words.GetSize() * sizeof(u32)) == 0;
+}
+usize FramebufferCache::KeyHash::operator()(const Key &key) const
+{
+    // fnv-1a over whole words
+    u64 hash = 14695981039346656037ULL;
+    for (const u32 word : key.Words)
+    {
+        hash ^= word;
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<usize>(hash);
+}
+
+void FramebufferCache::Destroy()
+{
+    std::scoped_lock lock{m_Mutex};
+    for (const auto &[key, entry] : m_Framebuffers)
+        m_Device.Table->DestroyFramebuffer(m_Device, entry.Framebuffer, m_Device.AllocationCallbacks);
+    m_Framebuffers.clear();
+}
+
+template <typename F> void FramebufferCache::evict(F &&predicate)
+{
+    std::scoped_lock lock{m_Mutex};
+    for (auto it = m_Framebuffers.begin(); it != m_Framebuffers.end();)
+        if (predicate(it->second))
+        {
+            m_Device.Table->DestroyFramebuffer(m_Device, it->second.Framebuffer, m_Device.AllocationCallbacks);
+            it = m_Framebuffers.erase(it);
+        }
+        else
+            ++it;
 }
+
+void FramebufferCache::Evict(const VkRenderPass renderPass)
+{
+    evict([renderPass](const Entry &entry) { return entry.RenderPass == renderPass; });
+}
+void FramebufferCache::Purge(const VkExtent2D &extent)
+{
+    evict([&extent](const Entry &entry) {
+        return entry.Extent.width != extent.width || entry.Extent.height != extent.height;
+    });
+}
+
+Result<VkFramebuffer> FramebufferCache::Acquire(const VkRenderPass renderPass, const VkExtent2D &extent,
+                                                const TKit::Span<const DeviceImage> attachments, const u32 layers)
+{
+    Key key{};
+    const u64 handle = reinterpret_cast<u64>(renderPass);
+    key.Words.Append(static_cast<u32>(handle));
+    key.Words.Append(static_cast<u32>(handle >> 32));
+    key.Words.Append(extent.width);
+    key.Words.Append(extent.height);
+    key.Words.Append(layers);
+    key.Words.Append(attachments.GetSize());
+    for (const DeviceImage &image : attachments)
+    {
+        const DeviceImage::Info &info = image.GetInfo();
+        key.Words.Append(info.Width);
+        key.Words.Append(info.Height);
+        key.Words.Append(info.ArrayLayers);
+        key.Words.Append(info.Usage);
+        key.Words.Append(info.CreateFlags);
+        key.Words.Append(info.Formats.GetSize());
+        for (const VkFormat format : info.Formats)
+            key.Words.Append(static_cast<u32>(format));
+    }
+
+    std::scoped_lock lock{m_Mutex};
+    if (const auto it = m_Framebuffers.find(key); it != m_Framebuffers.end())
+        return it->second.Framebuffer;
+
+    TKit::StackArray<VkFramebufferAttachmentImageInfoKHR> imageInfos{};
+    imageInfos.Reserve(attachments.GetSize());
+    for (const DeviceImage &image : attachments)
+    {
+        const DeviceImage::Info &info = image.GetInfo();
+        VkFramebufferAttachmentImageInfoKHR &imageInfo = imageInfos.Append();
+        imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO_KHR;
+        imageInfo.flags = info.CreateFlags;
+        imageInfo.usage = info.Usage;
+        imageInfo.width = info.Width;
+        imageInfo.height = info.Height;
+        imageInfo.layerCount = info.ArrayLayers;
+        imageInfo.viewFormatCount = info.Formats.GetSize();
+        imageInfo.pViewFormats = info.Formats.GetData();
+    }
+
+    VkFramebufferAttachmentsCreateInfoKHR attachmentsInfo{};
+    attachmentsInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO_KHR;
+    attachmentsInfo.attachmentImageInfoCount = imageInfos.GetSize();
+    attachmentsInfo.pAttachmentImageInfos = imageInfos.GetData();
+
+    VkFramebufferCreateInfo frameBufferInfo{};
+    frameBufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    frameBufferInfo.pNext = &attachmentsInfo;
+    frameBufferInfo.flags = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR;
+    frameBufferInfo.renderPass = renderPass;
+    frameBufferInfo.attachmentCount = attachments.GetSize();
+    frameBufferInfo.width = extent.width;
+    frameBufferInfo.height = extent.height;
+    frameBufferInfo.layers = layers;
+
+    VkFramebuffer framebuffer;
+    VKIT_RETURN_IF_FAILED(
+        m_Device.Table->CreateFramebuffer(m_Device, &frameBufferInfo, m_Device.AllocationCallbacks, &framebuffer),
+        Result<VkFramebuffer>);
+
+    m_Framebuffers.emplace(std::move(key), Entry{framebuffer, renderPass, extent});
+    return framebuffer;
+}
+
+u32 FramebufferCache::GetFramebufferCount() const
+{
+    std::scoped_lock lock{m_Mutex};
+    return static_cast<u32>(m_Framebuffers.size());
+}
+#endif
+
 RenderPass::AttachmentBuilder &RenderPass::Builder::BeginAttachment(const DeviceImageFlags flags)
 {
     return m_Attachments.Append(this, flags);
@@ -235,6 +397,11 @@ RenderPass::AttachmentBuilder &RenderPass::AttachmentBuilder::SetFlags(const VkA
     m_Attachment.Description.flags = flags;
     return *this;
 }
+RenderPass::AttachmentBuilder &RenderPass::AttachmentBuilder::SetShared(const bool shared)
+{
+    m_Attachment.Shared = shared;
+    return *this;
+}
 RenderPass::Builder &RenderPass::AttachmentBuilder::EndAttachment()
 {
     return *m_Builder;
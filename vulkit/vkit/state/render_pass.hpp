@@ -7,9 +7,82 @@
 
 #include "vkit/resource/device_image.hpp"
 #include "tkit/utils/limits.hpp"
+#include <unordered_map>
+#include <mutex>
 
 namespace VKit
 {
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_imageless_framebuffer)
+/**
+ * @brief Owns imageless framebuffers, keyed by render pass, extent, layer count and the description of every attachment
+ * image (size, usage, create flags and view formats).
+ *
+ * Imageless framebuffers do not reference image views, so a single one serves every frame whose attachments share a
+ * description, and recreating the attachments (or the swap chain) with the same extent and formats reuses it.
+ *
+ * The device must have been created with the `imagelessFramebuffer` feature enabled, either through
+ * `VkPhysicalDeviceVulkan12Features` or `VK_KHR_imageless_framebuffer`. Without it, creating the framebuffers is
+ * invalid usage that drivers are not required to report.
+ *
+ * Framebuffers are never evicted on their own. As render pass handles may be reused once destroyed, `Evict()` must be
+ * called before destroying a render pass used with the cache, and `Purge()` drops the framebuffers left behind by
+ * previous extents, such as those of a resized swap chain.
+ *
+ */
+class FramebufferCache
+{
+  public:
+    FramebufferCache() = default;
+    FramebufferCache(const ProxyDevice &device) : m_Device(device)
+    {
+    }
+
+    FramebufferCache(const FramebufferCache &) = delete;
+    FramebufferCache &operator=(const FramebufferCache &) = delete;
+
+    void Destroy();
+
+    // returns the framebuffer for the attachments, creating it if needed. only the image descriptions are used
+    VKIT_NO_DISCARD Result<VkFramebuffer> Acquire(VkRenderPass renderPass, const VkExtent2D &extent,
+                                                  TKit::Span<const DeviceImage> attachments, u32 layers = 1);
+
+    // destroys every framebuffer created for the render pass. none of them may be in use
+    void Evict(VkRenderPass renderPass);
+    // destroys every framebuffer whose extent differs from `extent`. none of them may be in use
+    void Purge(const VkExtent2D &extent);
+
+    u32 GetFramebufferCount() const;
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+
+  private:
+    struct Key
+    {
+        TKit::TierArray<u32> Words;
+        bool operator==(const Key &other) const;
+    };
+    struct KeyHash
+    {
+        usize operator()(const Key &key) const;
+    };
+    struct Entry
+    {
+        VkFramebuffer Framebuffer;
+        VkRenderPass RenderPass;
+        VkExtent2D Extent;
+    };
+
+    template <typename F> void evict(F &&predicate);
+
+    ProxyDevice m_Device{};
+    std::unordered_map<Key, Entry, KeyHash> m_Framebuffers{};
+    mutable std::mutex m_Mutex{};
+};
+#endif
+
 class RenderPass
 {
   public:
@@ -17,6 +90,8 @@ class RenderPass
     {
         VkAttachmentDescription Description{};
         DeviceImageFlags Flags;
+        // a single image is created for this attachment and referenced by every framebuffer
+        bool Shared = false;
     };
 
     class Builder;
@@ -45,6 +120,16 @@ class RenderPass
         AttachmentBuilder &SetSampleCount(VkSampleCountFlagBits sampleCount);
         AttachmentBuilder &SetFlags(VkAttachmentDescriptionFlags flags);
 
+        /**
+         * @brief Makes the attachment be backed by a single image shared by every framebuffer, instead of one image
+         * per swap chain image.
+         *
+         * Only valid when frames never access the attachment concurrently, which is the case for depth buffers and
+         * multisampled targets whose contents are not needed once the render pass ends, as long as frames are not
+         * rendered in parallel.
+         */
+        AttachmentBuilder &SetShared(bool shared = true);
+
         Builder &EndAttachment();
 
       private:
@@ -145,18 +230,54 @@ class RenderPass
 
         VkImageView GetImageView(const u32 imageIndex, const u32 attachmentIndex) const
         {
-            const u32 attachmentCount = m_Images.GetSize() / m_Framebuffers.GetSize();
-            return m_Images[imageIndex * attachmentCount + attachmentIndex].GetViews()[0];
+            return m_Views[imageIndex * m_AttachmentCount + attachmentIndex];
         }
+        // the memory backing the images owned by the resources
+        VkDeviceSize GetMemorySize() const;
+        // the memory that would have been needed had shared attachments been created per image
+        VkDeviceSize GetSavedMemory() const
+        {
+            return m_SavedMemory;
+        }
+
         VkFramebuffer GetFramebuffer(const u32 imageIndex) const
         {
-            return m_Framebuffers[imageIndex];
+            return m_Imageless ? m_Framebuffers[0] : m_Framebuffers[imageIndex];
+        }
+        bool IsImageless() const
+        {
+            return m_Imageless;
         }
 
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_imageless_framebuffer)
+        /**
+         * @brief Creates the attachment begin info that supplies the views of an image index to an imageless
+         * framebuffer. It must be chained to the `VkRenderPassBeginInfo`.
+         *
+         * The returned struct points into the resources, which must be kept alive while it is in use.
+         */
+        VkRenderPassAttachmentBeginInfoKHR CreateAttachmentBeginInfo(const u32 imageIndex) const
+        {
+            VkRenderPassAttachmentBeginInfoKHR info{};
+            info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO_KHR;
+            info.attachmentCount = m_AttachmentCount;
+            info.pAttachments = m_Views.GetData() + imageIndex * m_AttachmentCount;
+            return info;
+        }
+#endif
+
       private:
+        void addImage(const DeviceImage &image, const Attachment &attachment, u32 imageCount);
+        void addSharedImage(u32 attachmentIndex);
+
         ProxyDevice m_Device;
-        TKit::TierArray<DeviceImage> m_Images;         // size: m_ImageCount * m_Attachments.GetSize()
-        TKit::TierArray<VkFramebuffer> m_Framebuffers; // size: m_ImageCount
+        TKit::TierArray<DeviceImage> m_Images;         // one per image index and attachment, but one per shared one
+        TKit::TierArray<VkImageView> m_Views;          // size: m_ImageCount * m_Attachments.GetSize()
+        TKit::TierArray<VkFramebuffer> m_Framebuffers; // size: m_ImageCount, or 1 if imageless
+        u32 m_AttachmentCount = 0;
+        VkDeviceSize m_SavedMemory = 0;
+        // imageless framebuffers are owned by a `FramebufferCache`
+        bool m_Imageless = false;
 
         friend class RenderPass;
     };
@@ -184,6 +305,9 @@ class RenderPass
      * case where the underlying resource is directly provided by a `Swapchain` image. See the
      * `ImageFactory::CreateImage()` methods for more.
      *
+     * Shared attachments are only requested for the first image index, and their image is referenced by every frame
+     * buffer. Attachments with the `DeviceImageFlag_Transient` flag must be created with that flag as well.
+     *
      * @tparam F The type of the callback function used for creating image data.
      * @param extent The dimensions of the frame buffer.
      * @param createImageData A callback function that generates image data for each attachment. Takes the image index
@@ -197,12 +321,21 @@ class RenderPass
     {
         Resources resources;
         resources.m_Device = m_Device;
+        resources.m_AttachmentCount = m_Info.Attachments.GetSize();
 
         TKit::TierArray<VkImageView> attachments{m_Info.Attachments.GetSize()};
         for (u32 i = 0; i < m_Info.ImageCount; ++i)
         {
             for (u32 j = 0; j < attachments.GetSize(); ++j)
             {
+                const Attachment &attachment = m_Info.Attachments[j];
+                if (i != 0 && attachment.Shared)
+                {
+                    resources.addSharedImage(j);
+                    attachments[j] = resources.m_Views.GetBack();
+                    continue;
+                }
+
                 const auto imresult = std::forward<F>(createImageData)(i, j);
                 if (!imresult)
                 {
@@ -212,7 +345,7 @@ class RenderPass
                 }
 
                 const DeviceImage &imageData = *imresult;
-                resources.m_Images.Append(imageData);
+                resources.addImage(imageData, attachment, m_Info.ImageCount);
                 attachments[j] = imageData.GetViews()[0];
             }
             VkFramebufferCreateInfo frameBufferInfo{};
@@ -235,6 +368,69 @@ class RenderPass
         return resources;
     }
 
+#if defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_imageless_framebuffer)
+    /**
+     * @brief Creates resources for the render pass backed by a single imageless framebuffer.
+     *
+     * Works as `CreateResources()`, but instead of creating one framebuffer per image, the framebuffer is acquired from
+     * `cache` and shared by every image. The views are supplied when beginning the render pass, through
+     * `Resources::CreateAttachmentBeginInfo()`. Every image index must describe its attachments the same way, which
+     * is always the case for swap chain images and images created alike. The device must have the
+     * `imagelessFramebuffer` feature enabled.
+     *
+     * @tparam F The type of the callback function used for creating image data.
+     * @param extent The dimensions of the frame buffer.
+     * @param createImageData A callback function that generates image data for each attachment. Takes the image index
+     * and attachment index as arguments.
+     * @param cache The cache that owns the framebuffer.
+     * @param frameBufferLayers The number of layers for each frame buffer (default: 1).
+     * @return A `Result` containing the created `Resources` or an error.
+     */
+    template <typename F>
+    VKIT_NO_DISCARD Result<Resources> CreateImagelessResources(const VkExtent2D &extent, F &&createImageData,
+                                                               FramebufferCache &cache,
+                                                               const u32 frameBufferLayers = 1)
+    {
+        Resources resources;
+        resources.m_Device = m_Device;
+        resources.m_AttachmentCount = m_Info.Attachments.GetSize();
+        resources.m_Imageless = true;
+
+        for (u32 i = 0; i < m_Info.ImageCount; ++i)
+            for (u32 j = 0; j < resources.m_AttachmentCount; ++j)
+            {
+                const Attachment &attachment = m_Info.Attachments[j];
+                if (i != 0 && attachment.Shared)
+                {
+                    resources.addSharedImage(j);
+                    continue;
+                }
+
+                const auto imresult = std::forward<F>(createImageData)(i, j);
+                if (!imresult)
+                {
+                    resources.Destroy();
+                    return imresult;
+                }
+
+                resources.addImage(*imresult, attachment, m_Info.ImageCount);
+            }
+
+        const auto fbresult = cache.Acquire(
+            m_RenderPass, extent,
+            TKit::Span<const DeviceImage>{resources.m_Images.GetData(), resources.m_AttachmentCount},
+            frameBufferLayers);
+        if (!fbresult)
+        {
+            resources.Destroy();
+            return fbresult;
+        }
+        resources.m_Framebuffers.Append(*fbresult);
+
+        return resources;
+    }
+#endif
+
     VKIT_SET_DEBUG_NAME(m_RenderPass, VK_OBJECT_TYPE_RENDER_PASS)
 
     const Attachment &GetAttachment(const u32 attachmentIndex) const
@@ -0,0 +1,285 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/rendering_info.hpp"
+#include "tkit/container/stack_array.hpp"
+
+#ifdef VK_KHR_dynamic_rendering
+namespace VKit
+{
+RenderingInfo::Builder::Builder(const ProxyDevice &device, const VkExtent2D &extent)
+    : m_Device(device), m_RenderArea{{0, 0}, extent}
+{
+    m_DepthAttachment.ResolveMode = VK_RESOLVE_MODE_NONE_KHR;
+}
+
+Result<RenderingInfo> RenderingInfo::Builder::Build() const
+{
+    using Res = Result<RenderingInfo>;
+    if (m_ColorAttachments.IsEmpty() && !m_DepthAttachment.Image)
+        return Res::Error(Error_BadInput, "[VULKIT][RENDERING] At least one attachment must be provided");
+
+    const VkExtent2D &extent = m_RenderArea.extent;
+    const auto check = [&](const DeviceImage *image, const u32 viewIndex, const char *name) -> Result<> {
+        if (!image)
+            return Result<>::Ok();
+        if (viewIndex >= image->GetViews().GetSize())
+            return Result<>::Error(
+                Error_BadInput,
+                TKit::TierString::Format("[VULKIT][RENDERING] The {} has no view at index {}", name, viewIndex));
+
+        const DeviceImage::Info &info = image->GetInfo();
+        if (u32(m_RenderArea.offset.x) + extent.width > info.Width ||
+            u32(m_RenderArea.offset.y) + extent.height > info.Height)
+            return Result<>::Error(Error_BadInput,
+                                   TKit::TierString::Format("[VULKIT][RENDERING] The {} ({}x{}) does not cover the "
+                                                            "render area",
+                                                            name, info.Width, info.Height));
+        return Result<>::Ok();
+    };
+
+    Info info{};
+    info.RenderArea = m_RenderArea;
+    info.LayerCount = m_LayerCount;
+    info.ViewMask = m_ViewMask;
+    info.Flags = m_Flags;
+    info.ColorAttachments = m_ColorAttachments;
+    info.DepthAttachment = m_DepthAttachment;
+    info.DepthFormat = VK_FORMAT_UNDEFINED;
+    info.StencilFormat = VK_FORMAT_UNDEFINED;
+
+    for (const Attachment &attachment : m_ColorAttachments)
+    {
+        TKIT_RETURN_IF_FAILED(check(attachment.Image, attachment.ViewIndex, "color attachment"));
+        TKIT_RETURN_IF_FAILED(check(attachment.Resolve, attachment.ResolveViewIndex, "color resolve target"));
+        info.ColorFormats.Append(attachment.Image->GetInfo().Formats.GetFront());
+    }
+    if (const DeviceImage *image = m_DepthAttachment.Image)
+    {
+        TKIT_RETURN_IF_FAILED(check(image, m_DepthAttachment.ViewIndex, "depth attachment"));
+        TKIT_RETURN_IF_FAILED(
+            check(m_DepthAttachment.Resolve, m_DepthAttachment.ResolveViewIndex, "depth resolve target"));
+        const VkFormat format = image->GetInfo().Formats.GetFront();
+        if (image->GetInfo().Flags & DeviceImageFlag_Depth)
+            info.DepthFormat = format;
+        if (image->GetInfo().Flags & DeviceImageFlag_Stencil)
+            info.StencilFormat = format;
+    }
+
+    return Res::Ok(m_Device, info);
+}
+
+RenderingInfo::Builder &RenderingInfo::Builder::AddColorAttachment(DeviceImage &image,
+                                                                   const VkAttachmentLoadOp loadOperation,
+                                                                   const VkAttachmentStoreOp storeOperation,
+                                                                   const VkClearColorValue &clearValue,
+                                                                   const u32 viewIndex)
+{
+    Attachment &attachment = m_ColorAttachments.Append();
+    attachment = {};
+    attachment.Image = &image;
+    attachment.ViewIndex = viewIndex;
+    attachment.LoadOperation = loadOperation;
+    attachment.StoreOperation = storeOperation;
+    attachment.ClearValue.color = clearValue;
+    attachment.ResolveMode = VK_RESOLVE_MODE_NONE_KHR;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::SetDepthAttachment(DeviceImage &image,
+                                                                   const VkAttachmentLoadOp loadOperation,
+                                                                   const VkAttachmentStoreOp storeOperation,
+                                                                   const VkClearDepthStencilValue &clearValue,
+                                                                   const u32 viewIndex)
+{
+    m_DepthAttachment = {};
+    m_DepthAttachment.Image = &image;
+    m_DepthAttachment.ViewIndex = viewIndex;
+    m_DepthAttachment.LoadOperation = loadOperation;
+    m_DepthAttachment.StoreOperation = storeOperation;
+    m_DepthAttachment.ClearValue.depthStencil = clearValue;
+    m_DepthAttachment.ResolveMode = VK_RESOLVE_MODE_NONE_KHR;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::SetResolveTarget(DeviceImage &image,
+                                                                 const VkResolveModeFlagBitsKHR mode,
+                                                                 const u32 viewIndex)
+{
+    TKIT_ASSERT(!m_ColorAttachments.IsEmpty() || m_DepthAttachment.Image,
+                "[VULKIT][RENDERING] An attachment must be added before setting a resolve target");
+    const bool depth = m_ColorAttachments.IsEmpty();
+    Attachment &attachment = depth ? m_DepthAttachment : m_ColorAttachments.GetBack();
+    attachment.Resolve = &image;
+    attachment.ResolveViewIndex = viewIndex;
+    if (mode != VK_RESOLVE_MODE_NONE_KHR)
+        attachment.ResolveMode = mode;
+    else
+        attachment.ResolveMode = depth ? VK_RESOLVE_MODE_SAMPLE_ZERO_BIT_KHR : VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::SetDepthResolveTarget(DeviceImage &image,
+                                                                      const VkResolveModeFlagBitsKHR mode,
+                                                                      const u32 viewIndex)
+{
+    TKIT_ASSERT(m_DepthAttachment.Image,
+                "[VULKIT][RENDERING] A depth attachment must be set before setting its resolve target");
+    TKIT_ASSERT(mode != VK_RESOLVE_MODE_NONE_KHR && mode != VK_RESOLVE_MODE_AVERAGE_BIT_KHR,
+                "[VULKIT][RENDERING] Depth/stencil attachments cannot be resolved with the none or average modes");
+    m_DepthAttachment.Resolve = &image;
+    m_DepthAttachment.ResolveViewIndex = viewIndex;
+    m_DepthAttachment.ResolveMode = mode;
+    return *this;
+}
+
+RenderingInfo::Builder &RenderingInfo::Builder::SetRenderArea(const VkRect2D &area)
+{
+    m_RenderArea = area;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::SetLayerCount(const u32 layerCount)
+{
+    m_LayerCount = layerCount;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::SetViewMask(const u32 viewMask)
+{
+    m_ViewMask = viewMask;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::SetFlags(const VkRenderingFlagsKHR flags)
+{
+    m_Flags = flags;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::AddFlags(const VkRenderingFlagsKHR flags)
+{
+    m_Flags |= flags;
+    return *this;
+}
+RenderingInfo::Builder &RenderingInfo::Builder::RemoveFlags(const VkRenderingFlagsKHR flags)
+{
+    m_Flags &= ~flags;
+    return *this;
+}
+
+void RenderingInfo::Begin(const VkCommandBuffer commandBuffer)
+{
+    TKit::StackArray<VkImageMemoryBarrier> barriers{};
+    barriers.Reserve(2 * m_Info.ColorAttachments.GetSize() + 2);
+    VkPipelineStageFlags srcStage = 0;
+    VkPipelineStageFlags dstStage = 0;
+
+    // the source scope covers previous attachment writes and shader reads, the usual producers of an attachment image
+    const auto transition = [&](DeviceImage *image, const bool load, const bool depth) {
+        const VkImageLayout layout =
+            depth ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        if (!image || image->GetLayout() == layout)
+            return;
+
+        DeviceImage::TransitionInfo info{};
+        if (depth)
+        {
+            info.SrcStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            info.SrcAccess = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            info.DstStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            info.DstAccess =
+                VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        }
+        else
+        {
+            info.SrcStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            info.SrcAccess = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            info.DstStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            info.DstAccess = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        }
+        info.SrcStage |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+
+        VkImageMemoryBarrier &barrier = barriers.Append(image->CreateTransitionLayoutBarrier(layout, info));
+        if (!load)
+            barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        srcStage |= info.SrcStage;
+        dstStage |= info.DstStage;
+        image->SetLayout(layout);
+    };
+
+    TKit::StackArray<VkRenderingAttachmentInfoKHR> colorInfos{};
+    colorInfos.Reserve(m_Info.ColorAttachments.GetSize());
+
+    const auto createAttachmentInfo = [&](const Attachment &attachment, const bool depth) {
+        transition(attachment.Image, attachment.LoadOperation == VK_ATTACHMENT_LOAD_OP_LOAD, depth);
+        // resolve targets are fully overwritten
+        transition(attachment.Resolve, false, depth);
+
+        VkRenderingAttachmentInfoKHR info{};
+        info.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        info.imageView = attachment.Image->GetView(attachment.ViewIndex);
+        info.imageLayout = attachment.Image->GetLayout();
+        info.loadOp = attachment.LoadOperation;
+        info.storeOp = attachment.StoreOperation;
+        info.clearValue = attachment.ClearValue;
+        if (attachment.Resolve)
+        {
+            info.resolveMode = attachment.ResolveMode;
+            info.resolveImageView = attachment.Resolve->GetView(attachment.ResolveViewIndex);
+            info.resolveImageLayout = attachment.Resolve->GetLayout();
+        }
+        return info;
+    };
+
+    for (const Attachment &attachment : m_Info.ColorAttachments)
+        colorInfos.Append(createAttachmentInfo(attachment, false));
+
+    VkRenderingAttachmentInfoKHR depthInfo{};
+    if (m_Info.DepthAttachment.Image)
+        depthInfo = createAttachmentInfo(m_Info.DepthAttachment, true);
+
+    if (!barriers.IsEmpty())
+        m_Device.Table->CmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr,
+                                           barriers.GetSize(), barriers.GetData());
+
+    VkRenderingInfoKHR renderingInfo{};
+    renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+    renderingInfo.flags = m_Info.Flags;
+    renderingInfo.renderArea = m_Info.RenderArea;
+    renderingInfo.layerCount = m_Info.LayerCount;
+    renderingInfo.viewMask = m_Info.ViewMask;
+    renderingInfo.colorAttachmentCount = colorInfos.GetSize();
+    renderingInfo.pColorAttachments = colorInfos.IsEmpty() ? nullptr : colorInfos.GetData();
+    if (m_Info.DepthFormat != VK_FORMAT_UNDEFINED)
+        renderingInfo.pDepthAttachment = &depthInfo;
+    if (m_Info.StencilFormat != VK_FORMAT_UNDEFINED)
+        renderingInfo.pStencilAttachment = &depthInfo;
+
+#    ifdef VKIT_API_VERSION_1_3
+    if (m_Device.Table->vkCmdBeginRendering)
+    {
+        m_Device.Table->CmdBeginRendering(commandBuffer, &renderingInfo);
+        return;
+    }
+#    endif
+    m_Device.Table->CmdBeginRenderingKHR(commandBuffer, &renderingInfo);
+}
+
+void RenderingInfo::End(const VkCommandBuffer commandBuffer) const
+{
+#    ifdef VKIT_API_VERSION_1_3
+    if (m_Device.Table->vkCmdEndRendering)
+    {
+        m_Device.Table->CmdEndRendering(commandBuffer);
+        return;
+    }
+#    endif
+    m_Device.Table->CmdEndRenderingKHR(commandBuffer);
+}
+
+VkPipelineRenderingCreateInfoKHR RenderingInfo::CreatePipelineRenderingInfo() const
+{
+    VkPipelineRenderingCreateInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    info.viewMask = m_Info.ViewMask;
+    info.colorAttachmentCount = m_Info.ColorFormats.GetSize();
+    info.pColorAttachmentFormats = m_Info.ColorFormats.IsEmpty() ? nullptr : m_Info.ColorFormats.GetData();
+    info.depthAttachmentFormat = m_Info.DepthFormat;
+    info.stencilAttachmentFormat = m_Info.StencilFormat;
+    return info;
+}
+
+} // namespace VKit
+#endif
@@ -0,0 +1,134 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_DEVICE_IMAGE
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_DEVICE_IMAGE"
+#endif
+
+#include "vkit/resource/device_image.hpp"
+#include <vulkan/vulkan.h>
+
+#ifdef VK_KHR_dynamic_rendering
+namespace VKit
+{
+/**
+ * @brief Begins and ends dynamic rendering on a set of `DeviceImage` attachments, without render passes or
+ * framebuffers.
+ *
+ * `Begin()` transitions every attachment and resolve target that is not yet in its attachment layout with a single
+ * batched barrier, and then begins rendering. Layouts are tracked through the images themselves, so they must outlive
+ * the `RenderingInfo` and must not be moved while in use. Attachments whose contents are not loaded are transitioned
+ * from `VK_IMAGE_LAYOUT_UNDEFINED`, so that the driver may discard them.
+ *
+ * Since nothing here depends on the image handles beyond recording, resizing only requires recreating the images and
+ * the `RenderingInfo`, which is cheap.
+ *
+ */
+class RenderingInfo
+{
+  public:
+    struct Attachment
+    {
+        DeviceImage *Image;
+        u32 ViewIndex;
+        VkAttachmentLoadOp LoadOperation;
+        VkAttachmentStoreOp StoreOperation;
+        VkClearValue ClearValue;
+
+        DeviceImage *Resolve;
+        u32 ResolveViewIndex;
+        VkResolveModeFlagBitsKHR ResolveMode;
+    };
+
+    class Builder
+    {
+      public:
+        // the render area defaults to the whole extent
+        Builder(const ProxyDevice &device, const VkExtent2D &extent);
+
+        VKIT_NO_DISCARD Result<RenderingInfo> Build() const;
+
+        Builder &AddColorAttachment(DeviceImage &image, VkAttachmentLoadOp loadOperation = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                    VkAttachmentStoreOp storeOperation = VK_ATTACHMENT_STORE_OP_STORE,
+                                    const VkClearColorValue &clearValue = {}, u32 viewIndex = 0);
+        // used for both depth and stencil if the image has the `DeviceImageFlag_Stencil` flag
+        Builder &SetDepthAttachment(DeviceImage &image,
+                                    VkAttachmentLoadOp loadOperation = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                    VkAttachmentStoreOp storeOperation = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                    const VkClearDepthStencilValue &clearValue = {1.f, 0}, u32 viewIndex = 0);
+        // applies to the last color attachment added, or the depth attachment if no color attachment has been added.
+        // without a mode, color attachments are averaged and depth attachments take sample zero, as depth/stencil
+        // cannot be averaged. use `SetDepthResolveTarget()` to resolve depth alongside color attachments
+        Builder &SetResolveTarget(DeviceImage &image, VkResolveModeFlagBitsKHR mode = VK_RESOLVE_MODE_NONE_KHR,
+                                  u32 viewIndex = 0);
+        // applies to the depth attachment regardless of the color attachments. the mode must be one the device lists in
+        // its supported depth (and stencil) resolve modes, which never include averaging
+        Builder &SetDepthResolveTarget(DeviceImage &image,
+                                       VkResolveModeFlagBitsKHR mode = VK_RESOLVE_MODE_SAMPLE_ZERO_BIT_KHR,
+                                       u32 viewIndex = 0);
+
+        Builder &SetRenderArea(const VkRect2D &area);
+        Builder &SetLayerCount(u32 layerCount);
+        Builder &SetViewMask(u32 viewMask);
+
+        Builder &SetFlags(VkRenderingFlagsKHR flags);
+        Builder &AddFlags(VkRenderingFlagsKHR flags);
+        Builder &RemoveFlags(VkRenderingFlagsKHR flags);
+
+      private:
+        ProxyDevice m_Device;
+        VkRect2D m_RenderArea;
+        u32 m_LayerCount = 1;
+        u32 m_ViewMask = 0;
+        VkRenderingFlagsKHR m_Flags = 0;
+
+        TKit::TierArray<Attachment> m_ColorAttachments{};
+        Attachment m_DepthAttachment{};
+    };
+
+    struct Info
+    {
+        VkRect2D RenderArea;
+        u32 LayerCount;
+        u32 ViewMask;
+        VkRenderingFlagsKHR Flags;
+        TKit::TierArray<Attachment> ColorAttachments;
+        Attachment DepthAttachment;
+        // the attachment formats, to create compatible pipelines. see `CreatePipelineRenderingInfo()`
+        TKit::TierArray<VkFormat> ColorFormats;
+        VkFormat DepthFormat;
+        VkFormat StencilFormat;
+    };
+
+    RenderingInfo() = default;
+    RenderingInfo(const ProxyDevice &device, const Info &info) : m_Device(device), m_Info(info)
+    {
+    }
+
+    // transitions the attachments that need it with a single barrier and begins rendering
+    void Begin(VkCommandBuffer commandBuffer);
+    void End(VkCommandBuffer commandBuffer) const;
+
+    /**
+     * @brief Creates a pipeline rendering create info matching the attachments, to be fed to a
+     * `GraphicsPipeline::Builder`.
+     *
+     * The returned struct points into this object, which must be kept alive while it is in use.
+     */
+    VkPipelineRenderingCreateInfoKHR CreatePipelineRenderingInfo() const;
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    const Info &GetInfo() const
+    {
+        return m_Info;
+    }
+
+  private:
+    ProxyDevice m_Device{};
+    Info m_Info{};
+};
+} // namespace VKit
+#endif
@@ -1,33 +1,110 @@
 #include "vkit/core/pch.hpp"
 #include "vkit/state/shader.hpp"
-#include "tkit/container/stack_array.hpp"
 
 #include <fstream>
 #include <cstdlib>
+#if defined(TKIT_OS_LINUX) || defined(TKIT_OS_APPLE)
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
 
 namespace VKit
 {
-TKIT_COMPILER_WARNING_IGNORE_PUSH()
-TKIT_MSVC_WARNING_IGNORE(6262)
+static constexpr u32 s_SpirvMagic = 0x07230203;
 
-Result<Shader> Shader::Create(const ProxyDevice &device, const TKit::StringView spirvPath)
+SpirvFile::~SpirvFile()
+{
+    Close();
+}
+
+Result<> SpirvFile::Open(const TKit::StringView path, const bool map)
+{
+    Close();
+#if defined(TKIT_OS_LINUX) || defined(TKIT_OS_APPLE)
+    if (map)
+    {
+        // NOTE(Isma): Not very nice that GetData() on a string view
+        const int fd = open(path.GetData(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+            return Result<>::Error(Error_FileNotFound,
+                                   TKit::TierString::Format("[VULKIT][SHADER] File at path '{}' not found", path));
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0)
+        {
+            close(fd);
+            return Result<>::Error(Error_BadInput,
+                                   TKit::TierString::Format("[VULKIT][SHADER] File at path '{}' is empty", path));
+        }
+
+        void *mapping = mmap(nullptr, static_cast<usize>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping keeps its own reference to the file
+        close(fd);
+        if (mapping == MAP_FAILED)
+            return Result<>::Error(Error_Unknown,
+                                   TKit::TierString::Format("[VULKIT][SHADER] Failed to map file at path '{}'", path));
+
+        m_Mapping = mapping;
+        m_Code = scast<const u32 *>(mapping);
+        m_Size = static_cast<usize>(info.st_size);
+    }
+    else
+#else
+    (void)map;
+#endif
+    {
+        std::ifstream file{path.GetData(), std::ios::ate | std::ios::binary};
+        if (!file.is_open())
+            return Result<>::Error(Error_FileNotFound,
+                                   TKit::TierString::Format("[VULKIT][SHADER] File at path '{}' not found", path));
+
+        const std::streamoff end = file.tellg();
+        if (end <= 0)
+            return Result<>::Error(Error_BadInput,
+                                   TKit::TierString::Format("[VULKIT][SHADER] File at path '{}' is empty", path));
+
+        const usize fileSize = static_cast<usize>(end);
+        // reading into u32 storage keeps the code aligned
+        m_Buffer.Resize(static_cast<u32>((fileSize + sizeof(u32) - 1) / sizeof(u32)));
+        file.seekg(0);
+        file.read(rcast<char *>(m_Buffer.GetData()), fileSize);
+        // the file may have been truncated between the size query and the read
+        m_Code = m_Buffer.GetData();
+        m_Size = static_cast<usize>(file.gcount());
+    }
+
+    if (m_Size % sizeof(u32) != 0 || m_Size < sizeof(u32) || rcast<std::uintptr_t>(m_Code) % alignof(u32) != 0 ||
+        m_Code[0] != s_SpirvMagic)
+    {
+        Close();
+        return Result<>::Error(
+            Error_BadInput, TKit::TierString::Format("[VULKIT][SHADER] File at path '{}' is not valid SPIR-V", path));
+    }
+    return Result<>::Ok();
+}
+
+void SpirvFile::Close()
 {
-    // NOTE(Isma): Not very nice that GetData() on a string view
-    std::ifstream file{spirvPath.GetData(), std::ios::ate | std::ios::binary};
-    if (!file.is_open())
-        return Result<Shader>::Error(Error_FileNotFound,
-                                     TKit::TierString::Format("[VULKIT][SHADER] File at path '{}' not found", spirvPath));
-
-    const auto fileSize = file.tellg();
-
-    TKit::StackArray<char> code{u32(fileSize)};
-    file.seekg(0);
-    file.read(code.GetData(), fileSize);
-    const u32 *spv = rcast<const u32 *>(code.GetData());
-    return Create(device, spv, fileSize);
+#if defined(TKIT_OS_LINUX) || defined(TKIT_OS_APPLE)
+    if (m_Mapping)
+    {
+        munmap(m_Mapping, m_Size);
+        m_Mapping = nullptr;
+    }
+#endif
+    m_Buffer.Clear();
+    m_Code = nullptr;
+    m_Size = 0;
 }
 
-TKIT_COMPILER_WARNING_IGNORE_POP()
+Result<Shader> Shader::Create(const ProxyDevice &device, const TKit::StringView spirvPath)
+{
+    SpirvFile file{};
+    TKIT_RETURN_IF_FAILED(file.Open(spirvPath));
+    return Create(device, file.GetCode(), file.GetSize());
+}
 
 Result<Shader> Shader::Create(const ProxyDevice &device, const u32 *spirv, const size_t size)
 {
@@ -12,6 +12,52 @@
 
 namespace VKit
 {
+/**
+ * @brief A read-only view of a SPIR-V file.
+ *
+ * By default, the file is read into an aligned buffer. It can instead be memory mapped where supported, so that its
+ * contents are handed directly to `vkCreateShaderModule` without being copied. Mapping is only safe for files that are
+ * not rewritten while open: accessing a mapping of a file truncated in place raises SIGBUS, which is what happens when
+ * a compiler or editor rewrites a shader during hot reload. Opening validates the size, alignment and magic number of
+ * the code.
+ *
+ */
+class SpirvFile
+{
+  public:
+    SpirvFile() = default;
+    ~SpirvFile();
+
+    SpirvFile(const SpirvFile &) = delete;
+    SpirvFile &operator=(const SpirvFile &) = delete;
+
+    // `map` is ignored where memory mapping is not supported
+    VKIT_NO_DISCARD Result<> Open(TKit::StringView path, bool map = false);
+    void Close();
+
+    const u32 *GetCode() const
+    {
+        return m_Code;
+    }
+    // in bytes
+    usize GetSize() const
+    {
+        return m_Size;
+    }
+    operator bool() const
+    {
+        return m_Code != nullptr;
+    }
+
+  private:
+    const u32 *m_Code = nullptr;
+    usize m_Size = 0;
+    TKit::TierArray<u32> m_Buffer{};
+#if defined(TKIT_OS_LINUX) || defined(TKIT_OS_APPLE)
+    void *m_Mapping = nullptr;
+#endif
+};
+
 class Shader
 {
   public:
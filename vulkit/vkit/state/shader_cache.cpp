@@ -0,0 +1,140 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/shader_cache.hpp"
+
+#include <cstring>
+
+namespace VKit
+{
+void ShaderCache::Destroy()
+{
+    std::scoped_lock lock{m_Mutex};
+    for (auto &[key, entry] : m_Modules)
+        entry.Module.Destroy();
+    m_Modules.clear();
+}
+
+Result<Shader> ShaderCache::Load(const TKit::StringView spirvPath)
+{
+    SpirvFile file{};
+    TKIT_RETURN_IF_FAILED(file.Open(spirvPath));
+    return Create(file.GetCode(), file.GetSize());
+}
+
+Shader *ShaderCache::find(const Key &key, const u32 *spirv)
+{
+    const auto [begin, end] = m_Modules.equal_range(key);
+    for (auto it = begin; it != end; ++it)
+        if (std::memcmp(it->second.Code.GetData(), spirv, key.Size) == 0)
+            return &it->second.Module;
+    return nullptr;
+}
+
+Result<Shader> ShaderCache::Create(const u32 *spirv, const usize size)
+{
+    // keyed by the original code, so that hits never pay for stripping
+    const Key key{Hash(spirv, size), size};
+    {
+        std::scoped_lock lock{m_Mutex};
+        if (const Shader *shader = find(key, spirv))
+            return Result<Shader>::Ok(*shader);
+    }
+
+    const auto create = [&]() -> Result<Shader> {
+        if (!(m_Flags & ShaderCacheFlag_StripDebugInfo))
+            return Shader::Create(m_Device, spirv, size);
+
+        TKit::TierArray<u32> stripped{};
+        StripDebugInfo(spirv, size, stripped);
+        return Shader::Create(m_Device, stripped.GetData(), stripped.GetSize() * sizeof(u32));
+    };
+
+    auto result = create();
+    TKIT_RETURN_ON_ERROR(result);
+
+    Entry entry{};
+    entry.Code.Resize(static_cast<u32>(size / sizeof(u32)));
+    std::memcpy(entry.Code.GetData(), spirv, size);
+    entry.Module = *result;
+
+    std::scoped_lock lock{m_Mutex};
+    // another thread may have created a module for the same code in the meantime
+    if (const Shader *shader = find(key, spirv))
+    {
+        result->Destroy();
+        return Result<Shader>::Ok(*shader);
+    }
+    m_Modules.emplace(key, std::move(entry));
+    return result;
+}
+
+u32 ShaderCache::GetModuleCount() const
+{
+    std::scoped_lock lock{m_Mutex};
+    return static_cast<u32>(m_Modules.size());
+}
+
+u64 ShaderCache::Hash(const u32 *spirv, const usize size)
+{
+    constexpr u64 prime = 0x9E3779B97F4A7C15ULL;
+    const usize words = size / sizeof(u32);
+
+    u64 hash = size * prime;
+    usize i = 0;
+    for (; i + 1 < words; i += 2)
+    {
+        // memcpy, as the code is only guaranteed to be 4 byte aligned
+        u64 word;
+        std::memcpy(&word, spirv + i, sizeof(u64));
+        hash ^= word;
+        hash *= prime;
+        hash ^= hash >> 32;
+    }
+    if (i < words)
+    {
+        hash ^= spirv[i];
+        hash *= prime;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+void ShaderCache::StripDebugInfo(const u32 *spirv, const usize size, TKit::TierArray<u32> &stripped)
+{
+    constexpr u32 headerSize = 5;
+    const usize count = size / sizeof(u32);
+
+    stripped.Clear();
+    stripped.Reserve(static_cast<u32>(count));
+    for (usize i = 0; i < std::min<usize>(headerSize, count); ++i)
+        stripped.Append(spirv[i]);
+
+    usize pos = headerSize;
+    while (pos < count)
+    {
+        const u32 opcode = spirv[pos] & 0xFFFF;
+        const u32 wordCount = spirv[pos] >> 16;
+        // malformed code is copied as is and left for the driver to reject
+        if (wordCount == 0 || pos + wordCount > count)
+        {
+            for (; pos < count; ++pos)
+                stripped.Append(spirv[pos]);
+            return;
+        }
+
+        // OpString is kept, as non-semantic debug info may reference it
+        const bool debug = opcode == 2 ||   // OpSourceContinued
+                           opcode == 3 ||   // OpSource
+                           opcode == 4 ||   // OpSourceExtension
+                           opcode == 5 ||   // OpName
+                           opcode == 6 ||   // OpMemberName
+                           opcode == 8 ||   // OpLine
+                           opcode == 317 || // OpNoLine
+                           opcode == 330;   // OpModuleProcessed
+        if (!debug)
+            for (u32 i = 0; i < wordCount; ++i)
+                stripped.Append(spirv[pos + i]);
+        pos += wordCount;
+    }
+}
+
+} // namespace VKit
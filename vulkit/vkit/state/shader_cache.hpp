@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_SHADERS
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_SHADERS"
+#endif
+
+#include "vkit/state/shader.hpp"
+#include <unordered_map>
+#include <mutex>
+
+namespace VKit
+{
+using ShaderCacheFlags = u8;
+enum ShaderCacheFlagBit : ShaderCacheFlags
+{
+    // removes OpName, OpMemberName, OpLine, OpNoLine, OpSource* and OpModuleProcessed before creating modules
+    ShaderCacheFlag_StripDebugInfo = 1U << 0
+};
+
+/**
+ * @brief Deduplicates shader modules by the contents of their SPIR-V.
+ *
+ * Code is looked up by a fast 64-bit content hash together with its size, and a copy of it is kept to confirm hits, so
+ * loading the same SPIR-V twice, from the same file or from different ones, returns the module created the first time.
+ * Modules are created outside of the cache lock, so loads from several threads do not serialize on the driver. Modules
+ * are owned by the cache and destroyed with `Destroy()`.
+ *
+ */
+class ShaderCache
+{
+  public:
+    ShaderCache() = default;
+    ShaderCache(const ProxyDevice &device, const ShaderCacheFlags flags = 0) : m_Device(device), m_Flags(flags)
+    {
+    }
+
+    ShaderCache(const ShaderCache &) = delete;
+    ShaderCache &operator=(const ShaderCache &) = delete;
+
+    void Destroy();
+
+    // reads the file and returns the module for its contents, creating it if needed
+    VKIT_NO_DISCARD Result<Shader> Load(TKit::StringView spirvPath);
+    // returns the module for the code, creating it if needed. the size is in bytes
+    VKIT_NO_DISCARD Result<Shader> Create(const u32 *spirv, usize size);
+
+    u32 GetModuleCount() const;
+
+    // hashes 8 bytes at a time. the size must be a multiple of 4, as is the case for any SPIR-V module
+    static u64 Hash(const u32 *spirv, usize size);
+    // writes the code without debug instructions into `stripped`. the size is in bytes
+    static void StripDebugInfo(const u32 *spirv, usize size, TKit::TierArray<u32> &stripped);
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    ShaderCacheFlags GetFlags() const
+    {
+        return m_Flags;
+    }
+
+  private:
+    struct Key
+    {
+        u64 Hash;
+        usize Size;
+        bool operator==(const Key &other) const
+        {
+            return Hash == other.Hash && Size == other.Size;
+        }
+    };
+    struct KeyHash
+    {
+        usize operator()(const Key &key) const
+        {
+            return static_cast<usize>(key.Hash ^ key.Size);
+        }
+    };
+
+    struct Entry
+    {
+        // the original code, compared on every hit
+        TKit::TierArray<u32> Code;
+        Shader Module;
+    };
+
+    Shader *find(const Key &key, const u32 *spirv);
+
+    ProxyDevice m_Device{};
+    ShaderCacheFlags m_Flags = 0;
+    std::unordered_multimap<Key, Entry, KeyHash> m_Modules{};
+    mutable std::mutex m_Mutex{};
+};
+} // namespace VKit
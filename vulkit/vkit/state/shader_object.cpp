@@ -0,0 +1,175 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/shader_object.hpp"
+
+#ifdef VK_EXT_shader_object
+namespace VKit
+{
+Result<ShaderObject> ShaderObject::Builder::Build() const
+{
+    if (m_Stages.IsEmpty())
+        return Result<ShaderObject>::Error(Error_BadInput, "[VULKIT][SHADER-OBJECT] At least one stage must be added");
+
+    const bool linked = m_Flags & VK_SHADER_CREATE_LINK_STAGE_BIT_EXT;
+    const u32 count = m_Stages.GetSize();
+
+    TKit::TierArray<VkShaderCreateInfoEXT> createInfos{};
+    createInfos.Resize(count);
+    for (u32 i = 0; i < count; ++i)
+    {
+        const Stage &stage = m_Stages[i];
+
+        VkShaderStageFlags nextStages = stage.NextStages;
+        if (nextStages == 0)
+            for (u32 j = i + 1; j < count; ++j)
+                nextStages |= m_Stages[j].Stage;
+
+        VkShaderCreateInfoEXT &info = createInfos[i];
+        info = {};
+        info.sType = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT;
+        info.flags = m_Flags;
+        info.stage = stage.Stage;
+        info.nextStage = nextStages;
+        info.codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+        info.codeSize = stage.Size;
+        info.pCode = stage.Code;
+        info.pName = stage.EntryPoint;
+        info.setLayoutCount = m_LayoutInfo.DescriptorSetLayouts.GetSize();
+        info.pSetLayouts = m_LayoutInfo.DescriptorSetLayouts.GetData();
+        info.pushConstantRangeCount = m_LayoutInfo.PushConstantRanges.GetSize();
+        info.pPushConstantRanges = m_LayoutInfo.PushConstantRanges.GetData();
+        info.pSpecializationInfo = stage.Specialization;
+    }
+
+    TKit::TierArray<VkShaderEXT> shaders{};
+    shaders.Resize(count, VK_NULL_HANDLE);
+
+    // on failure, some shaders may still have been created and must be destroyed
+    const auto cleanup = [&] {
+        for (const VkShaderEXT shader : shaders)
+            if (shader)
+                m_Device.Table->DestroyShaderEXT(m_Device, shader, m_Device.AllocationCallbacks);
+    };
+
+    VKIT_RETURN_IF_FAILED(m_Device.Table->CreateShadersEXT(m_Device, count, createInfos.GetData(),
+                                                           m_Device.AllocationCallbacks, shaders.GetData()),
+                          Result<ShaderObject>, cleanup());
+
+    Info info{};
+    info.Linked = linked;
+    for (const Stage &stage : m_Stages)
+        info.Stages.Append(stage.Stage);
+
+    return Result<ShaderObject>::Ok(m_Device, shaders, info);
+}
+
+void ShaderObject::Destroy()
+{
+    for (const VkShaderEXT shader : m_Shaders)
+        m_Device.Table->DestroyShaderEXT(m_Device, shader, m_Device.AllocationCallbacks);
+    m_Shaders.Clear();
+}
+
+void ShaderObject::Bind(const VkCommandBuffer commandBuffer) const
+{
+    m_Device.Table->CmdBindShadersEXT(commandBuffer, m_Info.Stages.GetSize(), m_Info.Stages.GetData(),
+                                      m_Shaders.GetData());
+}
+
+void ShaderObject::Unbind(const VkCommandBuffer commandBuffer) const
+{
+    // a null shader array unbinds every listed stage
+    m_Device.Table->CmdBindShadersEXT(commandBuffer, m_Info.Stages.GetSize(), m_Info.Stages.GetData(), nullptr);
+}
+
+void ShaderObject::SetDefaultState(const VkCommandBuffer commandBuffer, const VkExtent2D &extent,
+                                   const u32 colorAttachmentCount) const
+{
+    const auto table = m_Device.Table;
+
+    VkViewport viewport{};
+    viewport.width = static_cast<f32>(extent.width);
+    viewport.height = static_cast<f32>(extent.height);
+    viewport.maxDepth = 1.f;
+    const VkRect2D scissor{{0, 0}, extent};
+    table->CmdSetViewportWithCountEXT(commandBuffer, 1, &viewport);
+    table->CmdSetScissorWithCountEXT(commandBuffer, 1, &scissor);
+
+    table->CmdSetVertexInputEXT(commandBuffer, 0, nullptr, 0, nullptr);
+    table->CmdSetPrimitiveTopologyEXT(commandBuffer, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+    table->CmdSetPrimitiveRestartEnableEXT(commandBuffer, VK_FALSE);
+
+    table->CmdSetRasterizerDiscardEnableEXT(commandBuffer, VK_FALSE);
+    table->CmdSetPolygonModeEXT(commandBuffer, VK_POLYGON_MODE_FILL);
+    table->CmdSetCullModeEXT(commandBuffer, VK_CULL_MODE_NONE);
+    table->CmdSetFrontFaceEXT(commandBuffer, VK_FRONT_FACE_COUNTER_CLOCKWISE);
+    table->CmdSetDepthClampEnableEXT(commandBuffer, VK_FALSE);
+    table->CmdSetDepthBiasEnableEXT(commandBuffer, VK_FALSE);
+
+    const VkSampleMask sampleMask = ~VkSampleMask{0};
+    table->CmdSetRasterizationSamplesEXT(commandBuffer, VK_SAMPLE_COUNT_1_BIT);
+    table->CmdSetSampleMaskEXT(commandBuffer, VK_SAMPLE_COUNT_1_BIT, &sampleMask);
+    table->CmdSetAlphaToCoverageEnableEXT(commandBuffer, VK_FALSE);
+    table->CmdSetAlphaToOneEnableEXT(commandBuffer, VK_FALSE);
+
+    table->CmdSetDepthTestEnableEXT(commandBuffer, VK_FALSE);
+    table->CmdSetDepthWriteEnableEXT(commandBuffer, VK_FALSE);
+    table->CmdSetDepthCompareOpEXT(commandBuffer, VK_COMPARE_OP_LESS);
+    table->CmdSetDepthBoundsTestEnableEXT(commandBuffer, VK_FALSE);
+    table->CmdSetStencilTestEnableEXT(commandBuffer, VK_FALSE);
+
+    table->CmdSetLogicOpEnableEXT(commandBuffer, VK_FALSE);
+    if (colorAttachmentCount == 0)
+        return;
+
+    TKit::TierArray<VkBool32> blendEnables{};
+    TKit::TierArray<VkColorComponentFlags> writeMasks{};
+    blendEnables.Resize(colorAttachmentCount, VK_FALSE);
+    writeMasks.Resize(colorAttachmentCount, VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                                VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT);
+    table->CmdSetColorBlendEnableEXT(commandBuffer, 0, colorAttachmentCount, blendEnables.GetData());
+    table->CmdSetColorWriteMaskEXT(commandBuffer, 0, colorAttachmentCount, writeMasks.GetData());
+}
+
+VkShaderEXT ShaderObject::GetHandle(const VkShaderStageFlagBits stage) const
+{
+    for (u32 i = 0; i < m_Info.Stages.GetSize(); ++i)
+        if (m_Info.Stages[i] == stage)
+            return m_Shaders[i];
+    return VK_NULL_HANDLE;
+}
+
+ShaderObject::Builder &ShaderObject::Builder::AddStage(const VkShaderStageFlagBits stage, const u32 *spirv,
+                                                       const usize size, const VkShaderStageFlags nextStages,
+                                                       const char *entryPoint,
+                                                       const VkSpecializationInfo *specialization)
+{
+    m_Stages.Append(Stage{stage, nextStages, spirv, size, entryPoint, specialization});
+    return *this;
+}
+
+ShaderObject::Builder &ShaderObject::Builder::SetLinked(const bool linked)
+{
+    if (linked)
+        m_Flags |= VK_SHADER_CREATE_LINK_STAGE_BIT_EXT;
+    else
+        m_Flags &= ~VK_SHADER_CREATE_LINK_STAGE_BIT_EXT;
+    return *this;
+}
+
+ShaderObject::Builder &ShaderObject::Builder::SetFlags(const VkShaderCreateFlagsEXT flags)
+{
+    m_Flags = flags;
+    return *this;
+}
+ShaderObject::Builder &ShaderObject::Builder::AddFlags(const VkShaderCreateFlagsEXT flags)
+{
+    m_Flags |= flags;
+    return *this;
+}
+ShaderObject::Builder &ShaderObject::Builder::RemoveFlags(const VkShaderCreateFlagsEXT flags)
+{
+    m_Flags &= ~flags;
+    return *this;
+}
+} // namespace VKit
+#endif
@@ -0,0 +1,136 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_SHADERS
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_SHADERS"
+#endif
+
+#ifndef VKIT_ENABLE_PIPELINE_LAYOUT
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_PIPELINE_LAYOUT"
+#endif
+
+#include "vkit/state/pipeline_layout.hpp"
+#include <vulkan/vulkan.h>
+
+#ifdef VK_EXT_shader_object
+namespace VKit
+{
+/**
+ * @brief A set of `VkShaderEXT` objects created together from SPIR-V, used in place of a graphics or compute pipeline.
+ *
+ * Stages can be created linked, which lets the driver optimize across them as it would for a pipeline, or unlinked, so
+ * that each stage can be freely mixed with others at bind time. Descriptor set layouts and push constant ranges are
+ * taken from a `PipelineLayout`, so the same descriptor sets can be bound with either path.
+ *
+ * No state is baked into shader objects: everything a pipeline would hold must be set with dynamic state commands
+ * before drawing. `SetDefaultState()` records sensible defaults for all of it.
+ *
+ * Requires the `shaderObject` feature.
+ *
+ */
+class ShaderObject
+{
+  public:
+    class Builder
+    {
+      public:
+        Builder(const ProxyDevice &device, const PipelineLayout::Info &layoutInfo)
+            : m_Device(device), m_LayoutInfo(layoutInfo)
+        {
+        }
+        Builder(const ProxyDevice &device, const PipelineLayout &layout) : Builder(device, layout.GetInfo())
+        {
+        }
+
+        VKIT_NO_DISCARD Result<ShaderObject> Build() const;
+
+        /**
+         * @brief Add a shader stage from SPIR-V code. The code must outlive the builder.
+         *
+         * @param stage The stage the code is for.
+         * @param spirv The SPIR-V code.
+         * @param size The size of the code, in bytes.
+         * @param nextStages The stages that may follow this one. If 0, every stage added after this one is used.
+         * @param entryPoint The entry point name.
+         * @param specialization Optional specialization constants.
+         */
+        Builder &AddStage(VkShaderStageFlagBits stage, const u32 *spirv, usize size, VkShaderStageFlags nextStages = 0,
+                          const char *entryPoint = "main", const VkSpecializationInfo *specialization = nullptr);
+
+        Builder &SetLinked(bool linked = true);
+
+        Builder &SetFlags(VkShaderCreateFlagsEXT flags);
+        Builder &AddFlags(VkShaderCreateFlagsEXT flags);
+        Builder &RemoveFlags(VkShaderCreateFlagsEXT flags);
+
+      private:
+        struct Stage
+        {
+            VkShaderStageFlagBits Stage;
+            VkShaderStageFlags NextStages;
+            const u32 *Code;
+            usize Size;
+            const char *EntryPoint;
+            const VkSpecializationInfo *Specialization;
+        };
+
+        ProxyDevice m_Device;
+        PipelineLayout::Info m_LayoutInfo;
+
+        TKit::TierArray<Stage> m_Stages{};
+        VkShaderCreateFlagsEXT m_Flags = 0;
+    };
+
+    struct Info
+    {
+        TKit::TierArray<VkShaderStageFlagBits> Stages;
+        bool Linked;
+    };
+
+    ShaderObject() = default;
+    ShaderObject(const ProxyDevice &device, const TKit::TierArray<VkShaderEXT> &shaders, const Info &info)
+        : m_Device(device), m_Shaders(shaders), m_Info(info)
+    {
+    }
+
+    void Destroy();
+
+    // binds every stage of the object. stages not owned by this object keep whatever was bound to them
+    void Bind(VkCommandBuffer commandBuffer) const;
+    // binds null shaders to every stage of the object
+    void Unbind(VkCommandBuffer commandBuffer) const;
+
+    /**
+     * @brief Records defaults for all the state shader objects require to be set dynamically.
+     *
+     * Sets a single full viewport and scissor, triangle lists, no culling, counter-clockwise front faces, filled
+     * polygons, one sample, no depth or stencil testing, blending disabled with all color components written for
+     * `colorAttachmentCount` attachments and an empty vertex input. Individual state can be overriden afterwards.
+     *
+     */
+    void SetDefaultState(VkCommandBuffer commandBuffer, const VkExtent2D &extent, u32 colorAttachmentCount) const;
+
+    // returns a null handle if the object has no such stage
+    VkShaderEXT GetHandle(VkShaderStageFlagBits stage) const;
+
+    const Info &GetInfo() const
+    {
+        return m_Info;
+    }
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+    operator bool() const
+    {
+        return !m_Shaders.IsEmpty();
+    }
+
+  private:
+    ProxyDevice m_Device{};
+    TKit::TierArray<VkShaderEXT> m_Shaders{};
+    Info m_Info{};
+};
+} // namespace VKit
+#endif
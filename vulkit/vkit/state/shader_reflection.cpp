@@ -0,0 +1,746 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/shader_reflection.hpp"
+
+#include <algorithm>
+
+namespace VKit
+{
+namespace
+{
+// only the subset of the SPIR-V specification needed for reflection
+namespace Spv
+{
+constexpr u32 Magic = 0x07230203;
+constexpr u32 HeaderSize = 5;
+constexpr u32 Unset = UINT32_MAX;
+
+// universal limits of the specification. a corrupt module may claim more, but a valid one never does
+constexpr u32 MaxBound = 4194303;
+constexpr u32 MaxStructMembers = 16383;
+constexpr u32 MaxTypeDepth = 255;
+
+enum Op : u32
+{
+    Op_EntryPoint = 15,
+    Op_ExecutionMode = 16,
+    Op_TypeBool = 20,
+    Op_TypeInt = 21,
+    Op_TypeFloat = 22,
+    Op_TypeVector = 23,
+    Op_TypeMatrix = 24,
+    Op_TypeImage = 25,
+    Op_TypeSampler = 26,
+    Op_TypeSampledImage = 27,
+    Op_TypeArray = 28,
+    Op_TypeRuntimeArray = 29,
+    Op_TypeStruct = 30,
+    Op_TypePointer = 32,
+    Op_Constant = 43,
+    Op_SpecConstantTrue = 48,
+    Op_SpecConstantFalse = 49,
+    Op_SpecConstant = 50,
+    Op_Variable = 59,
+    Op_Decorate = 71,
+    Op_MemberDecorate = 72,
+    Op_TypeAccelerationStructureKHR = 5341,
+};
+
+enum Decoration : u32
+{
+    Decoration_SpecId = 1,
+    Decoration_Block = 2,
+    Decoration_BufferBlock = 3,
+    Decoration_ArrayStride = 6,
+    Decoration_MatrixStride = 7,
+    Decoration_BuiltIn = 11,
+    Decoration_Location = 30,
+    Decoration_Binding = 33,
+    Decoration_DescriptorSet = 34,
+    Decoration_Offset = 35,
+};
+
+enum StorageClass : u32
+{
+    StorageClass_UniformConstant = 0,
+    StorageClass_Input = 1,
+    StorageClass_Uniform = 2,
+    StorageClass_PushConstant = 9,
+    StorageClass_StorageBuffer = 12,
+};
+
+// the least amount of words, opcode included, an instruction needs for the operands reflection reads from it
+constexpr u32 GetMinWordCount(const u32 opcode)
+{
+    switch (opcode)
+    {
+    case Op_TypeBool:
+    case Op_TypeSampler:
+    case Op_TypeStruct:
+    case Op_TypeAccelerationStructureKHR:
+        return 2;
+    case Op_ExecutionMode:
+    case Op_Decorate:
+    case Op_TypeFloat:
+    case Op_TypeSampledImage:
+    case Op_TypeRuntimeArray:
+    case Op_SpecConstantTrue:
+    case Op_SpecConstantFalse:
+        return 3;
+    case Op_EntryPoint:
+    case Op_MemberDecorate:
+    case Op_TypeInt:
+    case Op_TypeVector:
+    case Op_TypeMatrix:
+    case Op_TypeArray:
+    case Op_TypePointer:
+    case Op_Constant:
+    case Op_SpecConstant:
+    case Op_Variable:
+        return 4;
+    case Op_TypeImage:
+        return 9;
+    default:
+        return 1;
+    }
+}
+
+constexpr u32 ExecutionModel_Vertex = 0;
+constexpr u32 ExecutionMode_LocalSize = 17;
+constexpr u32 Dim_Buffer = 5;
+constexpr u32 Dim_SubpassData = 6;
+} // namespace Spv
+
+struct Member
+{
+    u32 Offset = Spv::Unset;
+    u32 MatrixStride = 0;
+};
+
+struct Id
+{
+    u32 Opcode = 0;
+    // position of the defining instruction in the module, so that operands are read in place
+    u32 Position = 0;
+
+    u32 Set = Spv::Unset;
+    u32 Binding = Spv::Unset;
+    u32 Location = Spv::Unset;
+    u32 SpecId = Spv::Unset;
+    u32 ArrayStride = 0;
+    bool Block = false;
+    bool BufferBlock = false;
+    bool BuiltIn = false;
+    TKit::TierArray<Member> Members{};
+};
+
+class Parser
+{
+  public:
+    Parser(const u32 *words, const u32 count) : m_Words(words), m_Count(count)
+    {
+    }
+
+    Result<> Parse(const u32 bound)
+    {
+        // stripped or optimized modules may leave gaps in their ids, so the bound is only checked against the limit
+        if (bound > Spv::MaxBound)
+            return Result<>::Error(Error_BadInput,
+                                   TKit::TierString::Format(
+                                       "[VULKIT][SHADER-REFLECTION] SPIR-V id bound {} exceeds the limit of {}", bound,
+                                       Spv::MaxBound));
+        m_Ids.Resize(bound);
+        u32 pos = Spv::HeaderSize;
+        while (pos < m_Count)
+        {
+            const u32 opcode = m_Words[pos] & 0xFFFF;
+            const u32 wordCount = m_Words[pos] >> 16;
+            if (wordCount == 0 || pos + wordCount > m_Count)
+                return Result<>::Error(Error_BadInput, "[VULKIT][SHADER-REFLECTION] Malformed SPIR-V instruction");
+            if (wordCount < Spv::GetMinWordCount(opcode))
+                return Result<>::Error(Error_BadInput,
+                                       TKit::TierString::Format("[VULKIT][SHADER-REFLECTION] SPIR-V instruction with "
+                                                                "opcode {} has too few operands ({} words)",
+                                                                opcode, wordCount));
+
+            TKIT_RETURN_IF_FAILED(parseInstruction(opcode, pos, wordCount));
+            pos += wordCount;
+        }
+        return validate();
+    }
+
+    u32 Word(const u32 id, const u32 operand) const
+    {
+        return m_Words[m_Ids[id].Position + operand];
+    }
+    const Id &Get(const u32 id) const
+    {
+        return m_Ids[id];
+    }
+    u32 GetBound() const
+    {
+        return m_Ids.GetSize();
+    }
+
+    const TKit::TierArray<u32> &GetEntryPoints() const
+    {
+        return m_EntryPoints;
+    }
+    bool IsVertexInterface(const u32 id) const
+    {
+        for (const u32 variable : m_VertexInterfaces)
+            if (variable == id)
+                return true;
+        return false;
+    }
+    const u32 *GetWorkgroupSize() const
+    {
+        return m_WorkgroupSize;
+    }
+
+    // the value of an integer constant, or 1 if it is not a plain constant
+    u32 GetConstant(const u32 id) const
+    {
+        return m_Ids[id].Opcode == Spv::Op_Constant ? Word(id, 3) : 1;
+    }
+
+    Result<u32> GetTypeSize(const u32 typeId, const u32 matrixStride = 0, const u32 depth = 0) const
+    {
+        // only a corrupt module nests this deep. it is most likely a type that contains itself
+        if (depth > Spv::MaxTypeDepth)
+            return Result<u32>::Error(Error_BadInput,
+                                      TKit::TierString::Format("[VULKIT][SHADER-REFLECTION] SPIR-V type {} is nested "
+                                                               "deeper than {} levels",
+                                                               typeId, Spv::MaxTypeDepth));
+
+        const Id &type = m_Ids[typeId];
+        switch (type.Opcode)
+        {
+        case Spv::Op_TypeBool:
+            return 4;
+        case Spv::Op_TypeInt:
+        case Spv::Op_TypeFloat:
+            return Word(typeId, 2) / 8;
+        case Spv::Op_TypeVector: {
+            const auto size = GetTypeSize(Word(typeId, 2), 0, depth + 1);
+            TKIT_RETURN_ON_ERROR(size);
+            return *size * Word(typeId, 3);
+        }
+        case Spv::Op_TypeMatrix: {
+            const u32 columns = Word(typeId, 3);
+            if (matrixStride != 0)
+                return matrixStride * columns;
+            const auto size = GetTypeSize(Word(typeId, 2), 0, depth + 1);
+            TKIT_RETURN_ON_ERROR(size);
+            return *size * columns;
+        }
+        case Spv::Op_TypeArray: {
+            u32 stride = type.ArrayStride;
+            if (stride == 0)
+            {
+                const auto size = GetTypeSize(Word(typeId, 2), matrixStride, depth + 1);
+                TKIT_RETURN_ON_ERROR(size);
+                stride = *size;
+            }
+            return stride * GetConstant(Word(typeId, 3));
+        }
+        case Spv::Op_TypeStruct: {
+            u32 size = 0;
+            u32 offset = 0;
+            const u32 memberCount = (m_Words[type.Position] >> 16) - 2;
+            for (u32 i = 0; i < memberCount; ++i)
+            {
+                const Member member = i < type.Members.GetSize() ? type.Members[i] : Member{};
+                if (member.Offset != Spv::Unset)
+                    offset = member.Offset;
+                const auto msize = GetTypeSize(Word(typeId, 2 + i), member.MatrixStride, depth + 1);
+                TKIT_RETURN_ON_ERROR(msize);
+                offset += *msize;
+                size = std::max(size, offset);
+            }
+            return size;
+        }
+        case Spv::Op_TypePointer:
+            // physical storage buffer pointers
+            return 8;
+        default:
+            return 0;
+        }
+    }
+
+  private:
+    Result<> parseInstruction(const u32 opcode, const u32 pos, const u32 wordCount)
+    {
+        const u32 *w = m_Words + pos;
+        switch (opcode)
+        {
+        case Spv::Op_EntryPoint: {
+            m_EntryPoints.Append(w[1]);
+            if (w[1] != Spv::ExecutionModel_Vertex)
+                return Result<>::Ok();
+
+            // skip the null terminated name, packed 4 characters per word
+            u32 i = 3;
+            while (i < wordCount && (w[i] >> 24) != 0)
+                ++i;
+            for (++i; i < wordCount; ++i)
+                m_VertexInterfaces.Append(w[i]);
+            return Result<>::Ok();
+        }
+        case Spv::Op_ExecutionMode:
+            if (w[2] == Spv::ExecutionMode_LocalSize && wordCount >= 6)
+                for (u32 i = 0; i < 3; ++i)
+                    m_WorkgroupSize[i] = w[3 + i];
+            return Result<>::Ok();
+        case Spv::Op_Decorate: {
+            TKIT_RETURN_IF_FAILED(checkId(w[1]));
+            Id &id = m_Ids[w[1]];
+            const u32 literal = wordCount > 3 ? w[3] : 0;
+            switch (w[2])
+            {
+            case Spv::Decoration_SpecId:
+                id.SpecId = literal;
+                break;
+            case Spv::Decoration_Block:
+                id.Block = true;
+                break;
+            case Spv::Decoration_BufferBlock:
+                id.BufferBlock = true;
+                break;
+            case Spv::Decoration_ArrayStride:
+                id.ArrayStride = literal;
+                break;
+            case Spv::Decoration_BuiltIn:
+                id.BuiltIn = true;
+                break;
+            case Spv::Decoration_Location:
+                id.Location = literal;
+                break;
+            case Spv::Decoration_Binding:
+                id.Binding = literal;
+                break;
+            case Spv::Decoration_DescriptorSet:
+                id.Set = literal;
+                break;
+            default:
+                break;
+            }
+            return Result<>::Ok();
+        }
+        case Spv::Op_MemberDecorate: {
+            TKIT_RETURN_IF_FAILED(checkId(w[1]));
+            if (wordCount < 5 || (w[3] != Spv::Decoration_Offset && w[3] != Spv::Decoration_MatrixStride))
+                return Result<>::Ok();
+            // decorations precede the types they decorate, so the index can only be checked against the limit
+            if (w[2] >= Spv::MaxStructMembers)
+                return Result<>::Error(Error_BadInput,
+                                       TKit::TierString::Format(
+                                           "[VULKIT][SHADER-REFLECTION] SPIR-V member index {} exceeds the limit of {}",
+                                           w[2], Spv::MaxStructMembers));
+
+            TKit::TierArray<Member> &members = m_Ids[w[1]].Members;
+            while (members.GetSize() <= w[2])
+                members.Append();
+            if (w[3] == Spv::Decoration_Offset)
+                members[w[2]].Offset = w[4];
+            else
+                members[w[2]].MatrixStride = w[4];
+            return Result<>::Ok();
+        }
+        case Spv::Op_TypeBool:
+        case Spv::Op_TypeInt:
+        case Spv::Op_TypeFloat:
+        case Spv::Op_TypeImage:
+        case Spv::Op_TypeSampler:
+        case Spv::Op_TypeAccelerationStructureKHR:
+            return define(w[1], opcode, pos);
+        // the operands reflection follows to other ids: component, element, member and pointee types and array lengths
+        case Spv::Op_TypeVector:
+        case Spv::Op_TypeMatrix:
+        case Spv::Op_TypeSampledImage:
+        case Spv::Op_TypeRuntimeArray:
+            TKIT_RETURN_IF_FAILED(checkIds(w, 2, 3));
+            return define(w[1], opcode, pos);
+        case Spv::Op_TypeArray:
+            TKIT_RETURN_IF_FAILED(checkIds(w, 2, 4));
+            return define(w[1], opcode, pos);
+        case Spv::Op_TypeStruct:
+            TKIT_RETURN_IF_FAILED(checkIds(w, 2, wordCount));
+            return define(w[1], opcode, pos);
+        case Spv::Op_TypePointer:
+            TKIT_RETURN_IF_FAILED(checkIds(w, 3, 4));
+            return define(w[1], opcode, pos);
+        case Spv::Op_Constant:
+        case Spv::Op_SpecConstantTrue:
+        case Spv::Op_SpecConstantFalse:
+        case Spv::Op_SpecConstant:
+        case Spv::Op_Variable:
+            TKIT_RETURN_IF_FAILED(checkIds(w, 1, 2));
+            return define(w[2], opcode, pos);
+        default:
+            return Result<>::Ok();
+        }
+    }
+
+    Result<> checkId(const u32 id) const
+    {
+        if (id >= m_Ids.GetSize())
+            return Result<>::Error(Error_BadInput, "[VULKIT][SHADER-REFLECTION] SPIR-V id out of bounds");
+        return Result<>::Ok();
+    }
+    Result<> checkIds(const u32 *words, const u32 first, const u32 last) const
+    {
+        for (u32 i = first; i < last; ++i)
+        {
+            TKIT_RETURN_IF_FAILED(checkId(words[i]));
+        }
+        return Result<>::Ok();
+    }
+    Result<> checkType(const u32 id, const u32 referencedId, const u32 opcode) const
+    {
+        if (m_Ids[referencedId].Opcode != opcode)
+            return Result<>::Error(Error_BadInput, TKit::TierString::Format("[VULKIT][SHADER-REFLECTION] SPIR-V id {} "
+                                                                            "references id {}, which is not an "
+                                                                            "instruction with opcode {}",
+                                                                            id, referencedId, opcode));
+        return Result<>::Ok();
+    }
+
+    // operands of other instructions are read in place, so the ids they reach through must be of the kind expected.
+    // only possible once every id is defined
+    Result<> validate() const
+    {
+        for (u32 id = 0; id < m_Ids.GetSize(); ++id)
+        {
+            const u32 opcode = m_Ids[id].Opcode;
+            if (opcode == Spv::Op_Variable)
+            {
+                TKIT_RETURN_IF_FAILED(checkType(id, Word(id, 1), Spv::Op_TypePointer));
+            }
+            else if (opcode == Spv::Op_TypeSampledImage)
+            {
+                TKIT_RETURN_IF_FAILED(checkType(id, Word(id, 2), Spv::Op_TypeImage));
+            }
+        }
+        return Result<>::Ok();
+    }
+    Result<> define(const u32 id, const u32 opcode, const u32 pos)
+    {
+        TKIT_RETURN_IF_FAILED(checkId(id));
+        m_Ids[id].Opcode = opcode;
+        m_Ids[id].Position = pos;
+        return Result<>::Ok();
+    }
+
+    const u32 *m_Words;
+    u32 m_Count;
+    TKit::TierArray<Id> m_Ids{};
+    TKit::TierArray<u32> m_EntryPoints{};
+    // variables used by vertex entry points, to tell vertex inputs apart from inputs of other stages
+    TKit::TierArray<u32> m_VertexInterfaces{};
+    u32 m_WorkgroupSize[3]{0, 0, 0};
+};
+} // namespace
+
+static VkShaderStageFlags getStage(const u32 executionModel)
+{
+    switch (executionModel)
+    {
+    case 0:
+        return VK_SHADER_STAGE_VERTEX_BIT;
+    case 1:
+        return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+    case 2:
+        return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+    case 3:
+        return VK_SHADER_STAGE_GEOMETRY_BIT;
+    case 4:
+        return VK_SHADER_STAGE_FRAGMENT_BIT;
+    case 5:
+        return VK_SHADER_STAGE_COMPUTE_BIT;
+#ifdef VK_EXT_mesh_shader
+    case 5364:
+        return VK_SHADER_STAGE_TASK_BIT_EXT;
+    case 5365:
+        return VK_SHADER_STAGE_MESH_BIT_EXT;
+#endif
+#ifdef VK_KHR_ray_tracing_pipeline
+    case 5313:
+        return VK_SHADER_STAGE_RAYGEN_BIT_KHR;
+    case 5314:
+        return VK_SHADER_STAGE_INTERSECTION_BIT_KHR;
+    case 5315:
+        return VK_SHADER_STAGE_ANY_HIT_BIT_KHR;
+    case 5316:
+        return VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
+    case 5317:
+        return VK_SHADER_STAGE_MISS_BIT_KHR;
+    case 5318:
+        return VK_SHADER_STAGE_CALLABLE_BIT_KHR;
+#endif
+    default:
+        return 0;
+    }
+}
+
+static VkFormat getVertexFormat(const Parser &parser, const u32 typeId)
+{
+    const Id &type = parser.Get(typeId);
+    u32 components = 1;
+    u32 scalarId = typeId;
+    if (type.Opcode == Spv::Op_TypeVector)
+    {
+        scalarId = parser.Word(typeId, 2);
+        components = parser.Word(typeId, 3);
+    }
+
+    const Id &scalar = parser.Get(scalarId);
+    if ((scalar.Opcode != Spv::Op_TypeFloat && scalar.Opcode != Spv::Op_TypeInt) || parser.Word(scalarId, 2) != 32 ||
+        components == 0 || components > 4)
+        return VK_FORMAT_UNDEFINED;
+
+    constexpr VkFormat floats[4] = {VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT,
+                                    VK_FORMAT_R32G32B32A32_SFLOAT};
+    constexpr VkFormat sints[4] = {VK_FORMAT_R32_SINT, VK_FORMAT_R32G32_SINT, VK_FORMAT_R32G32B32_SINT,
+                                   VK_FORMAT_R32G32B32A32_SINT};
+    constexpr VkFormat uints[4] = {VK_FORMAT_R32_UINT, VK_FORMAT_R32G32_UINT, VK_FORMAT_R32G32B32_UINT,
+                                   VK_FORMAT_R32G32B32A32_UINT};
+    if (scalar.Opcode == Spv::Op_TypeFloat)
+        return floats[components - 1];
+    return parser.Word(scalarId, 3) ? sints[components - 1] : uints[components - 1];
+}
+
+static VkDescriptorType getDescriptorType(const Parser &parser, const u32 storageClass, const u32 typeId)
+{
+    const Id &type = parser.Get(typeId);
+    if (storageClass == Spv::StorageClass_StorageBuffer)
+        return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    if (storageClass == Spv::StorageClass_Uniform)
+        return type.BufferBlock ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+
+    switch (type.Opcode)
+    {
+    case Spv::Op_TypeSampler:
+        return VK_DESCRIPTOR_TYPE_SAMPLER;
+    case Spv::Op_TypeSampledImage:
+        return parser.Word(parser.Word(typeId, 2), 3) == Spv::Dim_Buffer ? VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER
+                                                                         : VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    case Spv::Op_TypeImage: {
+        const u32 dim = parser.Word(typeId, 3);
+        const bool storage = parser.Word(typeId, 7) == 2;
+        if (dim == Spv::Dim_SubpassData)
+            return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+        if (dim == Spv::Dim_Buffer)
+            return storage ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+        return storage ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    }
+#ifdef VK_KHR_acceleration_structure
+    case Spv::Op_TypeAccelerationStructureKHR:
+        return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+#endif
+    default:
+        return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+    }
+}
+
+Result<ShaderReflection> ShaderReflection::Reflect(const u32 *spirv, const usize size)
+{
+    using Res = Result<ShaderReflection>;
+    if (size % sizeof(u32) != 0 || size < Spv::HeaderSize * sizeof(u32))
+        return Res::Error(Error_BadInput, "[VULKIT][SHADER-REFLECTION] SPIR-V code size must be a multiple of 4 bytes "
+                                          "and hold at least a module header");
+    if (spirv[0] != Spv::Magic)
+        return Res::Error(Error_BadInput, "[VULKIT][SHADER-REFLECTION] Invalid SPIR-V magic number");
+
+    Parser parser{spirv, static_cast<u32>(size / sizeof(u32))};
+    TKIT_RETURN_IF_FAILED(parser.Parse(spirv[3]));
+
+    ShaderReflection reflection{};
+    for (const u32 entryPoint : parser.GetEntryPoints())
+        reflection.m_Stages |= getStage(entryPoint);
+    for (u32 i = 0; i < 3; ++i)
+        reflection.m_WorkgroupSize[i] = parser.GetWorkgroupSize()[i];
+
+    u32 pushEnd = 0;
+    reflection.m_PushConstants.Offset = Spv::Unset;
+    for (u32 id = 0; id < parser.GetBound(); ++id)
+    {
+        const Id &def = parser.Get(id);
+        if (def.SpecId != Spv::Unset &&
+            (def.Opcode == Spv::Op_SpecConstant || def.Opcode == Spv::Op_SpecConstantTrue ||
+             def.Opcode == Spv::Op_SpecConstantFalse))
+        {
+            const auto csize = parser.GetTypeSize(parser.Word(id, 1));
+            TKIT_RETURN_ON_ERROR(csize);
+            reflection.m_SpecializationConstants.Append(SpecializationConstant{def.SpecId, std::max(4U, *csize)});
+            continue;
+        }
+        if (def.Opcode != Spv::Op_Variable)
+            continue;
+
+        const u32 storageClass = parser.Word(id, 3);
+        // variables are always pointers. resolve the pointee and unwrap arrays of resources
+        u32 typeId = parser.Word(parser.Word(id, 1), 3);
+        if (storageClass == Spv::StorageClass_PushConstant)
+        {
+            const Id &block = parser.Get(typeId);
+            u32 start = 0;
+            if (!block.Members.IsEmpty() && block.Members[0].Offset != Spv::Unset)
+                start = block.Members[0].Offset;
+            const auto bsize = parser.GetTypeSize(typeId);
+            TKIT_RETURN_ON_ERROR(bsize);
+            reflection.m_PushConstants.Offset = std::min(reflection.m_PushConstants.Offset, start);
+            pushEnd = std::max(pushEnd, *bsize);
+            continue;
+        }
+        if (storageClass == Spv::StorageClass_Input)
+        {
+            if (def.Location != Spv::Unset && !def.BuiltIn && parser.IsVertexInterface(id))
+                reflection.m_VertexInputs.Append(VertexInput{def.Location, getVertexFormat(parser, typeId)});
+            continue;
+        }
+        if (storageClass != Spv::StorageClass_UniformConstant && storageClass != Spv::StorageClass_Uniform &&
+            storageClass != Spv::StorageClass_StorageBuffer)
+            continue;
+        if (def.Binding == Spv::Unset)
+            continue;
+
+        u32 count = 1;
+        if (parser.Get(typeId).Opcode == Spv::Op_TypeArray)
+        {
+            count = parser.GetConstant(parser.Word(typeId, 3));
+            typeId = parser.Word(typeId, 2);
+        }
+        else if (parser.Get(typeId).Opcode == Spv::Op_TypeRuntimeArray)
+        {
+            count = 0;
+            typeId = parser.Word(typeId, 2);
+        }
+
+        const VkDescriptorType type = getDescriptorType(parser, storageClass, typeId);
+        if (type == VK_DESCRIPTOR_TYPE_MAX_ENUM)
+            continue;
+
+        const u32 set = def.Set == Spv::Unset ? 0 : def.Set;
+        reflection.m_Bindings.Append(DescriptorBinding{set, def.Binding, type, count, reflection.m_Stages});
+    }
+
+    if (pushEnd != 0)
+    {
+        reflection.m_PushConstants.Size = pushEnd - reflection.m_PushConstants.Offset;
+        reflection.m_PushConstants.Stages = reflection.m_Stages;
+    }
+    else
+        reflection.m_PushConstants = PushConstantBlock{};
+
+    std::sort(reflection.m_VertexInputs.begin(), reflection.m_VertexInputs.end(),
+              [](const VertexInput &a, const VertexInput &b) { return a.Location < b.Location; });
+    return Res::Ok(reflection);
+}
+
+Result<> ShaderReflection::Merge(const ShaderReflection &other)
+{
+    for (const DescriptorBinding &binding : other.m_Bindings)
+    {
+        DescriptorBinding *existing = nullptr;
+        for (DescriptorBinding &b : m_Bindings)
+            if (b.Set == binding.Set && b.Binding == binding.Binding)
+            {
+                existing = &b;
+                break;
+            }
+
+        if (!existing)
+        {
+            m_Bindings.Append(binding);
+            continue;
+        }
+        if (existing->Type != binding.Type)
+            return Result<>::Error(
+                Error_BadInput,
+                TKit::TierString::Format(
+                    "[VULKIT][SHADER-REFLECTION] Binding {} of set {} is declared with different descriptor types",
+                    binding.Binding, binding.Set));
+        existing->Stages |= binding.Stages;
+        // a runtime sized array in any stage makes the binding runtime sized
+        existing->Count = existing->Count == 0 || binding.Count == 0 ? 0 : std::max(existing->Count, binding.Count);
+    }
+
+    const PushConstantBlock &push = other.m_PushConstants;
+    if (push.Size != 0)
+    {
+        if (m_PushConstants.Size == 0)
+            m_PushConstants = push;
+        else
+        {
+            const u32 end = std::max(m_PushConstants.Offset + m_PushConstants.Size, push.Offset + push.Size);
+            m_PushConstants.Offset = std::min(m_PushConstants.Offset, push.Offset);
+            m_PushConstants.Size = end - m_PushConstants.Offset;
+            m_PushConstants.Stages |= push.Stages;
+        }
+    }
+
+    for (const SpecializationConstant &constant : other.m_SpecializationConstants)
+    {
+        bool found = false;
+        for (const SpecializationConstant &c : m_SpecializationConstants)
+            if (c.ConstantId == constant.ConstantId)
+            {
+                found = true;
+                break;
+            }
+        if (!found)
+            m_SpecializationConstants.Append(constant);
+    }
+
+    if (m_VertexInputs.IsEmpty())
+        m_VertexInputs = other.m_VertexInputs;
+    if (m_WorkgroupSize[0] == 0)
+        for (u32 i = 0; i < 3; ++i)
+            m_WorkgroupSize[i] = other.m_WorkgroupSize[i];
+
+    m_Stages |= other.m_Stages;
+    return Result<>::Ok();
+}
+
+#ifdef VKIT_ENABLE_DESCRIPTORS
+TKit::TierArray<DescriptorSetLayout::Builder> ShaderReflection::CreateDescriptorSetLayoutBuilders(
+    const ProxyDevice &device, const u32 runtimeArrayCount) const
+{
+    TKit::TierArray<DescriptorSetLayout::Builder> builders{};
+    for (const DescriptorBinding &binding : m_Bindings)
+        while (builders.GetSize() <= binding.Set)
+            builders.Append(device);
+
+    for (const DescriptorBinding &binding : m_Bindings)
+    {
+        DescriptorSetLayout::Builder &builder = builders[binding.Set];
+        if (binding.Count != 0)
+        {
+            builder.AddBinding(binding.Binding, binding.Type, binding.Stages, binding.Count);
+            continue;
+        }
+#    if defined(VKIT_API_VERSION_1_2) || defined(VK_EXT_descriptor_indexing)
+        builder.AddBinding2(binding.Binding, binding.Type, binding.Stages, runtimeArrayCount,
+                            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT);
+#    else
+        builder.AddBinding(binding.Binding, binding.Type, binding.Stages, runtimeArrayCount);
+#    endif
+    }
+    return builders;
+}
+#endif
+
+#ifdef VKIT_ENABLE_PIPELINE_LAYOUT
+PipelineLayout::Builder ShaderReflection::CreatePipelineLayoutBuilder(
+    const ProxyDevice &device, const TKit::Span<const VkDescriptorSetLayout> setLayouts) const
+{
+    PipelineLayout::Builder builder{device};
+    for (u32 i = 0; i < setLayouts.GetSize(); ++i)
+        builder.AddDescriptorSetLayout(setLayouts[i]);
+    if (m_PushConstants.Size != 0)
+        builder.AddPushConstantRange(m_PushConstants.Stages, m_PushConstants.Size, m_PushConstants.Offset);
+    return builder;
+}
+#endif
+
+} // namespace VKit
@@ -0,0 +1,125 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_SHADERS
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_SHADERS"
+#endif
+
+#include "vkit/device/proxy_device.hpp"
+#include "tkit/container/span.hpp"
+#ifdef VKIT_ENABLE_DESCRIPTORS
+#    include "vkit/state/descriptor_set_layout.hpp"
+#endif
+#ifdef VKIT_ENABLE_PIPELINE_LAYOUT
+#    include "vkit/state/pipeline_layout.hpp"
+#endif
+#include <vulkan/vulkan.h>
+
+namespace VKit
+{
+/**
+ * @brief Resource interface of one or more SPIR-V modules, extracted with a minimal single-pass parser.
+ *
+ * Reflects descriptor bindings, the push constant block, compute workgroup sizes, specialization constant ids and
+ * vertex input locations. Reflections of the different stages of a pipeline can be merged, and the result turned into
+ * ready descriptor set and pipeline layout builders, so that layouts never go out of sync with the shaders.
+ *
+ * Uniform buffers are always reflected as `VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER`, as SPIR-V cannot tell whether a dynamic
+ * offset will be used.
+ *
+ */
+class ShaderReflection
+{
+  public:
+    struct DescriptorBinding
+    {
+        u32 Set;
+        u32 Binding;
+        VkDescriptorType Type;
+        // 0 for runtime sized arrays
+        u32 Count;
+        VkShaderStageFlags Stages;
+    };
+    struct PushConstantBlock
+    {
+        u32 Offset;
+        u32 Size;
+        VkShaderStageFlags Stages;
+    };
+    struct VertexInput
+    {
+        u32 Location;
+        // undefined for types that do not map to a single 32-bit format
+        VkFormat Format;
+    };
+    struct SpecializationConstant
+    {
+        u32 ConstantId;
+        u32 Size;
+    };
+
+    /**
+     * @brief Reflect a SPIR-V module.
+     *
+     * @param spirv The SPIR-V words, as passed to `Shader::Create()`.
+     * @param size The size of the code, in bytes.
+     */
+    VKIT_NO_DISCARD static Result<ShaderReflection> Reflect(const u32 *spirv, usize size);
+
+    // merges the reflection of another stage into this one. fails if a binding is declared with different types
+    VKIT_NO_DISCARD Result<> Merge(const ShaderReflection &other);
+
+#ifdef VKIT_ENABLE_DESCRIPTORS
+    /**
+     * @brief Create one descriptor set layout builder per set, from set 0 up to the highest set used.
+     *
+     * Sets without bindings get an empty builder so that set indices are preserved.
+     *
+     * @param runtimeArrayCount The descriptor count used for runtime sized arrays. These bindings are also made
+     * partially bound when descriptor indexing is available.
+     */
+    TKit::TierArray<DescriptorSetLayout::Builder> CreateDescriptorSetLayoutBuilders(const ProxyDevice &device,
+                                                                                   u32 runtimeArrayCount = 1) const;
+#endif
+#ifdef VKIT_ENABLE_PIPELINE_LAYOUT
+    // the set layouts must be ordered by set index, typically built from `CreateDescriptorSetLayoutBuilders()`
+    PipelineLayout::Builder CreatePipelineLayoutBuilder(const ProxyDevice &device,
+                                                        TKit::Span<const VkDescriptorSetLayout> setLayouts) const;
+#endif
+
+    VkShaderStageFlags GetStages() const
+    {
+        return m_Stages;
+    }
+    const TKit::TierArray<DescriptorBinding> &GetBindings() const
+    {
+        return m_Bindings;
+    }
+    // a size of 0 means the shaders have no push constants
+    const PushConstantBlock &GetPushConstantBlock() const
+    {
+        return m_PushConstants;
+    }
+    const TKit::TierArray<VertexInput> &GetVertexInputs() const
+    {
+        return m_VertexInputs;
+    }
+    const TKit::TierArray<SpecializationConstant> &GetSpecializationConstants() const
+    {
+        return m_SpecializationConstants;
+    }
+    // only meaningful for compute, task and mesh stages. zero if not declared with literals
+    const u32 *GetWorkgroupSize() const
+    {
+        return m_WorkgroupSize;
+    }
+
+  private:
+    VkShaderStageFlags m_Stages = 0;
+    TKit::TierArray<DescriptorBinding> m_Bindings{};
+    PushConstantBlock m_PushConstants{};
+    TKit::TierArray<VertexInput> m_VertexInputs{};
+    TKit::TierArray<SpecializationConstant> m_SpecializationConstants{};
+    u32 m_WorkgroupSize[3]{0, 0, 0};
+};
+} // namespace VKit
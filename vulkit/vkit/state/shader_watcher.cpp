@@ -0,0 +1,398 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/shader_watcher.hpp"
+
+#ifdef TKIT_OS_LINUX
+#    include <sys/inotify.h>
+#    include <poll.h>
+#    include <unistd.h>
+#endif
+
+namespace VKit
+{
+// how long to wait after a change before reloading, so that writers have time to finish
+static constexpr auto s_SettleTime = std::chrono::milliseconds(50);
+static constexpr auto s_PollInterval = std::chrono::milliseconds(100);
+
+ShaderWatcher::~ShaderWatcher()
+{
+    stop();
+}
+
+Result<> ShaderWatcher::Start()
+{
+    TKIT_ASSERT(!m_Thread.joinable(), "[VULKIT][SHADER-WATCHER] The watcher has already been started");
+#ifdef TKIT_OS_LINUX
+    m_Notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_Notify == -1)
+        return Result<>::Error(Error_Unknown, "[VULKIT][SHADER-WATCHER] Failed to initialize inotify");
+
+    std::scoped_lock lock{m_Mutex};
+    for (Watched &watched : m_Shaders)
+        watched.WatchDescriptor =
+            inotify_add_watch(m_Notify, watched.Path.parent_path().c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+#endif
+    m_Stop = false;
+    m_Thread = std::thread([this] { work(); });
+    return Result<>::Ok();
+}
+
+void ShaderWatcher::stop()
+{
+    m_Stop = true;
+    if (m_Thread.joinable())
+        m_Thread.join();
+#ifdef TKIT_OS_LINUX
+    if (m_Notify != -1)
+    {
+        close(m_Notify);
+        m_Notify = -1;
+    }
+#endif
+}
+
+void ShaderWatcher::Destroy()
+{
+    stop();
+    Reclaim(UINT64_MAX);
+    for (Reload &reload : m_Pending)
+        destroyReload(reload);
+    m_Pending.Clear();
+
+    // latest modules that differ from the current ones belong to pending reloads, which are already destroyed
+    for (Watched &watched : m_Shaders)
+        watched.Current.Destroy();
+    m_Shaders.Clear();
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    for (WatchedGraphics &graphics : m_Graphics)
+        graphics.Pipeline.Destroy();
+    m_Graphics.Clear();
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    for (WatchedCompute &compute : m_Compute)
+        compute.Pipeline.Destroy();
+    m_Compute.Clear();
+#endif
+}
+
+Result<u32> ShaderWatcher::Watch(const std::filesystem::path &spirvPath)
+{
+    const std::string path = spirvPath.string();
+    const auto result = Shader::Create(m_Device, path.c_str());
+    TKIT_RETURN_ON_ERROR(result);
+
+    Watched watched{};
+    watched.Path = std::filesystem::absolute(spirvPath);
+    watched.Current = *result;
+    watched.Latest = *result;
+    std::error_code ec;
+    watched.WriteTime = std::filesystem::last_write_time(watched.Path, ec);
+    watched.WatchDescriptor = -1;
+#ifdef TKIT_OS_LINUX
+    // directories are watched instead of files, as editors and compilers often replace files instead of writing them
+    if (m_Notify != -1)
+        watched.WatchDescriptor =
+            inotify_add_watch(m_Notify, watched.Path.parent_path().c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+#endif
+
+    std::scoped_lock lock{m_Mutex};
+    m_Shaders.Append(watched);
+    return Result<u32>::Ok(m_Shaders.GetSize() - 1);
+}
+
+Shader ShaderWatcher::GetShader(const u32 shaderId) const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Shaders[shaderId].Current;
+}
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+Result<u32> ShaderWatcher::AddGraphicsPipeline(const GraphicsPipeline::Builder &builder)
+{
+    const auto result = builder.Build();
+    TKIT_RETURN_ON_ERROR(result);
+
+    std::scoped_lock lock{m_Mutex};
+    m_Graphics.Append(WatchedGraphics{builder, *result});
+    // the stored copy must be baked again, as the baked state points into the original builder
+    m_Graphics.GetBack().Builder.Bake();
+    return Result<u32>::Ok(m_Graphics.GetSize() - 1);
+}
+
+GraphicsPipeline ShaderWatcher::GetGraphicsPipeline(const u32 pipelineId) const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Graphics[pipelineId].Pipeline;
+}
+#endif
+
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+Result<u32> ShaderWatcher::AddComputePipeline(const ComputePipelineSpecs &specs)
+{
+    const auto result = ComputePipeline::Create(m_Device, specs);
+    TKIT_RETURN_ON_ERROR(result);
+
+    std::scoped_lock lock{m_Mutex};
+    m_Compute.Append(WatchedCompute{specs, *result});
+    return Result<u32>::Ok(m_Compute.GetSize() - 1);
+}
+
+ComputePipeline ShaderWatcher::GetComputePipeline(const u32 pipelineId) const
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_Compute[pipelineId].Pipeline;
+}
+#endif
+
+u32 ShaderWatcher::Update(const u64 timeline)
+{
+    std::scoped_lock lock{m_Mutex};
+    for (const Reload &reload : m_Pending)
+    {
+        Watched &watched = m_Shaders[reload.ShaderId];
+        const VkShaderModule oldModule = watched.Current;
+        const VkShaderModule newModule = reload.Module;
+
+        Retired retired{};
+        retired.Module = watched.Current;
+        retired.Timeline = timeline;
+        m_Retired.Append(retired);
+        watched.Current = reload.Module;
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+        for (const ReloadedGraphics &reloaded : reload.Graphics)
+        {
+            WatchedGraphics &graphics = m_Graphics[reloaded.PipelineId];
+            Retired rgraphics{};
+            rgraphics.Graphics = graphics.Pipeline;
+            rgraphics.Timeline = timeline;
+            m_Retired.Append(rgraphics);
+            graphics.Pipeline = reloaded.Pipeline;
+        }
+        // every stored builder must reference current modules, as reloads start from them
+        for (WatchedGraphics &graphics : m_Graphics)
+            for (VkPipelineShaderStageCreateInfo &stage : graphics.Builder.m_ShaderStages)
+                if (stage.module == oldModule)
+                    stage.module = newModule;
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+        for (const ReloadedCompute &reloaded : reload.Compute)
+        {
+            WatchedCompute &compute = m_Compute[reloaded.PipelineId];
+            Retired rcompute{};
+            rcompute.Compute = compute.Pipeline;
+            rcompute.Timeline = timeline;
+            m_Retired.Append(rcompute);
+            compute.Pipeline = reloaded.Pipeline;
+            compute.Specs.ComputeShader = newModule;
+        }
+#endif
+    }
+
+    const u32 reloaded = m_Pending.GetSize();
+    m_Pending.Clear();
+    return reloaded;
+}
+
+void ShaderWatcher::Reclaim(const u64 completedTimeline)
+{
+    std::scoped_lock lock{m_Mutex};
+    u32 pending = 0;
+    for (Retired &retired : m_Retired)
+    {
+        if (retired.Timeline > completedTimeline)
+        {
+            m_Retired[pending++] = retired;
+            continue;
+        }
+        if (retired.Module)
+            retired.Module.Destroy();
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+        if (retired.Graphics)
+            retired.Graphics.Destroy();
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+        if (retired.Compute)
+            retired.Compute.Destroy();
+#endif
+    }
+    m_Retired.Resize(pending);
+}
+
+void ShaderWatcher::work()
+{
+    TKit::TierArray<u32> changed{};
+    while (!m_Stop)
+    {
+        changed.Clear();
+        collectChanges(changed);
+        if (changed.IsEmpty())
+            continue;
+
+        std::this_thread::sleep_for(s_SettleTime);
+        // a single save may produce several events
+        for (u32 i = 0; i < changed.GetSize(); ++i)
+        {
+            bool repeated = false;
+            for (u32 j = 0; j < i; ++j)
+                repeated |= changed[j] == changed[i];
+            if (!repeated)
+                reload(changed[i]);
+        }
+    }
+}
+
+void ShaderWatcher::collectChanges(TKit::TierArray<u32> &changed)
+{
+#ifdef TKIT_OS_LINUX
+    pollfd fd{};
+    fd.fd = m_Notify;
+    fd.events = POLLIN;
+    if (poll(&fd, 1, static_cast<i32>(s_PollInterval.count())) <= 0)
+        return;
+
+    alignas(inotify_event) char buffer[4096];
+    for (;;)
+    {
+        const ssize_t length = read(m_Notify, buffer, sizeof(buffer));
+        if (length <= 0)
+            return;
+
+        std::scoped_lock lock{m_Mutex};
+        for (ssize_t offset = 0; offset < length;)
+        {
+            const auto *event = rcast<const inotify_event *>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+            if (event->len == 0)
+                continue;
+
+            for (u32 i = 0; i < m_Shaders.GetSize(); ++i)
+                if (m_Shaders[i].WatchDescriptor == event->wd && m_Shaders[i].Path.filename() == event->name)
+                    changed.Append(i);
+        }
+    }
+#else
+    std::this_thread::sleep_for(s_PollInterval);
+    std::scoped_lock lock{m_Mutex};
+    for (u32 i = 0; i < m_Shaders.GetSize(); ++i)
+    {
+        std::error_code ec;
+        const auto time = std::filesystem::last_write_time(m_Shaders[i].Path, ec);
+        if (ec || time == m_Shaders[i].WriteTime)
+            continue;
+        m_Shaders[i].WriteTime = time;
+        changed.Append(i);
+    }
+#endif
+}
+
+void ShaderWatcher::reload(const u32 shaderId)
+{
+    std::string path;
+    {
+        std::scoped_lock lock{m_Mutex};
+        path = m_Shaders[shaderId].Path.string();
+    }
+
+    const auto sresult = Shader::Create(m_Device, path.c_str());
+    if (!sresult)
+    {
+        TKIT_LOG_WARNING("[VULKIT][SHADER-WATCHER] Failed to reload '{}': {}", path, sresult.GetError().ToString());
+        return;
+    }
+
+    Reload reload{};
+    reload.ShaderId = shaderId;
+    reload.Module = *sresult;
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    TKit::TierArray<u32> graphicsIds{};
+    TKit::TierArray<GraphicsPipeline::Builder> builders{};
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    TKit::TierArray<u32> computeIds{};
+    TKit::TierArray<ComputePipelineSpecs> specs{};
+#endif
+    {
+        std::scoped_lock lock{m_Mutex};
+        // stored objects reference current modules. dependents are rebuilt with the latest ones, so that pending
+        // reloads of other shaders are not undone
+        const auto toLatest = [this, shaderId, &reload](const VkShaderModule module) -> VkShaderModule {
+            for (u32 i = 0; i < m_Shaders.GetSize(); ++i)
+                if (m_Shaders[i].Current.GetHandle() == module)
+                    return i == shaderId ? reload.Module.GetHandle() : m_Shaders[i].Latest.GetHandle();
+            return module;
+        };
+        const VkShaderModule current = m_Shaders[shaderId].Current;
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+        for (u32 i = 0; i < m_Graphics.GetSize(); ++i)
+        {
+            bool depends = false;
+            for (const VkPipelineShaderStageCreateInfo &stage : m_Graphics[i].Builder.m_ShaderStages)
+                depends |= stage.module == current;
+            if (!depends)
+                continue;
+
+            GraphicsPipeline::Builder &builder = builders.Append(m_Graphics[i].Builder);
+            for (VkPipelineShaderStageCreateInfo &stage : builder.m_ShaderStages)
+                stage.module = toLatest(stage.module);
+            builder.Bake();
+            graphicsIds.Append(i);
+        }
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+        for (u32 i = 0; i < m_Compute.GetSize(); ++i)
+            if (m_Compute[i].Specs.ComputeShader == current)
+            {
+                ComputePipelineSpecs &spc = specs.Append(m_Compute[i].Specs);
+                spc.ComputeShader = reload.Module;
+                computeIds.Append(i);
+            }
+#endif
+    }
+
+    const auto fail = [&reload, &path](const Error &error) {
+        TKIT_LOG_WARNING("[VULKIT][SHADER-WATCHER] Failed to rebuild a pipeline using '{}': {}", path,
+                         error.ToString());
+        destroyReload(reload);
+    };
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    for (u32 i = 0; i < builders.GetSize(); ++i)
+    {
+        const auto result = builders[i].Build();
+        if (!result)
+            return fail(result.GetError());
+        reload.Graphics.Append(ReloadedGraphics{graphicsIds[i], *result});
+    }
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    for (u32 i = 0; i < specs.GetSize(); ++i)
+    {
+        const auto result = ComputePipeline::Create(m_Device, specs[i]);
+        if (!result)
+            return fail(result.GetError());
+        reload.Compute.Append(ReloadedCompute{computeIds[i], *result});
+    }
+#endif
+
+    std::scoped_lock lock{m_Mutex};
+    m_Shaders[shaderId].Latest = reload.Module;
+    m_Pending.Append(reload);
+}
+
+void ShaderWatcher::destroyReload(Reload &reload)
+{
+    reload.Module.Destroy();
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    for (ReloadedGraphics &reloaded : reload.Graphics)
+        reloaded.Pipeline.Destroy();
+    reload.Graphics.Clear();
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    for (ReloadedCompute &reloaded : reload.Compute)
+        reloaded.Pipeline.Destroy();
+    reload.Compute.Clear();
+#endif
+}
+
+} // namespace VKit
@@ -0,0 +1,160 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_SHADERS
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_SHADERS"
+#endif
+
+#include "vkit/state/shader.hpp"
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+#    include "vkit/state/graphics_pipeline.hpp"
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+#    include "vkit/state/compute_pipeline.hpp"
+#endif
+#include <filesystem>
+#include <atomic>
+#include <thread>
+#include <mutex>
+
+namespace VKit
+{
+/**
+ * @brief Reloads SPIR-V files when they change on disk, along with the pipelines that use them.
+ *
+ * Watched files are monitored on a background thread, with inotify on Linux and by polling modification times
+ * elsewhere. When a file changes, its module is recreated and every registered pipeline using it is rebuilt from its
+ * stored builder, all on the background thread. If anything fails, the reload is discarded and the current objects are
+ * kept.
+ *
+ * Reloaded objects are only swapped in by `Update()`, which should be called at a frame boundary. Replaced objects are
+ * destroyed in `Reclaim()` once the GPU no longer uses them, following the same timeline scheme as `BindlessHeap`.
+ *
+ */
+class ShaderWatcher
+{
+  public:
+    ShaderWatcher() = default;
+    ShaderWatcher(const ProxyDevice &device) : m_Device(device)
+    {
+    }
+
+    ShaderWatcher(const ShaderWatcher &) = delete;
+    ShaderWatcher &operator=(const ShaderWatcher &) = delete;
+
+    // only stops the background thread. shaders, pipelines and retired objects must be destroyed with `Destroy()`
+    ~ShaderWatcher();
+
+    // starts watching on a background thread
+    VKIT_NO_DISCARD Result<> Start();
+    // stops the background thread and destroys every shader, pipeline and retired object
+    void Destroy();
+
+    // loads the shader at `spirvPath` and watches it for changes. returns an id to be used with `GetShader()`
+    VKIT_NO_DISCARD Result<u32> Watch(const std::filesystem::path &spirvPath);
+    Shader GetShader(u32 shaderId) const;
+
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    // builds the pipeline and rebuilds it whenever a watched shader it uses changes. the builder must be baked
+    VKIT_NO_DISCARD Result<u32> AddGraphicsPipeline(const GraphicsPipeline::Builder &builder);
+    GraphicsPipeline GetGraphicsPipeline(u32 pipelineId) const;
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    // builds the pipeline and rebuilds it whenever its compute shader changes, if it is watched
+    VKIT_NO_DISCARD Result<u32> AddComputePipeline(const ComputePipelineSpecs &specs);
+    ComputePipeline GetComputePipeline(u32 pipelineId) const;
+#endif
+
+    // swaps in every finished reload. the replaced objects are retired with `timeline`. returns the amount of shaders
+    // reloaded
+    u32 Update(u64 timeline);
+    // destroys every retired object whose timeline value is less or equal than `completedTimeline`
+    void Reclaim(u64 completedTimeline);
+
+    const ProxyDevice &GetDevice() const
+    {
+        return m_Device;
+    }
+
+  private:
+    struct Watched
+    {
+        std::filesystem::path Path;
+        // the module dependent objects are built with, and the most recent one, which is ahead while a reload is
+        // pending
+        Shader Current;
+        Shader Latest;
+        std::filesystem::file_time_type WriteTime;
+        i32 WatchDescriptor;
+    };
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    struct WatchedGraphics
+    {
+        GraphicsPipeline::Builder Builder;
+        GraphicsPipeline Pipeline;
+    };
+    struct ReloadedGraphics
+    {
+        u32 PipelineId;
+        GraphicsPipeline Pipeline;
+    };
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    struct WatchedCompute
+    {
+        ComputePipelineSpecs Specs;
+        ComputePipeline Pipeline;
+    };
+    struct ReloadedCompute
+    {
+        u32 PipelineId;
+        ComputePipeline Pipeline;
+    };
+#endif
+    struct Reload
+    {
+        u32 ShaderId;
+        Shader Module;
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+        TKit::TierArray<ReloadedGraphics> Graphics;
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+        TKit::TierArray<ReloadedCompute> Compute;
+#endif
+    };
+    struct Retired
+    {
+        Shader Module;
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+        GraphicsPipeline Graphics;
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+        ComputePipeline Compute;
+#endif
+        u64 Timeline;
+    };
+
+    void work();
+    void stop();
+    void collectChanges(TKit::TierArray<u32> &changed);
+    void reload(u32 shaderId);
+    static void destroyReload(Reload &reload);
+
+    ProxyDevice m_Device{};
+
+    TKit::TierArray<Watched> m_Shaders{};
+#ifdef VKIT_ENABLE_GRAPHICS_PIPELINE
+    TKit::TierArray<WatchedGraphics> m_Graphics{};
+#endif
+#ifdef VKIT_ENABLE_COMPUTE_PIPELINE
+    TKit::TierArray<WatchedCompute> m_Compute{};
+#endif
+    TKit::TierArray<Reload> m_Pending{};
+    TKit::TierArray<Retired> m_Retired{};
+
+    std::thread m_Thread{};
+    std::atomic<bool> m_Stop = false;
+    i32 m_Notify = -1;
+    mutable std::mutex m_Mutex{};
+};
+} // namespace VKit
@@ -0,0 +1,80 @@
+#include "vkit/core/pch.hpp"
+#include "vkit/state/vertex_layout.hpp"
+
+#include <cstring>
+
+namespace VKit
+{
+VertexLayout &VertexLayout::AddBinding(const u32 stride, const VkVertexInputRate inputRate)
+{
+    VkVertexInputBindingDescription binding{};
+    binding.binding = m_Bindings.GetSize();
+    binding.stride = stride;
+    binding.inputRate = inputRate;
+    m_Bindings.Append(binding);
+    return *this;
+}
+VertexLayout &VertexLayout::AddAttribute(const u32 binding, const VkFormat format, const u32 offset)
+{
+    TKIT_ASSERT(binding < m_Bindings.GetSize(), "[VULKIT][VERTEX-LAYOUT] Binding {} has not been added", binding);
+    VkVertexInputAttributeDescription attribute{};
+    attribute.binding = binding;
+    attribute.format = format;
+    attribute.location = m_Attributes.GetSize();
+    attribute.offset = offset;
+    m_Attributes.Append(attribute);
+    return *this;
+}
+
+u64 VertexLayout::Hash() const
+{
+    // both description structs are made of 32-bit members only, so they have no padding and can be hashed as words
+    constexpr u64 prime = 0x9E3779B97F4A7C15ULL;
+    u64 hash = (u64(m_Bindings.GetSize()) << 32 | m_Attributes.GetSize()) * prime;
+    const auto hashWords = [&hash](const void *data, const usize size) {
+        const auto *words = static_cast<const u32 *>(data);
+        for (usize i = 0; i < size / sizeof(u32); ++i)
+        {
+            hash ^= words[i];
+            hash *= prime;
+            hash ^= hash >> 32;
+        }
+    };
+    if (!m_Bindings.IsEmpty())
+        hashWords(m_Bindings.GetData(), m_Bindings.GetSize() * sizeof(VkVertexInputBindingDescription));
+    if (!m_Attributes.IsEmpty())
+        hashWords(m_Attributes.GetData(), m_Attributes.GetSize() * sizeof(VkVertexInputAttributeDescription));
+    return hash;
+}
+
+bool VertexLayout::operator==(const VertexLayout &other) const
+{
+    if (m_Bindings.GetSize() != other.m_Bindings.GetSize() || m_Attributes.GetSize() != other.m_Attributes.GetSize())
+        return false;
+    return (m_Bindings.IsEmpty() || std::memcmp(m_Bindings.GetData(), other.m_Bindings.GetData(),
+                                                m_Bindings.GetSize() * sizeof(VkVertexInputBindingDescription)) == 0) &&
+           (m_Attributes.IsEmpty() ||
+            std::memcmp(m_Attributes.GetData(), other.m_Attributes.GetData(),
+                        m_Attributes.GetSize() * sizeof(VkVertexInputAttributeDescription)) == 0);
+}
+
+const VertexLayout &VertexLayoutCache::Intern(const VertexLayout &layout)
+{
+    std::scoped_lock lock{m_Mutex};
+    // unordered_set nodes never move, so the reference stays valid across insertions
+    return *m_Layouts.insert(layout).first;
+}
+
+void VertexLayoutCache::Clear()
+{
+    std::scoped_lock lock{m_Mutex};
+    m_Layouts.clear();
+}
+
+u32 VertexLayoutCache::GetLayoutCount() const
+{
+    std::scoped_lock lock{m_Mutex};
+    return static_cast<u32>(m_Layouts.size());
+}
+
+} // namespace VKit
@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef VKIT_ENABLE_GRAPHICS_PIPELINE
+#    error                                                                                                             \
+        "[VULKIT] To include this file, the corresponding feature must be enabled in CMake with VULKIT_ENABLE_GRAPHICS_PIPELINE"
+#endif
+
+#include "vkit/core/alias.hpp"
+#include "tkit/container/tier_array.hpp"
+#include <vulkan/vulkan.h>
+#include <unordered_set>
+#include <mutex>
+
+namespace VKit
+{
+/**
+ * @brief A description of the vertex buffers a pipeline reads, independent from any pipeline.
+ *
+ * It can be fed to a `GraphicsPipeline::Builder` with `SetVertexLayout()` to be baked into the pipeline or, when
+ * `VK_EXT_vertex_input_dynamic_state` is available and the pipeline declares `DynamicStateFlag_VertexInput`, applied
+ * at record time with `DynamicState::SetVertexLayout()` so that a single pipeline serves every mesh format.
+ *
+ * Bindings and attribute locations are assigned in the order they are added, as in the graphics pipeline builder.
+ *
+ */
+class VertexLayout
+{
+  public:
+    VertexLayout &AddBinding(u32 stride, VkVertexInputRate inputRate = VK_VERTEX_INPUT_RATE_VERTEX);
+    template <typename T> VertexLayout &AddBinding(const VkVertexInputRate inputRate = VK_VERTEX_INPUT_RATE_VERTEX)
+    {
+        return AddBinding(sizeof(T), inputRate);
+    }
+    VertexLayout &AddAttribute(u32 binding, VkFormat format, u32 offset);
+
+    u64 Hash() const;
+
+    bool operator==(const VertexLayout &other) const;
+    bool operator!=(const VertexLayout &other) const
+    {
+        return !(*this == other);
+    }
+
+    const TKit::TierArray<VkVertexInputBindingDescription> &GetBindings() const
+    {
+        return m_Bindings;
+    }
+    const TKit::TierArray<VkVertexInputAttributeDescription> &GetAttributes() const
+    {
+        return m_Attributes;
+    }
+
+  private:
+    TKit::TierArray<VkVertexInputBindingDescription> m_Bindings{};
+    TKit::TierArray<VkVertexInputAttributeDescription> m_Attributes{};
+};
+
+struct VertexLayoutHash
+{
+    usize operator()(const VertexLayout &layout) const
+    {
+        return static_cast<usize>(layout.Hash());
+    }
+};
+
+/**
+ * @brief Deduplicates vertex layouts, so that equal layouts share a single instance.
+ *
+ * Interned layouts are stable in memory until `Clear()` is called, which lets `DynamicState` skip redundant vertex
+ * input commands by comparing addresses only.
+ *
+ */
+class VertexLayoutCache
+{
+  public:
+    VertexLayoutCache() = default;
+
+    VertexLayoutCache(const VertexLayoutCache &) = delete;
+    VertexLayoutCache &operator=(const VertexLayoutCache &) = delete;
+
+    // returns the stored layout equal to `layout`, storing a copy of it first if there was none
+    const VertexLayout &Intern(const VertexLayout &layout);
+    void Clear();
+
+    u32 GetLayoutCount() const;
+
+  private:
+    std::unordered_set<VertexLayout, VertexLayoutHash> m_Layouts{};
+    mutable std::mutex m_Mutex{};
+};
+} // namespace VKit
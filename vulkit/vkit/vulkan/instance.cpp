@@ -284,12 +284,6 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL defaultDebugCallback(const VkDebugUtilsMes
 #undef PRINT_DEBUG_INFO
 }
 
-static bool contains(const TKit::Span<const char *const> elements, const char *element)
-{
-    return std::find_if(elements.begin(), elements.end(),
-                        [element](const char *elem) { return std::strcmp(elem, element) == 0; }) != elements.end();
-}
-
 Instance::Builder::Builder()
 {
     m_RequiredExtensions.Reserve(GetExtensionCount());
@@ -335,49 +329,52 @@ Result<Instance> Instance::Builder::Build() const
     }
     const u32 apiVersion = *vresult;
 
+    // only supported names are inserted into the sets, and those have already been interned by `Initialize()`
     TKit::StackArray<const char *> extensions;
     extensions.Reserve(m_RequiredExtensions.GetCapacity());
+    NameSet extensionSet{};
 
     for (const char *extension : m_RequiredExtensions)
         if (!IsExtensionSupported(extension))
             return Result<Instance>::Error(
                 Error_MissingExtension,
                 TKit::TierString::Format("[VULKIT][INSTANCE] The required extension '{}' is not suported", extension));
-        else if (!contains(extensions, extension))
+        else if (extensionSet.Insert(extension))
             extensions.Append(extension);
 
     for (const char *extension : m_RequestedExtensions)
     {
         const bool supported = IsExtensionSupported(extension);
         TKIT_LOG_WARNING_IF(!supported, "[VULKIT][INSTANCE] The requested extension '{}' is not suported", extension);
-        if (supported && !contains(extensions, extension))
+        if (supported && extensionSet.Insert(extension))
             extensions.Append(extension);
     }
 
     TKit::StackArray<const char *> layers;
     layers.Reserve(m_RequiredLayers.GetCapacity());
+    NameSet layerSet{};
     for (const char *layer : m_RequiredLayers)
         if (!IsLayerSupported(layer))
             return Result<Instance>::Error(
                 Error_MissingLayer,
                 TKit::TierString::Format("[VULKIT][INSTANCE] The required layer '{}' is not suported", layer));
-        else if (!contains(layers, layer))
+        else if (layerSet.Insert(layer))
             layers.Append(layer);
 
     for (const char *layer : m_RequestedLayers)
     {
         const bool supported = IsLayerSupported(layer);
         TKIT_LOG_WARNING_IF(!supported, "[VULKIT][INSTANCE] The requested layer '{}' is not suported", layer);
-        if (supported && !contains(layers, layer))
+        if (supported && layerSet.Insert(layer))
             layers.Append(layer);
     }
 
     if (!m_Headless)
     {
-        const auto checkWindowingSupport = [&extensions](const char *extension) -> bool {
+        const auto checkWindowingSupport = [&extensions, &extensionSet](const char *extension) -> bool {
             if (!IsExtensionSupported(extension))
                 return false;
-            if (!contains(extensions, extension))
+            if (extensionSet.Insert(extension))
                 extensions.Append(extension);
             return true;
         };
@@ -420,7 +417,7 @@ Result<Instance> Instance::Builder::Build() const
 
 #ifdef VK_EXT_debug_utils
     VkDebugUtilsMessengerCreateInfoEXT msgInfo{};
-    const bool hasDebugUtils = contains(extensions, "VK_EXT_debug_utils");
+    const bool hasDebugUtils = extensionSet.Contains("VK_EXT_debug_utils");
     if (hasDebugUtils)
     {
         msgInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
@@ -450,7 +447,7 @@ Result<Instance> Instance::Builder::Build() const
 
 #ifdef VK_EXT_validation_features
     VkValidationFeaturesEXT valFeatures{};
-    bool hasValFeatures = contains(extensions, "VK_EXT_validation_features");
+    bool hasValFeatures = extensionSet.Contains("VK_EXT_validation_features");
     if (hasValFeatures && (!m_EnabledValFeatures.IsEmpty() || !m_DisabledValFeatures.IsEmpty()))
     {
         valFeatures.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
@@ -488,7 +485,7 @@ Result<Instance> Instance::Builder::Build() const
 
 #ifdef VK_EXT_layer_settings
     VkLayerSettingsCreateInfoEXT layerSettings{};
-    const bool hasSettings = contains(extensions, "VK_EXT_layer_settings");
+    const bool hasSettings = extensionSet.Contains("VK_EXT_layer_settings");
     if (hasSettings && !m_LayerSettings.IsEmpty())
     {
         layerSettings.sType = VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT;
@@ -534,7 +531,7 @@ Result<Instance> Instance::Builder::Build() const
     instanceInfo.ppEnabledLayerNames = layers.GetData();
     instanceInfo.pNext = pNext;
 #ifdef VK_KHR_portability_enumeration
-    if (contains(extensions, "VK_KHR_portability_enumeration"))
+    if (extensionSet.Contains("VK_KHR_portability_enumeration"))
         instanceInfo.flags |= VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR;
 #endif
 
@@ -570,6 +567,8 @@ Result<Instance> Instance::Builder::Build() const
     info.ApiVersion = apiVersion;
     info.EnabledExtensions = extensions;
     info.EnabledLayers = layers;
+    info.EnabledExtensionSet = extensionSet;
+    info.EnabledLayerSet = layerSet;
     info.AllocationCallbacks = m_AllocationCallbacks;
     info.DebugMessenger = debugMessenger;
     info.Table = table;
@@ -580,11 +579,11 @@ Result<Instance> Instance::Builder::Build() const
 
 bool Instance::IsExtensionEnabled(const char *extension) const
 {
-    return contains(m_Info.EnabledExtensions, extension);
+    return m_Info.EnabledExtensionSet.Contains(extension);
 }
 bool Instance::IsLayerEnabled(const char *layer) const
 {
-    return contains(m_Info.EnabledLayers, layer);
+    return m_Info.EnabledLayerSet.Contains(layer);
 }
 
 void Instance::Destroy()
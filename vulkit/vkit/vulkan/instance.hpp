@@ -7,6 +7,7 @@
 
 #include "vkit/vulkan/loader.hpp"
 #include "vkit/core/alias.hpp"
+#include "vkit/core/name_registry.hpp"
 #include "tkit/container/tier_array.hpp"
 #include <vulkan/vulkan.h>
 
@@ -114,6 +115,8 @@ class Instance
 
         TKit::TierArray<const char *> EnabledExtensions;
         TKit::TierArray<const char *> EnabledLayers;
+        NameSet EnabledExtensionSet;
+        NameSet EnabledLayerSet;
 
         const Vulkan::InstanceTable *Table;
 
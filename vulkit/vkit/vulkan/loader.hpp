@@ -1,6 +1,18 @@
 // Generated by Convoy's code generation script: 'vkloader.py'
 #pragma once
 #include "vkit/vulkan/vulkan.hpp"
+#include "tkit/utils/debug.hpp"
+
+// device functions are resolved on creation. see `DeviceTable`
+#ifdef VKIT_UNCHECKED_DISPATCH
+#    define VKIT_CHECK_DEVICE_FUNCTION(name)
+#else
+#    define VKIT_CHECK_DEVICE_FUNCTION(name)                                                                           \
+        TKIT_ASSERT(this->name, "[VULKIT][LOADER] The function '" #name "' is not available for the instance or "      \
+                                "device being used, either because VKit::Initialize() was not called or because "      \
+                                "the feature or extension bound to the function has not been enabled")
+#endif
+
 namespace VKit::Vulkan
 {
 
@@ -826,225 +838,498 @@ struct InstanceTable
                                        VkPhysicalDeviceToolPropertiesEXT *pToolProperties) const;
 #endif
 };
+
+/**
+ * @brief Holds the device level functions. Only the core functions of the device's API version and the functions of
+ * its enabled extensions are resolved on creation.
+ *
+ * `extensions` must also list the enabled instance extensions, as some of them, like `VK_EXT_debug_utils`, provide
+ * device level functions. `vkGetDeviceProcAddr()` returns null for any other function, so the rest are left null and
+ * never resolved later. The table is immutable after creation and can be shared between threads without
+ * synchronization.
+ *
+ * The functions used every frame are laid out first and contiguously, so that recording touches as few cache lines
+ * of the table as possible. See `default_hot_functions` in vkloader.py.
+ *
+ * When compiled with VKIT_UNCHECKED_DISPATCH, the wrappers do not assert that the function was resolved.
+ */
 struct DeviceTable
 {
-    static DeviceTable Create(VkDevice device, const InstanceTable &instanceFuncs);
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroyDevice vkDestroyDevice = VK_NULL_HANDLE;
-    void DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) const;
-#endif
+    static DeviceTable Create(VkDevice device, const InstanceTable &instanceFuncs, u32 apiVersion, u32 extensionCount,
+                              const char *const *extensions);
 
+    // hot functions
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetDeviceQueue vkGetDeviceQueue = VK_NULL_HANDLE;
-    void GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) const;
+    PFN_vkCmdBindPipeline vkCmdBindPipeline = VK_NULL_HANDLE;
+    void CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                         VkPipeline pipeline) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkQueueSubmit vkQueueSubmit = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
-                                         VkFence fence) const;
+    PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets = VK_NULL_HANDLE;
+    void CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                               VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
+                               const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
+                               const uint32_t *pDynamicOffsets) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkQueueWaitIdle vkQueueWaitIdle = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult QueueWaitIdle(VkQueue queue) const;
+    PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers = VK_NULL_HANDLE;
+    void CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                              const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDeviceWaitIdle vkDeviceWaitIdle = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult DeviceWaitIdle(VkDevice device) const;
+#if defined(VKIT_API_VERSION_1_3)
+    PFN_vkCmdBindVertexBuffers2 vkCmdBindVertexBuffers2 = VK_NULL_HANDLE;
+    void CmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                               const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
+                               const VkDeviceSize *pStrides) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkAllocateMemory vkAllocateMemory = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
-                                            const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) const;
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+    PFN_vkCmdBindVertexBuffers2EXT vkCmdBindVertexBuffers2EXT = VK_NULL_HANDLE;
+    void CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                                  const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
+                                  const VkDeviceSize *pStrides) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkFreeMemory vkFreeMemory = VK_NULL_HANDLE;
-    void FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) const;
+    PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer = VK_NULL_HANDLE;
+    void CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                            VkIndexType indexType) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkMapMemory vkMapMemory = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
-                                       VkMemoryMapFlags flags, void **ppData) const;
+#if defined(VK_EXT_shader_object)
+    PFN_vkCmdBindShadersEXT vkCmdBindShadersEXT = VK_NULL_HANDLE;
+    void CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits *pStages,
+                           const VkShaderEXT *pShaders) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkUnmapMemory vkUnmapMemory = VK_NULL_HANDLE;
-    void UnmapMemory(VkDevice device, VkDeviceMemory memory) const;
+    PFN_vkCmdPushConstants vkCmdPushConstants = VK_NULL_HANDLE;
+    void CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                          uint32_t offset, uint32_t size, const void *pValues) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkFlushMappedMemoryRanges vkFlushMappedMemoryRanges = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
-                                                     const VkMappedMemoryRange *pMemoryRanges) const;
+#if defined(VK_KHR_push_descriptor)
+    PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = VK_NULL_HANDLE;
+    void CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                 VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount,
+                                 const VkWriteDescriptorSet *pDescriptorWrites) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkInvalidateMappedMemoryRanges vkInvalidateMappedMemoryRanges = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult InvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
-                                                          const VkMappedMemoryRange *pMemoryRanges) const;
+#if (defined(VK_KHR_push_descriptor) &&                                                                                \
+     (defined(VKIT_API_VERSION_1_1) || defined(VK_KHR_descriptor_update_template))) ||                                 \
+    (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor))
+    PFN_vkCmdPushDescriptorSetWithTemplateKHR vkCmdPushDescriptorSetWithTemplateKHR = VK_NULL_HANDLE;
+    void CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
+                                             VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
+                                             VkPipelineLayout layout, uint32_t set, const void *pData) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetDeviceMemoryCommitment vkGetDeviceMemoryCommitment = VK_NULL_HANDLE;
-    void GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize *pCommittedMemoryInBytes) const;
+#if defined(VK_EXT_descriptor_buffer)
+    PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT = VK_NULL_HANDLE;
+    void CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
+                                     const VkDescriptorBufferBindingInfoEXT *pBindingInfos) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetBufferMemoryRequirements vkGetBufferMemoryRequirements = VK_NULL_HANDLE;
-    void GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements *pMemoryRequirements) const;
+#if defined(VK_EXT_descriptor_buffer)
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT = VK_NULL_HANDLE;
+    void CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                          VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
+                                          const uint32_t *pBufferIndices, const VkDeviceSize *pOffsets) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkBindBufferMemory vkBindBufferMemory = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory,
-                                              VkDeviceSize memoryOffset) const;
+    PFN_vkCmdDraw vkCmdDraw = VK_NULL_HANDLE;
+    void CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
+                 uint32_t firstInstance) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements = VK_NULL_HANDLE;
-    void GetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements *pMemoryRequirements) const;
+    PFN_vkCmdDrawIndexed vkCmdDrawIndexed = VK_NULL_HANDLE;
+    void CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
+                        int32_t vertexOffset, uint32_t firstInstance) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkBindImageMemory vkBindImageMemory = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult BindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory,
-                                             VkDeviceSize memoryOffset) const;
+    PFN_vkCmdDrawIndirect vkCmdDrawIndirect = VK_NULL_HANDLE;
+    void CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
+                         uint32_t stride) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetImageSparseMemoryRequirements vkGetImageSparseMemoryRequirements = VK_NULL_HANDLE;
-    void GetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t *pSparseMemoryRequirementCount,
-                                          VkSparseImageMemoryRequirements *pSparseMemoryRequirements) const;
+    PFN_vkCmdDrawIndexedIndirect vkCmdDrawIndexedIndirect = VK_NULL_HANDLE;
+    void CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
+                                uint32_t stride) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkQueueBindSparse vkQueueBindSparse = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
-                                             VkFence fence) const;
+#if defined(VKIT_API_VERSION_1_2)
+    PFN_vkCmdDrawIndirectCount vkCmdDrawIndirectCount = VK_NULL_HANDLE;
+    void CmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
+                              VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCreateFence vkCreateFence = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult CreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo,
-                                         const VkAllocationCallbacks *pAllocator, VkFence *pFence) const;
+#if defined(VKIT_API_VERSION_1_2)
+    PFN_vkCmdDrawIndexedIndirectCount vkCmdDrawIndexedIndirectCount = VK_NULL_HANDLE;
+    void CmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                     VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
+                                     uint32_t stride) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroyFence vkDestroyFence = VK_NULL_HANDLE;
-    void DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) const;
+#if defined(VK_EXT_mesh_shader)
+    PFN_vkCmdDrawMeshTasksEXT vkCmdDrawMeshTasksEXT = VK_NULL_HANDLE;
+    void CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                             uint32_t groupCountZ) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkResetFences vkResetFences = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) const;
+    PFN_vkCmdDispatch vkCmdDispatch = VK_NULL_HANDLE;
+    void CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                     uint32_t groupCountZ) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetFenceStatus vkGetFenceStatus = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult GetFenceStatus(VkDevice device, VkFence fence) const;
+    PFN_vkCmdDispatchIndirect vkCmdDispatchIndirect = VK_NULL_HANDLE;
+    void CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkWaitForFences vkWaitForFences = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
-                                           VkBool32 waitAll, uint64_t timeout) const;
+    PFN_vkCmdSetViewport vkCmdSetViewport = VK_NULL_HANDLE;
+    void CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                        const VkViewport *pViewports) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCreateSemaphore vkCreateSemaphore = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo,
-                                             const VkAllocationCallbacks *pAllocator, VkSemaphore *pSemaphore) const;
+    PFN_vkCmdSetScissor vkCmdSetScissor = VK_NULL_HANDLE;
+    void CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                       const VkRect2D *pScissors) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroySemaphore vkDestroySemaphore = VK_NULL_HANDLE;
-    void DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) const;
+    PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier = VK_NULL_HANDLE;
+    void CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                            VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                            uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
+                            uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers,
+                            uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCreateEvent vkCreateEvent = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult CreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo,
-                                         const VkAllocationCallbacks *pAllocator, VkEvent *pEvent) const;
+#if defined(VKIT_API_VERSION_1_3)
+    PFN_vkCmdPipelineBarrier2 vkCmdPipelineBarrier2 = VK_NULL_HANDLE;
+    void CmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroyEvent vkDestroyEvent = VK_NULL_HANDLE;
-    void DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) const;
+#if defined(VK_KHR_synchronization2)
+    PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2KHR = VK_NULL_HANDLE;
+    void CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR *pDependencyInfo) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetEventStatus vkGetEventStatus = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult GetEventStatus(VkDevice device, VkEvent event) const;
+    PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass = VK_NULL_HANDLE;
+    void CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
+                            VkSubpassContents contents) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkSetEvent vkSetEvent = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult SetEvent(VkDevice device, VkEvent event) const;
+    PFN_vkCmdNextSubpass vkCmdNextSubpass = VK_NULL_HANDLE;
+    void CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkResetEvent vkResetEvent = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult ResetEvent(VkDevice device, VkEvent event) const;
+    PFN_vkCmdEndRenderPass vkCmdEndRenderPass = VK_NULL_HANDLE;
+    void CmdEndRenderPass(VkCommandBuffer commandBuffer) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCreateQueryPool vkCreateQueryPool = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
-                                             const VkAllocationCallbacks *pAllocator, VkQueryPool *pQueryPool) const;
+#if defined(VKIT_API_VERSION_1_3)
+    PFN_vkCmdBeginRendering vkCmdBeginRendering = VK_NULL_HANDLE;
+    void CmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroyQueryPool vkDestroyQueryPool = VK_NULL_HANDLE;
-    void DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) const;
+#if defined(VK_KHR_dynamic_rendering)
+    PFN_vkCmdBeginRenderingKHR vkCmdBeginRenderingKHR = VK_NULL_HANDLE;
+    void CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR *pRenderingInfo) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkGetQueryPoolResults vkGetQueryPoolResults = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
-                                                 uint32_t queryCount, size_t dataSize, void *pData, VkDeviceSize stride,
-                                                 VkQueryResultFlags flags) const;
+#if defined(VKIT_API_VERSION_1_3)
+    PFN_vkCmdEndRendering vkCmdEndRendering = VK_NULL_HANDLE;
+    void CmdEndRendering(VkCommandBuffer commandBuffer) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_2)
-    PFN_vkResetQueryPool vkResetQueryPool = VK_NULL_HANDLE;
-    void ResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const;
+#if defined(VK_KHR_dynamic_rendering)
+    PFN_vkCmdEndRenderingKHR vkCmdEndRenderingKHR = VK_NULL_HANDLE;
+    void CmdEndRenderingKHR(VkCommandBuffer commandBuffer) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCreateBuffer vkCreateBuffer = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult CreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
-                                          const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer) const;
+    PFN_vkBeginCommandBuffer vkBeginCommandBuffer = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult BeginCommandBuffer(VkCommandBuffer commandBuffer,
+                                                const VkCommandBufferBeginInfo *pBeginInfo) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroyBuffer vkDestroyBuffer = VK_NULL_HANDLE;
-    void DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) const;
+    PFN_vkEndCommandBuffer vkEndCommandBuffer = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult EndCommandBuffer(VkCommandBuffer commandBuffer) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCreateBufferView vkCreateBufferView = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
-                                              const VkAllocationCallbacks *pAllocator, VkBufferView *pView) const;
+    PFN_vkResetCommandPool vkResetCommandPool = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult ResetCommandPool(VkDevice device, VkCommandPool commandPool,
+                                              VkCommandPoolResetFlags flags) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroyBufferView vkDestroyBufferView = VK_NULL_HANDLE;
-    void DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks *pAllocator) const;
+    PFN_vkQueueSubmit vkQueueSubmit = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                         VkFence fence) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCreateImage vkCreateImage = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult CreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
-                                         const VkAllocationCallbacks *pAllocator, VkImage *pImage) const;
+#if defined(VKIT_API_VERSION_1_3)
+    PFN_vkQueueSubmit2 vkQueueSubmit2 = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                          VkFence fence) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkDestroyImage vkDestroyImage = VK_NULL_HANDLE;
+#if defined(VK_KHR_synchronization2)
+    PFN_vkQueueSubmit2KHR vkQueueSubmit2KHR = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                             VkFence fence) const;
+#endif
+
+#if defined(VK_KHR_swapchain)
+    PFN_vkAcquireNextImageKHR vkAcquireNextImageKHR = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult AcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
+                                                 VkSemaphore semaphore, VkFence fence, uint32_t *pImageIndex) const;
+#endif
+
+#if defined(VK_KHR_swapchain)
+    PFN_vkQueuePresentKHR vkQueuePresentKHR = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkWaitForFences vkWaitForFences = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
+                                           VkBool32 waitAll, uint64_t timeout) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkResetFences vkResetFences = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_2)
+    PFN_vkWaitSemaphores vkWaitSemaphores = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult WaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo,
+                                            uint64_t timeout) const;
+#endif
+
+#if defined(VK_KHR_timeline_semaphore)
+    PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult WaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfoKHR *pWaitInfo,
+                                               uint64_t timeout) const;
+#endif
+
+    // cold functions
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroyDevice vkDestroyDevice = VK_NULL_HANDLE;
+    void DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetDeviceQueue vkGetDeviceQueue = VK_NULL_HANDLE;
+    void GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkQueueWaitIdle vkQueueWaitIdle = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult QueueWaitIdle(VkQueue queue) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDeviceWaitIdle vkDeviceWaitIdle = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult DeviceWaitIdle(VkDevice device) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkAllocateMemory vkAllocateMemory = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkFreeMemory vkFreeMemory = VK_NULL_HANDLE;
+    void FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkMapMemory vkMapMemory = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                       VkMemoryMapFlags flags, void **ppData) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkUnmapMemory vkUnmapMemory = VK_NULL_HANDLE;
+    void UnmapMemory(VkDevice device, VkDeviceMemory memory) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkFlushMappedMemoryRanges vkFlushMappedMemoryRanges = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                                     const VkMappedMemoryRange *pMemoryRanges) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkInvalidateMappedMemoryRanges vkInvalidateMappedMemoryRanges = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult InvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                                          const VkMappedMemoryRange *pMemoryRanges) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetDeviceMemoryCommitment vkGetDeviceMemoryCommitment = VK_NULL_HANDLE;
+    void GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize *pCommittedMemoryInBytes) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetBufferMemoryRequirements vkGetBufferMemoryRequirements = VK_NULL_HANDLE;
+    void GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements *pMemoryRequirements) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkBindBufferMemory vkBindBufferMemory = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory,
+                                              VkDeviceSize memoryOffset) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements = VK_NULL_HANDLE;
+    void GetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements *pMemoryRequirements) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkBindImageMemory vkBindImageMemory = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult BindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory,
+                                             VkDeviceSize memoryOffset) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetImageSparseMemoryRequirements vkGetImageSparseMemoryRequirements = VK_NULL_HANDLE;
+    void GetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t *pSparseMemoryRequirementCount,
+                                          VkSparseImageMemoryRequirements *pSparseMemoryRequirements) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkQueueBindSparse vkQueueBindSparse = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
+                                             VkFence fence) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkCreateFence vkCreateFence = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult CreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkFence *pFence) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroyFence vkDestroyFence = VK_NULL_HANDLE;
+    void DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetFenceStatus vkGetFenceStatus = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult GetFenceStatus(VkDevice device, VkFence fence) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkCreateSemaphore vkCreateSemaphore = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo,
+                                             const VkAllocationCallbacks *pAllocator, VkSemaphore *pSemaphore) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroySemaphore vkDestroySemaphore = VK_NULL_HANDLE;
+    void DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkCreateEvent vkCreateEvent = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult CreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkEvent *pEvent) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroyEvent vkDestroyEvent = VK_NULL_HANDLE;
+    void DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetEventStatus vkGetEventStatus = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult GetEventStatus(VkDevice device, VkEvent event) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkSetEvent vkSetEvent = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult SetEvent(VkDevice device, VkEvent event) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkResetEvent vkResetEvent = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult ResetEvent(VkDevice device, VkEvent event) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkCreateQueryPool vkCreateQueryPool = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
+                                             const VkAllocationCallbacks *pAllocator, VkQueryPool *pQueryPool) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroyQueryPool vkDestroyQueryPool = VK_NULL_HANDLE;
+    void DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkGetQueryPoolResults vkGetQueryPoolResults = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
+                                                 uint32_t queryCount, size_t dataSize, void *pData, VkDeviceSize stride,
+                                                 VkQueryResultFlags flags) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_2)
+    PFN_vkResetQueryPool vkResetQueryPool = VK_NULL_HANDLE;
+    void ResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkCreateBuffer vkCreateBuffer = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult CreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
+                                          const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroyBuffer vkDestroyBuffer = VK_NULL_HANDLE;
+    void DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkCreateBufferView vkCreateBufferView = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator, VkBufferView *pView) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroyBufferView vkDestroyBufferView = VK_NULL_HANDLE;
+    void DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks *pAllocator) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkCreateImage vkCreateImage = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult CreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkImage *pImage) const;
+#endif
+
+#if defined(VKIT_API_VERSION_1_0)
+    PFN_vkDestroyImage vkDestroyImage = VK_NULL_HANDLE;
     void DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) const;
 #endif
 
@@ -1290,12 +1575,6 @@ struct DeviceTable
     void DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkResetCommandPool vkResetCommandPool = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult ResetCommandPool(VkDevice device, VkCommandPool commandPool,
-                                              VkCommandPoolResetFlags flags) const;
-#endif
-
 #if defined(VKIT_API_VERSION_1_0)
     PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers = VK_NULL_HANDLE;
     VKIT_NO_DISCARD VkResult AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
@@ -1309,42 +1588,13 @@ struct DeviceTable
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
-    PFN_vkBeginCommandBuffer vkBeginCommandBuffer = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult BeginCommandBuffer(VkCommandBuffer commandBuffer,
-                                                const VkCommandBufferBeginInfo *pBeginInfo) const;
+    PFN_vkResetCommandBuffer vkResetCommandBuffer = VK_NULL_HANDLE;
+    VKIT_NO_DISCARD VkResult ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkEndCommandBuffer vkEndCommandBuffer = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult EndCommandBuffer(VkCommandBuffer commandBuffer) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkResetCommandBuffer vkResetCommandBuffer = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdBindPipeline vkCmdBindPipeline = VK_NULL_HANDLE;
-    void CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
-                         VkPipeline pipeline) const;
-#endif
-
-#if defined(VK_EXT_attachment_feedback_loop_dynamic_state)
-    PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT vkCmdSetAttachmentFeedbackLoopEnableEXT = VK_NULL_HANDLE;
-    void CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdSetViewport vkCmdSetViewport = VK_NULL_HANDLE;
-    void CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
-                        const VkViewport *pViewports) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdSetScissor vkCmdSetScissor = VK_NULL_HANDLE;
-    void CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
-                       const VkRect2D *pScissors) const;
+#if defined(VK_EXT_attachment_feedback_loop_dynamic_state)
+    PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT vkCmdSetAttachmentFeedbackLoopEnableEXT = VK_NULL_HANDLE;
+    void CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask) const;
 #endif
 
 #if defined(VKIT_API_VERSION_1_0)
@@ -1384,38 +1634,6 @@ struct DeviceTable
     void CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets = VK_NULL_HANDLE;
-    void CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
-                               VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
-                               const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
-                               const uint32_t *pDynamicOffsets) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer = VK_NULL_HANDLE;
-    void CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
-                            VkIndexType indexType) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers = VK_NULL_HANDLE;
-    void CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
-                              const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdDraw vkCmdDraw = VK_NULL_HANDLE;
-    void CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
-                 uint32_t firstInstance) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdDrawIndexed vkCmdDrawIndexed = VK_NULL_HANDLE;
-    void CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
-                        int32_t vertexOffset, uint32_t firstInstance) const;
-#endif
-
 #if defined(VK_EXT_multi_draw)
     PFN_vkCmdDrawMultiEXT vkCmdDrawMultiEXT = VK_NULL_HANDLE;
     void CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT *pVertexInfo,
@@ -1429,29 +1647,6 @@ struct DeviceTable
                                 uint32_t firstInstance, uint32_t stride, const int32_t *pVertexOffset) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdDrawIndirect vkCmdDrawIndirect = VK_NULL_HANDLE;
-    void CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
-                         uint32_t stride) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdDrawIndexedIndirect vkCmdDrawIndexedIndirect = VK_NULL_HANDLE;
-    void CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
-                                uint32_t stride) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdDispatch vkCmdDispatch = VK_NULL_HANDLE;
-    void CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
-                     uint32_t groupCountZ) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdDispatchIndirect vkCmdDispatchIndirect = VK_NULL_HANDLE;
-    void CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const;
-#endif
-
 #if (defined(VK_HUAWEI_subpass_shading) && VK_HUAWEI_SUBPASS_SHADING_SPEC_VERSION >= 2)
     PFN_vkCmdSubpassShadingHUAWEI vkCmdSubpassShadingHUAWEI = VK_NULL_HANDLE;
     void CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) const;
@@ -1591,15 +1786,6 @@ struct DeviceTable
                        uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier = VK_NULL_HANDLE;
-    void CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
-                            VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
-                            uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
-                            uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers,
-                            uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) const;
-#endif
-
 #if defined(VKIT_API_VERSION_1_0)
     PFN_vkCmdBeginQuery vkCmdBeginQuery = VK_NULL_HANDLE;
     void CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
@@ -1641,28 +1827,6 @@ struct DeviceTable
                                  VkQueryResultFlags flags) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdPushConstants vkCmdPushConstants = VK_NULL_HANDLE;
-    void CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
-                          uint32_t offset, uint32_t size, const void *pValues) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass = VK_NULL_HANDLE;
-    void CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
-                            VkSubpassContents contents) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdNextSubpass vkCmdNextSubpass = VK_NULL_HANDLE;
-    void CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_0)
-    PFN_vkCmdEndRenderPass vkCmdEndRenderPass = VK_NULL_HANDLE;
-    void CmdEndRenderPass(VkCommandBuffer commandBuffer) const;
-#endif
-
 #if defined(VKIT_API_VERSION_1_0)
     PFN_vkCmdExecuteCommands vkCmdExecuteCommands = VK_NULL_HANDLE;
     void CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
@@ -1695,17 +1859,6 @@ struct DeviceTable
                                                    uint32_t *pSwapchainImageCount, VkImage *pSwapchainImages) const;
 #endif
 
-#if defined(VK_KHR_swapchain)
-    PFN_vkAcquireNextImageKHR vkAcquireNextImageKHR = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult AcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
-                                                 VkSemaphore semaphore, VkFence fence, uint32_t *pImageIndex) const;
-#endif
-
-#if defined(VK_KHR_swapchain)
-    PFN_vkQueuePresentKHR vkQueuePresentKHR = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) const;
-#endif
-
 #if defined(VK_EXT_debug_marker)
     PFN_vkDebugMarkerSetObjectNameEXT vkDebugMarkerSetObjectNameEXT = VK_NULL_HANDLE;
     VKIT_NO_DISCARD VkResult DebugMarkerSetObjectNameEXT(VkDevice device,
@@ -2393,12 +2546,6 @@ struct DeviceTable
     VKIT_NO_DISCARD VkResult GetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_2)
-    PFN_vkWaitSemaphores vkWaitSemaphores = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult WaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo,
-                                            uint64_t timeout) const;
-#endif
-
 #if defined(VKIT_API_VERSION_1_2)
     PFN_vkSignalSemaphore vkSignalSemaphore = VK_NULL_HANDLE;
     VKIT_NO_DISCARD VkResult SignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo *pSignalInfo) const;
@@ -2418,19 +2565,6 @@ struct DeviceTable
                                           struct AHardwareBuffer **pBuffer) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_2)
-    PFN_vkCmdDrawIndirectCount vkCmdDrawIndirectCount = VK_NULL_HANDLE;
-    void CmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
-                              VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_2)
-    PFN_vkCmdDrawIndexedIndirectCount vkCmdDrawIndexedIndirectCount = VK_NULL_HANDLE;
-    void CmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
-                                     VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
-                                     uint32_t stride) const;
-#endif
-
 #if defined(VK_NV_device_diagnostic_checkpoints)
     PFN_vkCmdSetCheckpointNV vkCmdSetCheckpointNV = VK_NULL_HANDLE;
     void CmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void *pCheckpointMarker) const;
@@ -2533,12 +2667,6 @@ struct DeviceTable
                                          uint32_t stride) const;
 #endif
 
-#if defined(VK_EXT_mesh_shader)
-    PFN_vkCmdDrawMeshTasksEXT vkCmdDrawMeshTasksEXT = VK_NULL_HANDLE;
-    void CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
-                             uint32_t groupCountZ) const;
-#endif
-
 #if defined(VK_EXT_mesh_shader)
     PFN_vkCmdDrawMeshTasksIndirectEXT vkCmdDrawMeshTasksIndirectEXT = VK_NULL_HANDLE;
     void CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -3048,13 +3176,6 @@ struct DeviceTable
                              VkIndexType indexType) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_3)
-    PFN_vkCmdBindVertexBuffers2 vkCmdBindVertexBuffers2 = VK_NULL_HANDLE;
-    void CmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
-                               const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
-                               const VkDeviceSize *pStrides) const;
-#endif
-
 #if defined(VKIT_API_VERSION_1_3)
     PFN_vkCmdSetDepthTestEnable vkCmdSetDepthTestEnable = VK_NULL_HANDLE;
     void CmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const;
@@ -3415,17 +3536,6 @@ struct DeviceTable
                         const VkDependencyInfo *pDependencyInfos) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_3)
-    PFN_vkCmdPipelineBarrier2 vkCmdPipelineBarrier2 = VK_NULL_HANDLE;
-    void CmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_3)
-    PFN_vkQueueSubmit2 vkQueueSubmit2 = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
-                                          VkFence fence) const;
-#endif
-
 #if defined(VKIT_API_VERSION_1_3)
     PFN_vkCmdWriteTimestamp2 vkCmdWriteTimestamp2 = VK_NULL_HANDLE;
     void CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
@@ -3621,19 +3731,6 @@ struct DeviceTable
                           void *pDescriptor) const;
 #endif
 
-#if defined(VK_EXT_descriptor_buffer)
-    PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT = VK_NULL_HANDLE;
-    void CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
-                                     const VkDescriptorBufferBindingInfoEXT *pBindingInfos) const;
-#endif
-
-#if defined(VK_EXT_descriptor_buffer)
-    PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT = VK_NULL_HANDLE;
-    void CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
-                                          VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
-                                          const uint32_t *pBufferIndices, const VkDeviceSize *pOffsets) const;
-#endif
-
 #if defined(VK_EXT_descriptor_buffer)
     PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT vkCmdBindDescriptorBufferEmbeddedSamplersEXT = VK_NULL_HANDLE;
     void CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandBuffer commandBuffer,
@@ -3760,16 +3857,6 @@ struct DeviceTable
     void CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer, const VkCudaLaunchInfoNV *pLaunchInfo) const;
 #endif
 
-#if defined(VKIT_API_VERSION_1_3)
-    PFN_vkCmdBeginRendering vkCmdBeginRendering = VK_NULL_HANDLE;
-    void CmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo) const;
-#endif
-
-#if defined(VKIT_API_VERSION_1_3)
-    PFN_vkCmdEndRendering vkCmdEndRendering = VK_NULL_HANDLE;
-    void CmdEndRendering(VkCommandBuffer commandBuffer) const;
-#endif
-
 #if defined(VK_EXT_fragment_density_map_offset)
     PFN_vkCmdEndRendering2EXT vkCmdEndRendering2EXT = VK_NULL_HANDLE;
     void CmdEndRendering2EXT(VkCommandBuffer commandBuffer, const VkRenderingEndInfoEXT *pRenderingEndInfo) const;
@@ -3997,12 +4084,6 @@ struct DeviceTable
                                                     void *pData) const;
 #endif
 
-#if defined(VK_EXT_shader_object)
-    PFN_vkCmdBindShadersEXT vkCmdBindShadersEXT = VK_NULL_HANDLE;
-    void CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits *pStages,
-                           const VkShaderEXT *pShaders) const;
-#endif
-
 #if defined(VK_QNX_external_memory_screen_buffer)
     PFN_vkGetScreenBufferPropertiesQNX vkGetScreenBufferPropertiesQNX = VK_NULL_HANDLE;
     VKIT_NO_DISCARD VkResult GetScreenBufferPropertiesQNX(VkDevice device, const struct _screen_buffer *buffer,
@@ -4336,13 +4417,6 @@ struct DeviceTable
                                         VkExtent2D *pGranularity) const;
 #endif
 
-#if defined(VK_KHR_push_descriptor)
-    PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = VK_NULL_HANDLE;
-    void CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
-                                 VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount,
-                                 const VkWriteDescriptorSet *pDescriptorWrites) const;
-#endif
-
 #if defined(VK_KHR_maintenance1)
     PFN_vkTrimCommandPoolKHR vkTrimCommandPoolKHR = VK_NULL_HANDLE;
     void TrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlagsKHR flags) const;
@@ -4399,15 +4473,6 @@ struct DeviceTable
                                             const void *pData) const;
 #endif
 
-#if (defined(VK_KHR_push_descriptor) &&                                                                                \
-     (defined(VKIT_API_VERSION_1_1) || defined(VK_KHR_descriptor_update_template))) ||                                 \
-    (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor))
-    PFN_vkCmdPushDescriptorSetWithTemplateKHR vkCmdPushDescriptorSetWithTemplateKHR = VK_NULL_HANDLE;
-    void CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
-                                             VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
-                                             VkPipelineLayout layout, uint32_t set, const void *pData) const;
-#endif
-
 #if defined(VK_KHR_get_memory_requirements2)
     PFN_vkGetBufferMemoryRequirements2KHR vkGetBufferMemoryRequirements2KHR = VK_NULL_HANDLE;
     void GetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2KHR *pInfo,
@@ -4503,12 +4568,6 @@ struct DeviceTable
                                                          uint64_t *pValue) const;
 #endif
 
-#if defined(VK_KHR_timeline_semaphore)
-    PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult WaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfoKHR *pWaitInfo,
-                                               uint64_t timeout) const;
-#endif
-
 #if defined(VK_KHR_timeline_semaphore)
     PFN_vkSignalSemaphoreKHR vkSignalSemaphoreKHR = VK_NULL_HANDLE;
     VKIT_NO_DISCARD VkResult SignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfoKHR *pSignalInfo) const;
@@ -4618,13 +4677,6 @@ struct DeviceTable
                                 VkIndexType indexType) const;
 #endif
 
-#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
-    PFN_vkCmdBindVertexBuffers2EXT vkCmdBindVertexBuffers2EXT = VK_NULL_HANDLE;
-    void CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
-                                  const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
-                                  const VkDeviceSize *pStrides) const;
-#endif
-
 #if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
     PFN_vkCmdSetDepthTestEnableEXT vkCmdSetDepthTestEnableEXT = VK_NULL_HANDLE;
     void CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const;
@@ -4746,17 +4798,6 @@ struct DeviceTable
                            const VkDependencyInfoKHR *pDependencyInfos) const;
 #endif
 
-#if defined(VK_KHR_synchronization2)
-    PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2KHR = VK_NULL_HANDLE;
-    void CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR *pDependencyInfo) const;
-#endif
-
-#if defined(VK_KHR_synchronization2)
-    PFN_vkQueueSubmit2KHR vkQueueSubmit2KHR = VK_NULL_HANDLE;
-    VKIT_NO_DISCARD VkResult QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
-                                             VkFence fence) const;
-#endif
-
 #if defined(VK_KHR_synchronization2)
     PFN_vkCmdWriteTimestamp2KHR vkCmdWriteTimestamp2KHR = VK_NULL_HANDLE;
     void CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool,
@@ -4787,16 +4828,6 @@ struct DeviceTable
                                                       const VkHostImageLayoutTransitionInfoEXT *pTransitions) const;
 #endif
 
-#if defined(VK_KHR_dynamic_rendering)
-    PFN_vkCmdBeginRenderingKHR vkCmdBeginRenderingKHR = VK_NULL_HANDLE;
-    void CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfoKHR *pRenderingInfo) const;
-#endif
-
-#if defined(VK_KHR_dynamic_rendering)
-    PFN_vkCmdEndRenderingKHR vkCmdEndRenderingKHR = VK_NULL_HANDLE;
-    void CmdEndRenderingKHR(VkCommandBuffer commandBuffer) const;
-#endif
-
 #if defined(VK_KHR_maintenance5)
     PFN_vkGetImageSubresourceLayout2KHR vkGetImageSubresourceLayout2KHR = VK_NULL_HANDLE;
     void GetImageSubresourceLayout2KHR(VkDevice device, VkImage image, const VkImageSubresource2KHR *pSubresource,
@@ -4867,5 +4898,5574 @@ struct DeviceTable
     void CmdSetRenderingInputAttachmentIndicesKHR(
         VkCommandBuffer commandBuffer, const VkRenderingInputAttachmentIndexInfoKHR *pInputAttachmentIndexInfo) const;
 #endif
+
+  private:
+    static void loadExtension(DeviceTable &table, const char *extension);
+    PFN_vkVoidFunction resolve(const char *name) const;
+
+    VkDevice m_Device = VK_NULL_HANDLE;
+    PFN_vkGetDeviceProcAddr m_GetDeviceProcAddr = VK_NULL_HANDLE;
 };
+
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyDevice);
+    this->vkDestroyDevice(device, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex,
+                                        VkQueue *pQueue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceQueue);
+    this->vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                         VkFence fence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueSubmit);
+    return this->vkQueueSubmit(queue, submitCount, pSubmits, fence);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::QueueWaitIdle(VkQueue queue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueWaitIdle);
+    return this->vkQueueWaitIdle(queue);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::DeviceWaitIdle(VkDevice device) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDeviceWaitIdle);
+    return this->vkDeviceWaitIdle(device);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAllocateMemory);
+    return this->vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::FreeMemory(VkDevice device, VkDeviceMemory memory,
+                                    const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkFreeMemory);
+    this->vkFreeMemory(device, memory, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                       VkMemoryMapFlags flags, void **ppData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkMapMemory);
+    return this->vkMapMemory(device, memory, offset, size, flags, ppData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::UnmapMemory(VkDevice device, VkDeviceMemory memory) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUnmapMemory);
+    this->vkUnmapMemory(device, memory);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                                     const VkMappedMemoryRange *pMemoryRanges) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkFlushMappedMemoryRanges);
+    return this->vkFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::InvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                                          const VkMappedMemoryRange *pMemoryRanges) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkInvalidateMappedMemoryRanges);
+    return this->vkInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory,
+                                                   VkDeviceSize *pCommittedMemoryInBytes) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceMemoryCommitment);
+    this->vkGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer,
+                                                     VkMemoryRequirements *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferMemoryRequirements);
+    this->vkGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory,
+                                              VkDeviceSize memoryOffset) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindBufferMemory);
+    return this->vkBindBufferMemory(device, buffer, memory, memoryOffset);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::GetImageMemoryRequirements(VkDevice device, VkImage image,
+                                                    VkMemoryRequirements *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageMemoryRequirements);
+    this->vkGetImageMemoryRequirements(device, image, pMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::BindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory,
+                                             VkDeviceSize memoryOffset) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindImageMemory);
+    return this->vkBindImageMemory(device, image, memory, memoryOffset);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::GetImageSparseMemoryRequirements(
+    VkDevice device, VkImage image, uint32_t *pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements *pSparseMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageSparseMemoryRequirements);
+    this->vkGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
+                                             VkFence fence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueBindSparse);
+    return this->vkQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkFence *pFence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateFence);
+    return this->vkCreateFence(device, pCreateInfo, pAllocator, pFence);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyFence);
+    this->vkDestroyFence(device, fence, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkResetFences);
+    return this->vkResetFences(device, fenceCount, pFences);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::GetFenceStatus(VkDevice device, VkFence fence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetFenceStatus);
+    return this->vkGetFenceStatus(device, fence);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
+                                           VkBool32 waitAll, uint64_t timeout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkWaitForFences);
+    return this->vkWaitForFences(device, fenceCount, pFences, waitAll, timeout);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo,
+                                             const VkAllocationCallbacks *pAllocator, VkSemaphore *pSemaphore) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateSemaphore);
+    return this->vkCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroySemaphore(VkDevice device, VkSemaphore semaphore,
+                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroySemaphore);
+    this->vkDestroySemaphore(device, semaphore, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkEvent *pEvent) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateEvent);
+    return this->vkCreateEvent(device, pCreateInfo, pAllocator, pEvent);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyEvent);
+    this->vkDestroyEvent(device, event, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::GetEventStatus(VkDevice device, VkEvent event) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetEventStatus);
+    return this->vkGetEventStatus(device, event);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::SetEvent(VkDevice device, VkEvent event) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetEvent);
+    return this->vkSetEvent(device, event);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::ResetEvent(VkDevice device, VkEvent event) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkResetEvent);
+    return this->vkResetEvent(device, event);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
+                                             const VkAllocationCallbacks *pAllocator, VkQueryPool *pQueryPool) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateQueryPool);
+    return this->vkCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyQueryPool(VkDevice device, VkQueryPool queryPool,
+                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyQueryPool);
+    this->vkDestroyQueryPool(device, queryPool, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
+                                                 uint32_t queryCount, size_t dataSize, void *pData, VkDeviceSize stride,
+                                                 VkQueryResultFlags flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetQueryPoolResults);
+    return this->vkGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline void DeviceTable::ResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
+                                        uint32_t queryCount) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkResetQueryPool);
+    this->vkResetQueryPool(device, queryPool, firstQuery, queryCount);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
+                                          const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateBuffer);
+    return this->vkCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyBuffer);
+    this->vkDestroyBuffer(device, buffer, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator, VkBufferView *pView) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateBufferView);
+    return this->vkCreateBufferView(device, pCreateInfo, pAllocator, pView);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyBufferView(VkDevice device, VkBufferView bufferView,
+                                           const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyBufferView);
+    this->vkDestroyBufferView(device, bufferView, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkImage *pImage) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateImage);
+    return this->vkCreateImage(device, pCreateInfo, pAllocator, pImage);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyImage);
+    this->vkDestroyImage(device, image, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::GetImageSubresourceLayout(VkDevice device, VkImage image,
+                                                   const VkImageSubresource *pSubresource,
+                                                   VkSubresourceLayout *pLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageSubresourceLayout);
+    this->vkGetImageSubresourceLayout(device, image, pSubresource, pLayout);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
+                                             const VkAllocationCallbacks *pAllocator, VkImageView *pView) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateImageView);
+    return this->vkCreateImageView(device, pCreateInfo, pAllocator, pView);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyImageView(VkDevice device, VkImageView imageView,
+                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyImageView);
+    this->vkDestroyImageView(device, imageView, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
+                                                const VkAllocationCallbacks *pAllocator,
+                                                VkShaderModule *pShaderModule) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateShaderModule);
+    return this->vkCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                             const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyShaderModule);
+    this->vkDestroyShaderModule(device, shaderModule, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo *pCreateInfo,
+                                                 const VkAllocationCallbacks *pAllocator,
+                                                 VkPipelineCache *pPipelineCache) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreatePipelineCache);
+    return this->vkCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache,
+                                              const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyPipelineCache);
+    this->vkDestroyPipelineCache(device, pipelineCache, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t *pDataSize,
+                                                  void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineCacheData);
+    return this->vkGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::MergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount,
+                                                 const VkPipelineCache *pSrcCaches) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkMergePipelineCaches);
+    return this->vkMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+}
+#endif
+#if defined(VK_KHR_pipeline_binary)
+inline VkResult DeviceTable::CreatePipelineBinariesKHR(VkDevice device,
+                                                       const VkPipelineBinaryCreateInfoKHR *pCreateInfo,
+                                                       const VkAllocationCallbacks *pAllocator,
+                                                       VkPipelineBinaryHandlesInfoKHR *pBinaries) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreatePipelineBinariesKHR);
+    return this->vkCreatePipelineBinariesKHR(device, pCreateInfo, pAllocator, pBinaries);
+}
+#endif
+#if defined(VK_KHR_pipeline_binary)
+inline void DeviceTable::DestroyPipelineBinaryKHR(VkDevice device, VkPipelineBinaryKHR pipelineBinary,
+                                                  const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyPipelineBinaryKHR);
+    this->vkDestroyPipelineBinaryKHR(device, pipelineBinary, pAllocator);
+}
+#endif
+#if defined(VK_KHR_pipeline_binary)
+inline VkResult DeviceTable::GetPipelineKeyKHR(VkDevice device, const VkPipelineCreateInfoKHR *pPipelineCreateInfo,
+                                               VkPipelineBinaryKeyKHR *pPipelineKey) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineKeyKHR);
+    return this->vkGetPipelineKeyKHR(device, pPipelineCreateInfo, pPipelineKey);
+}
+#endif
+#if defined(VK_KHR_pipeline_binary)
+inline VkResult DeviceTable::GetPipelineBinaryDataKHR(VkDevice device, const VkPipelineBinaryDataInfoKHR *pInfo,
+                                                      VkPipelineBinaryKeyKHR *pPipelineBinaryKey,
+                                                      size_t *pPipelineBinaryDataSize, void *pPipelineBinaryData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineBinaryDataKHR);
+    return this->vkGetPipelineBinaryDataKHR(device, pInfo, pPipelineBinaryKey, pPipelineBinaryDataSize,
+                                            pPipelineBinaryData);
+}
+#endif
+#if defined(VK_KHR_pipeline_binary)
+inline VkResult DeviceTable::ReleaseCapturedPipelineDataKHR(VkDevice device,
+                                                            const VkReleaseCapturedPipelineDataInfoKHR *pInfo,
+                                                            const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkReleaseCapturedPipelineDataKHR);
+    return this->vkReleaseCapturedPipelineDataKHR(device, pInfo, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                     uint32_t createInfoCount,
+                                                     const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                                     const VkAllocationCallbacks *pAllocator,
+                                                     VkPipeline *pPipelines) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateGraphicsPipelines);
+    return this->vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                           pPipelines);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                    uint32_t createInfoCount,
+                                                    const VkComputePipelineCreateInfo *pCreateInfos,
+                                                    const VkAllocationCallbacks *pAllocator,
+                                                    VkPipeline *pPipelines) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateComputePipelines);
+    return this->vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+#endif
+#if (defined(VK_HUAWEI_subpass_shading) && VK_HUAWEI_SUBPASS_SHADING_SPEC_VERSION >= 2)
+inline VkResult DeviceTable::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkDevice device, VkRenderPass renderpass,
+                                                                           VkExtent2D *pMaxWorkgroupSize) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
+    return this->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyPipeline(VkDevice device, VkPipeline pipeline,
+                                         const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyPipeline);
+    this->vkDestroyPipeline(device, pipeline, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator,
+                                                  VkPipelineLayout *pPipelineLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreatePipelineLayout);
+    return this->vkCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
+                                               const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyPipelineLayout);
+    this->vkDestroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
+                                           const VkAllocationCallbacks *pAllocator, VkSampler *pSampler) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateSampler);
+    return this->vkCreateSampler(device, pCreateInfo, pAllocator, pSampler);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroySampler(VkDevice device, VkSampler sampler,
+                                        const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroySampler);
+    this->vkDestroySampler(device, sampler, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateDescriptorSetLayout(VkDevice device,
+                                                       const VkDescriptorSetLayoutCreateInfo *pCreateInfo,
+                                                       const VkAllocationCallbacks *pAllocator,
+                                                       VkDescriptorSetLayout *pSetLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateDescriptorSetLayout);
+    return this->vkCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
+                                                    const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyDescriptorSetLayout);
+    this->vkDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator,
+                                                  VkDescriptorPool *pDescriptorPool) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateDescriptorPool);
+    return this->vkCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                               const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyDescriptorPool);
+    this->vkDestroyDescriptorPool(device, descriptorPool, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                 VkDescriptorPoolResetFlags flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkResetDescriptorPool);
+    return this->vkResetDescriptorPool(device, descriptorPool, flags);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                                    VkDescriptorSet *pDescriptorSets) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAllocateDescriptorSets);
+    return this->vkAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool,
+                                                uint32_t descriptorSetCount,
+                                                const VkDescriptorSet *pDescriptorSets) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkFreeDescriptorSets);
+    return this->vkFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::UpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
+                                              const VkWriteDescriptorSet *pDescriptorWrites,
+                                              uint32_t descriptorCopyCount,
+                                              const VkCopyDescriptorSet *pDescriptorCopies) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUpdateDescriptorSets);
+    this->vkUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
+                                 pDescriptorCopies);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo,
+                                               const VkAllocationCallbacks *pAllocator,
+                                               VkFramebuffer *pFramebuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateFramebuffer);
+    return this->vkCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer,
+                                            const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyFramebuffer);
+    this->vkDestroyFramebuffer(device, framebuffer, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateRenderPass);
+    return this->vkCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyRenderPass(VkDevice device, VkRenderPass renderPass,
+                                           const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyRenderPass);
+    this->vkDestroyRenderPass(device, renderPass, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::GetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass,
+                                                  VkExtent2D *pGranularity) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRenderAreaGranularity);
+    this->vkGetRenderAreaGranularity(device, renderPass, pGranularity);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::GetRenderingAreaGranularity(VkDevice device, const VkRenderingAreaInfo *pRenderingAreaInfo,
+                                                     VkExtent2D *pGranularity) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRenderingAreaGranularity);
+    this->vkGetRenderingAreaGranularity(device, pRenderingAreaInfo, pGranularity);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
+                                               const VkAllocationCallbacks *pAllocator,
+                                               VkCommandPool *pCommandPool) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateCommandPool);
+    return this->vkCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::DestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                            const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyCommandPool);
+    this->vkDestroyCommandPool(device, commandPool, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::ResetCommandPool(VkDevice device, VkCommandPool commandPool,
+                                              VkCommandPoolResetFlags flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkResetCommandPool);
+    return this->vkResetCommandPool(device, commandPool, flags);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                                    VkCommandBuffer *pCommandBuffers) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAllocateCommandBuffers);
+    return this->vkAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                            const VkCommandBuffer *pCommandBuffers) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkFreeCommandBuffers);
+    this->vkFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::BeginCommandBuffer(VkCommandBuffer commandBuffer,
+                                                const VkCommandBufferBeginInfo *pBeginInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBeginCommandBuffer);
+    return this->vkBeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::EndCommandBuffer(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkEndCommandBuffer);
+    return this->vkEndCommandBuffer(commandBuffer);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline VkResult DeviceTable::ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkResetCommandBuffer);
+    return this->vkResetCommandBuffer(commandBuffer, flags);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                         VkPipeline pipeline) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindPipeline);
+    this->vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+#endif
+#if defined(VK_EXT_attachment_feedback_loop_dynamic_state)
+inline void DeviceTable::CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffer,
+                                                               VkImageAspectFlags aspectMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetAttachmentFeedbackLoopEnableEXT);
+    this->vkCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                                        const VkViewport *pViewports) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetViewport);
+    this->vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                                       const VkRect2D *pScissors) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetScissor);
+    this->vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLineWidth);
+    this->vkCmdSetLineWidth(commandBuffer, lineWidth);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor,
+                                         float depthBiasClamp, float depthBiasSlopeFactor) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthBias);
+    this->vkCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetBlendConstants);
+    this->vkCmdSetBlendConstants(commandBuffer, blendConstants);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds,
+                                           float maxDepthBounds) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthBounds);
+    this->vkCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
+                                                  uint32_t compareMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetStencilCompareMask);
+    this->vkCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
+                                                uint32_t writeMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetStencilWriteMask);
+    this->vkCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
+                                                uint32_t reference) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetStencilReference);
+    this->vkCmdSetStencilReference(commandBuffer, faceMask, reference);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                               VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
+                                               const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
+                                               const uint32_t *pDynamicOffsets) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindDescriptorSets);
+    this->vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
+                                  pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                            VkIndexType indexType) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindIndexBuffer);
+    this->vkCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding,
+                                              uint32_t bindingCount, const VkBuffer *pBuffers,
+                                              const VkDeviceSize *pOffsets) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindVertexBuffers);
+    this->vkCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
+                                 uint32_t firstVertex, uint32_t firstInstance) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDraw);
+    this->vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
+                                        uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndexed);
+    this->vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+#endif
+#if defined(VK_EXT_multi_draw)
+inline void DeviceTable::CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount,
+                                         const VkMultiDrawInfoEXT *pVertexInfo, uint32_t instanceCount,
+                                         uint32_t firstInstance, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMultiEXT);
+    this->vkCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+}
+#endif
+#if defined(VK_EXT_multi_draw)
+inline void DeviceTable::CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount,
+                                                const VkMultiDrawIndexedInfoEXT *pIndexInfo, uint32_t instanceCount,
+                                                uint32_t firstInstance, uint32_t stride,
+                                                const int32_t *pVertexOffset) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMultiIndexedEXT);
+    this->vkCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride,
+                                   pVertexOffset);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                         uint32_t drawCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndirect);
+    this->vkCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                uint32_t drawCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndexedIndirect);
+    this->vkCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                     uint32_t groupCountZ) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatch);
+    this->vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchIndirect);
+    this->vkCmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+#endif
+#if (defined(VK_HUAWEI_subpass_shading) && VK_HUAWEI_SUBPASS_SHADING_SPEC_VERSION >= 2)
+inline void DeviceTable::CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSubpassShadingHUAWEI);
+    this->vkCmdSubpassShadingHUAWEI(commandBuffer);
+}
+#endif
+#if defined(VK_HUAWEI_cluster_culling_shader)
+inline void DeviceTable::CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                              uint32_t groupCountZ) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawClusterHUAWEI);
+    this->vkCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+#endif
+#if defined(VK_HUAWEI_cluster_culling_shader)
+inline void DeviceTable::CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                      VkDeviceSize offset) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawClusterIndirectHUAWEI);
+    this->vkCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset);
+}
+#endif
+#if defined(VK_NV_device_generated_commands_compute)
+inline void DeviceTable::CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer commandBuffer,
+                                                           VkPipelineBindPoint pipelineBindPoint,
+                                                           VkPipeline pipeline) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdUpdatePipelineIndirectBufferNV);
+    this->vkCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
+                                       uint32_t regionCount, const VkBufferCopy *pRegions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyBuffer);
+    this->vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                      VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                      const VkImageCopy *pRegions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyImage);
+    this->vkCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                      VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                      const VkImageBlit *pRegions, VkFilter filter) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBlitImage);
+    this->vkCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions,
+                         filter);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
+                                              VkImageLayout dstImageLayout, uint32_t regionCount,
+                                              const VkBufferImageCopy *pRegions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyBufferToImage);
+    this->vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage,
+                                              VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount,
+                                              const VkBufferImageCopy *pRegions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyImageToBuffer);
+    this->vkCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+#endif
+#if defined(VK_NV_copy_memory_indirect)
+inline void DeviceTable::CmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress,
+                                                 uint32_t copyCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMemoryIndirectNV);
+    this->vkCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
+}
+#endif
+#if defined(VK_KHR_copy_memory_indirect)
+inline void DeviceTable::CmdCopyMemoryIndirectKHR(VkCommandBuffer commandBuffer,
+                                                  const VkCopyMemoryIndirectInfoKHR *pCopyMemoryIndirectInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMemoryIndirectKHR);
+    this->vkCmdCopyMemoryIndirectKHR(commandBuffer, pCopyMemoryIndirectInfo);
+}
+#endif
+#if defined(VK_NV_copy_memory_indirect)
+inline void DeviceTable::CmdCopyMemoryToImageIndirectNV(VkCommandBuffer commandBuffer,
+                                                        VkDeviceAddress copyBufferAddress, uint32_t copyCount,
+                                                        uint32_t stride, VkImage dstImage, VkImageLayout dstImageLayout,
+                                                        const VkImageSubresourceLayers *pImageSubresources) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMemoryToImageIndirectNV);
+    this->vkCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage,
+                                           dstImageLayout, pImageSubresources);
+}
+#endif
+#if defined(VK_KHR_copy_memory_indirect)
+inline void DeviceTable::CmdCopyMemoryToImageIndirectKHR(
+    VkCommandBuffer commandBuffer, const VkCopyMemoryToImageIndirectInfoKHR *pCopyMemoryToImageIndirectInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMemoryToImageIndirectKHR);
+    this->vkCmdCopyMemoryToImageIndirectKHR(commandBuffer, pCopyMemoryToImageIndirectInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                         VkDeviceSize dataSize, const void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdUpdateBuffer);
+    this->vkCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                       VkDeviceSize size, uint32_t data) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdFillBuffer);
+    this->vkCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout,
+                                            const VkClearColorValue *pColor, uint32_t rangeCount,
+                                            const VkImageSubresourceRange *pRanges) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdClearColorImage);
+    this->vkCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image,
+                                                   VkImageLayout imageLayout,
+                                                   const VkClearDepthStencilValue *pDepthStencil, uint32_t rangeCount,
+                                                   const VkImageSubresourceRange *pRanges) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdClearDepthStencilImage);
+    this->vkCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
+                                             const VkClearAttachment *pAttachments, uint32_t rectCount,
+                                             const VkClearRect *pRects) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdClearAttachments);
+    this->vkCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                         const VkImageResolve *pRegions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdResolveImage);
+    this->vkCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetEvent);
+    this->vkCmdSetEvent(commandBuffer, event, stageMask);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event,
+                                       VkPipelineStageFlags stageMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdResetEvent);
+    this->vkCmdResetEvent(commandBuffer, event, stageMask);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                                       VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                                       uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
+                                       uint32_t bufferMemoryBarrierCount,
+                                       const VkBufferMemoryBarrier *pBufferMemoryBarriers,
+                                       uint32_t imageMemoryBarrierCount,
+                                       const VkImageMemoryBarrier *pImageMemoryBarriers) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWaitEvents);
+    this->vkCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount,
+                          pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+                          pImageMemoryBarriers);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                            VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                            uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
+                                            uint32_t bufferMemoryBarrierCount,
+                                            const VkBufferMemoryBarrier *pBufferMemoryBarriers,
+                                            uint32_t imageMemoryBarrierCount,
+                                            const VkImageMemoryBarrier *pImageMemoryBarriers) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPipelineBarrier);
+    this->vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
+                               pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
+                               imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
+                                       VkQueryControlFlags flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginQuery);
+    this->vkCmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndQuery);
+    this->vkCmdEndQuery(commandBuffer, queryPool, query);
+}
+#endif
+#if defined(VK_EXT_conditional_rendering)
+inline void DeviceTable::CmdBeginConditionalRenderingEXT(
+    VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT *pConditionalRenderingBegin) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginConditionalRenderingEXT);
+    this->vkCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+}
+#endif
+#if defined(VK_EXT_conditional_rendering)
+inline void DeviceTable::CmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndConditionalRenderingEXT);
+    this->vkCmdEndConditionalRenderingEXT(commandBuffer);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
+                                           uint32_t queryCount) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdResetQueryPool);
+    this->vkCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
+                                           VkQueryPool queryPool, uint32_t query) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteTimestamp);
+    this->vkCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
+                                                 uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer,
+                                                 VkDeviceSize dstOffset, VkDeviceSize stride,
+                                                 VkQueryResultFlags flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyQueryPoolResults);
+    this->vkCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride,
+                                    flags);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
+                                          VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
+                                          const void *pValues) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushConstants);
+    this->vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdBeginRenderPass(VkCommandBuffer commandBuffer,
+                                            const VkRenderPassBeginInfo *pRenderPassBegin,
+                                            VkSubpassContents contents) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginRenderPass);
+    this->vkCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdNextSubpass);
+    this->vkCmdNextSubpass(commandBuffer, contents);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdEndRenderPass(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndRenderPass);
+    this->vkCmdEndRenderPass(commandBuffer);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_0)
+inline void DeviceTable::CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                            const VkCommandBuffer *pCommandBuffers) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdExecuteCommands);
+    this->vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+#endif
+#if defined(VK_KHR_display_swapchain)
+inline VkResult DeviceTable::CreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount,
+                                                       const VkSwapchainCreateInfoKHR *pCreateInfos,
+                                                       const VkAllocationCallbacks *pAllocator,
+                                                       VkSwapchainKHR *pSwapchains) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateSharedSwapchainsKHR);
+    return this->vkCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+#endif
+#if defined(VK_KHR_swapchain)
+inline VkResult DeviceTable::CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo,
+                                                const VkAllocationCallbacks *pAllocator,
+                                                VkSwapchainKHR *pSwapchain) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateSwapchainKHR);
+    return this->vkCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+}
+#endif
+#if defined(VK_KHR_swapchain)
+inline void DeviceTable::DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
+                                             const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroySwapchainKHR);
+    this->vkDestroySwapchainKHR(device, swapchain, pAllocator);
+}
+#endif
+#if defined(VK_KHR_swapchain)
+inline VkResult DeviceTable::GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain,
+                                                   uint32_t *pSwapchainImageCount, VkImage *pSwapchainImages) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSwapchainImagesKHR);
+    return this->vkGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+#endif
+#if defined(VK_KHR_swapchain)
+inline VkResult DeviceTable::AcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
+                                                 VkSemaphore semaphore, VkFence fence, uint32_t *pImageIndex) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAcquireNextImageKHR);
+    return this->vkAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+#endif
+#if defined(VK_KHR_swapchain)
+inline VkResult DeviceTable::QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueuePresentKHR);
+    return this->vkQueuePresentKHR(queue, pPresentInfo);
+}
+#endif
+#if defined(VK_EXT_debug_marker)
+inline VkResult DeviceTable::DebugMarkerSetObjectNameEXT(VkDevice device,
+                                                         const VkDebugMarkerObjectNameInfoEXT *pNameInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDebugMarkerSetObjectNameEXT);
+    return this->vkDebugMarkerSetObjectNameEXT(device, pNameInfo);
+}
+#endif
+#if defined(VK_EXT_debug_marker)
+inline VkResult DeviceTable::DebugMarkerSetObjectTagEXT(VkDevice device,
+                                                        const VkDebugMarkerObjectTagInfoEXT *pTagInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDebugMarkerSetObjectTagEXT);
+    return this->vkDebugMarkerSetObjectTagEXT(device, pTagInfo);
+}
+#endif
+#if defined(VK_EXT_debug_marker)
+inline void DeviceTable::CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
+                                                const VkDebugMarkerMarkerInfoEXT *pMarkerInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDebugMarkerBeginEXT);
+    this->vkCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+}
+#endif
+#if defined(VK_EXT_debug_marker)
+inline void DeviceTable::CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDebugMarkerEndEXT);
+    this->vkCmdDebugMarkerEndEXT(commandBuffer);
+}
+#endif
+#if defined(VK_EXT_debug_marker)
+inline void DeviceTable::CmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer,
+                                                 const VkDebugMarkerMarkerInfoEXT *pMarkerInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDebugMarkerInsertEXT);
+    this->vkCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+}
+#endif
+#if defined(VK_NV_external_memory_win32)
+inline VkResult DeviceTable::GetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory,
+                                                    VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryWin32HandleNV);
+    return this->vkGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
+}
+#endif
+#if defined(VK_NV_device_generated_commands)
+inline void DeviceTable::CmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed,
+                                                       const VkGeneratedCommandsInfoNV *pGeneratedCommandsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdExecuteGeneratedCommandsNV);
+    this->vkCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+}
+#endif
+#if defined(VK_NV_device_generated_commands)
+inline void DeviceTable::CmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer,
+                                                          const VkGeneratedCommandsInfoNV *pGeneratedCommandsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPreprocessGeneratedCommandsNV);
+    this->vkCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
+}
+#endif
+#if defined(VK_NV_device_generated_commands)
+inline void DeviceTable::CmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer,
+                                                      VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline,
+                                                      uint32_t groupIndex) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindPipelineShaderGroupNV);
+    this->vkCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+}
+#endif
+#if defined(VK_NV_device_generated_commands)
+inline void DeviceTable::GetGeneratedCommandsMemoryRequirementsNV(
+    VkDevice device, const VkGeneratedCommandsMemoryRequirementsInfoNV *pInfo,
+    VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetGeneratedCommandsMemoryRequirementsNV);
+    this->vkGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_NV_device_generated_commands)
+inline VkResult DeviceTable::CreateIndirectCommandsLayoutNV(VkDevice device,
+                                                            const VkIndirectCommandsLayoutCreateInfoNV *pCreateInfo,
+                                                            const VkAllocationCallbacks *pAllocator,
+                                                            VkIndirectCommandsLayoutNV *pIndirectCommandsLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateIndirectCommandsLayoutNV);
+    return this->vkCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+}
+#endif
+#if defined(VK_NV_device_generated_commands)
+inline void DeviceTable::DestroyIndirectCommandsLayoutNV(VkDevice device,
+                                                         VkIndirectCommandsLayoutNV indirectCommandsLayout,
+                                                         const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyIndirectCommandsLayoutNV);
+    this->vkDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline void DeviceTable::CmdExecuteGeneratedCommandsEXT(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed,
+                                                        const VkGeneratedCommandsInfoEXT *pGeneratedCommandsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdExecuteGeneratedCommandsEXT);
+    this->vkCmdExecuteGeneratedCommandsEXT(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline void DeviceTable::CmdPreprocessGeneratedCommandsEXT(VkCommandBuffer commandBuffer,
+                                                           const VkGeneratedCommandsInfoEXT *pGeneratedCommandsInfo,
+                                                           VkCommandBuffer stateCommandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPreprocessGeneratedCommandsEXT);
+    this->vkCmdPreprocessGeneratedCommandsEXT(commandBuffer, pGeneratedCommandsInfo, stateCommandBuffer);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline void DeviceTable::GetGeneratedCommandsMemoryRequirementsEXT(
+    VkDevice device, const VkGeneratedCommandsMemoryRequirementsInfoEXT *pInfo,
+    VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetGeneratedCommandsMemoryRequirementsEXT);
+    this->vkGetGeneratedCommandsMemoryRequirementsEXT(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline VkResult DeviceTable::CreateIndirectCommandsLayoutEXT(VkDevice device,
+                                                             const VkIndirectCommandsLayoutCreateInfoEXT *pCreateInfo,
+                                                             const VkAllocationCallbacks *pAllocator,
+                                                             VkIndirectCommandsLayoutEXT *pIndirectCommandsLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateIndirectCommandsLayoutEXT);
+    return this->vkCreateIndirectCommandsLayoutEXT(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline void DeviceTable::DestroyIndirectCommandsLayoutEXT(VkDevice device,
+                                                          VkIndirectCommandsLayoutEXT indirectCommandsLayout,
+                                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyIndirectCommandsLayoutEXT);
+    this->vkDestroyIndirectCommandsLayoutEXT(device, indirectCommandsLayout, pAllocator);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline VkResult DeviceTable::CreateIndirectExecutionSetEXT(VkDevice device,
+                                                           const VkIndirectExecutionSetCreateInfoEXT *pCreateInfo,
+                                                           const VkAllocationCallbacks *pAllocator,
+                                                           VkIndirectExecutionSetEXT *pIndirectExecutionSet) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateIndirectExecutionSetEXT);
+    return this->vkCreateIndirectExecutionSetEXT(device, pCreateInfo, pAllocator, pIndirectExecutionSet);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline void DeviceTable::DestroyIndirectExecutionSetEXT(VkDevice device, VkIndirectExecutionSetEXT indirectExecutionSet,
+                                                        const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyIndirectExecutionSetEXT);
+    this->vkDestroyIndirectExecutionSetEXT(device, indirectExecutionSet, pAllocator);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline void DeviceTable::UpdateIndirectExecutionSetPipelineEXT(
+    VkDevice device, VkIndirectExecutionSetEXT indirectExecutionSet, uint32_t executionSetWriteCount,
+    const VkWriteIndirectExecutionSetPipelineEXT *pExecutionSetWrites) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUpdateIndirectExecutionSetPipelineEXT);
+    this->vkUpdateIndirectExecutionSetPipelineEXT(device, indirectExecutionSet, executionSetWriteCount,
+                                                  pExecutionSetWrites);
+}
+#endif
+#if defined(VK_EXT_device_generated_commands)
+inline void DeviceTable::UpdateIndirectExecutionSetShaderEXT(
+    VkDevice device, VkIndirectExecutionSetEXT indirectExecutionSet, uint32_t executionSetWriteCount,
+    const VkWriteIndirectExecutionSetShaderEXT *pExecutionSetWrites) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUpdateIndirectExecutionSetShaderEXT);
+    this->vkUpdateIndirectExecutionSetShaderEXT(device, indirectExecutionSet, executionSetWriteCount,
+                                                pExecutionSetWrites);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdPushDescriptorSet(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                              VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount,
+                                              const VkWriteDescriptorSet *pDescriptorWrites) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSet);
+    this->vkCmdPushDescriptorSet(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
+                                 pDescriptorWrites);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::TrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkTrimCommandPool);
+    this->vkTrimCommandPool(device, commandPool, flags);
+}
+#endif
+#if defined(VK_KHR_external_memory_win32)
+inline VkResult DeviceTable::GetMemoryWin32HandleKHR(VkDevice device,
+                                                     const VkMemoryGetWin32HandleInfoKHR *pGetWin32HandleInfo,
+                                                     HANDLE *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryWin32HandleKHR);
+    return this->vkGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+#endif
+#if defined(VK_KHR_external_memory_win32)
+inline VkResult DeviceTable::GetMemoryWin32HandlePropertiesKHR(
+    VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, HANDLE handle,
+    VkMemoryWin32HandlePropertiesKHR *pMemoryWin32HandleProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryWin32HandlePropertiesKHR);
+    return this->vkGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
+}
+#endif
+#if defined(VK_KHR_external_memory_fd)
+inline VkResult DeviceTable::GetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR *pGetFdInfo, int *pFd) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryFdKHR);
+    return this->vkGetMemoryFdKHR(device, pGetFdInfo, pFd);
+}
+#endif
+#if defined(VK_KHR_external_memory_fd)
+inline VkResult DeviceTable::GetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType,
+                                                      int fd, VkMemoryFdPropertiesKHR *pMemoryFdProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryFdPropertiesKHR);
+    return this->vkGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+}
+#endif
+#if defined(VK_FUCHSIA_external_memory)
+inline VkResult DeviceTable::GetMemoryZirconHandleFUCHSIA(
+    VkDevice device, const VkMemoryGetZirconHandleInfoFUCHSIA *pGetZirconHandleInfo, zx_handle_t *pZirconHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryZirconHandleFUCHSIA);
+    return this->vkGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+}
+#endif
+#if defined(VK_FUCHSIA_external_memory)
+inline VkResult DeviceTable::GetMemoryZirconHandlePropertiesFUCHSIA(
+    VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, zx_handle_t zirconHandle,
+    VkMemoryZirconHandlePropertiesFUCHSIA *pMemoryZirconHandleProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryZirconHandlePropertiesFUCHSIA);
+    return this->vkGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle,
+                                                          pMemoryZirconHandleProperties);
+}
+#endif
+#if defined(VK_NV_external_memory_rdma)
+inline VkResult DeviceTable::GetMemoryRemoteAddressNV(VkDevice device,
+                                                      const VkMemoryGetRemoteAddressInfoNV *pMemoryGetRemoteAddressInfo,
+                                                      VkRemoteAddressNV *pAddress) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryRemoteAddressNV);
+    return this->vkGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
+}
+#endif
+#if defined(VK_NV_external_memory_sci_buf)
+inline VkResult DeviceTable::GetMemorySciBufNV(VkDevice device, const VkMemoryGetSciBufInfoNV *pGetSciBufInfo,
+                                               NvSciBufObj *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemorySciBufNV);
+    return this->vkGetMemorySciBufNV(device, pGetSciBufInfo, pHandle);
+}
+#endif
+#if defined(VK_KHR_external_semaphore_win32)
+inline VkResult DeviceTable::GetSemaphoreWin32HandleKHR(VkDevice device,
+                                                        const VkSemaphoreGetWin32HandleInfoKHR *pGetWin32HandleInfo,
+                                                        HANDLE *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSemaphoreWin32HandleKHR);
+    return this->vkGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+#endif
+#if defined(VK_KHR_external_semaphore_win32)
+inline VkResult DeviceTable::ImportSemaphoreWin32HandleKHR(
+    VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR *pImportSemaphoreWin32HandleInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportSemaphoreWin32HandleKHR);
+    return this->vkImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
+}
+#endif
+#if defined(VK_KHR_external_semaphore_fd)
+inline VkResult DeviceTable::GetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR *pGetFdInfo,
+                                               int *pFd) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSemaphoreFdKHR);
+    return this->vkGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
+}
+#endif
+#if defined(VK_KHR_external_semaphore_fd)
+inline VkResult DeviceTable::ImportSemaphoreFdKHR(VkDevice device,
+                                                  const VkImportSemaphoreFdInfoKHR *pImportSemaphoreFdInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportSemaphoreFdKHR);
+    return this->vkImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+}
+#endif
+#if defined(VK_FUCHSIA_external_semaphore)
+inline VkResult DeviceTable::GetSemaphoreZirconHandleFUCHSIA(
+    VkDevice device, const VkSemaphoreGetZirconHandleInfoFUCHSIA *pGetZirconHandleInfo,
+    zx_handle_t *pZirconHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSemaphoreZirconHandleFUCHSIA);
+    return this->vkGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+}
+#endif
+#if defined(VK_FUCHSIA_external_semaphore)
+inline VkResult DeviceTable::ImportSemaphoreZirconHandleFUCHSIA(
+    VkDevice device, const VkImportSemaphoreZirconHandleInfoFUCHSIA *pImportSemaphoreZirconHandleInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportSemaphoreZirconHandleFUCHSIA);
+    return this->vkImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
+}
+#endif
+#if defined(VK_KHR_external_fence_win32)
+inline VkResult DeviceTable::GetFenceWin32HandleKHR(VkDevice device,
+                                                    const VkFenceGetWin32HandleInfoKHR *pGetWin32HandleInfo,
+                                                    HANDLE *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetFenceWin32HandleKHR);
+    return this->vkGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+#endif
+#if defined(VK_KHR_external_fence_win32)
+inline VkResult DeviceTable::ImportFenceWin32HandleKHR(
+    VkDevice device, const VkImportFenceWin32HandleInfoKHR *pImportFenceWin32HandleInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportFenceWin32HandleKHR);
+    return this->vkImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
+}
+#endif
+#if defined(VK_KHR_external_fence_fd)
+inline VkResult DeviceTable::GetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR *pGetFdInfo, int *pFd) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetFenceFdKHR);
+    return this->vkGetFenceFdKHR(device, pGetFdInfo, pFd);
+}
+#endif
+#if defined(VK_KHR_external_fence_fd)
+inline VkResult DeviceTable::ImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR *pImportFenceFdInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportFenceFdKHR);
+    return this->vkImportFenceFdKHR(device, pImportFenceFdInfo);
+}
+#endif
+#if defined(VK_NV_external_sci_sync) || defined(VK_NV_external_sci_sync2)
+inline VkResult DeviceTable::GetFenceSciSyncFenceNV(VkDevice device,
+                                                    const VkFenceGetSciSyncInfoNV *pGetSciSyncHandleInfo,
+                                                    void *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetFenceSciSyncFenceNV);
+    return this->vkGetFenceSciSyncFenceNV(device, pGetSciSyncHandleInfo, pHandle);
+}
+#endif
+#if defined(VK_NV_external_sci_sync) || defined(VK_NV_external_sci_sync2)
+inline VkResult DeviceTable::GetFenceSciSyncObjNV(VkDevice device, const VkFenceGetSciSyncInfoNV *pGetSciSyncHandleInfo,
+                                                  void *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetFenceSciSyncObjNV);
+    return this->vkGetFenceSciSyncObjNV(device, pGetSciSyncHandleInfo, pHandle);
+}
+#endif
+#if defined(VK_NV_external_sci_sync) || defined(VK_NV_external_sci_sync2)
+inline VkResult DeviceTable::ImportFenceSciSyncFenceNV(VkDevice device,
+                                                       const VkImportFenceSciSyncInfoNV *pImportFenceSciSyncInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportFenceSciSyncFenceNV);
+    return this->vkImportFenceSciSyncFenceNV(device, pImportFenceSciSyncInfo);
+}
+#endif
+#if defined(VK_NV_external_sci_sync) || defined(VK_NV_external_sci_sync2)
+inline VkResult DeviceTable::ImportFenceSciSyncObjNV(VkDevice device,
+                                                     const VkImportFenceSciSyncInfoNV *pImportFenceSciSyncInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportFenceSciSyncObjNV);
+    return this->vkImportFenceSciSyncObjNV(device, pImportFenceSciSyncInfo);
+}
+#endif
+#if defined(VK_NV_external_sci_sync)
+inline VkResult DeviceTable::GetSemaphoreSciSyncObjNV(VkDevice device,
+                                                      const VkSemaphoreGetSciSyncInfoNV *pGetSciSyncInfo,
+                                                      void *pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSemaphoreSciSyncObjNV);
+    return this->vkGetSemaphoreSciSyncObjNV(device, pGetSciSyncInfo, pHandle);
+}
+#endif
+#if defined(VK_NV_external_sci_sync)
+inline VkResult DeviceTable::ImportSemaphoreSciSyncObjNV(
+    VkDevice device, const VkImportSemaphoreSciSyncInfoNV *pImportSemaphoreSciSyncInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkImportSemaphoreSciSyncObjNV);
+    return this->vkImportSemaphoreSciSyncObjNV(device, pImportSemaphoreSciSyncInfo);
+}
+#endif
+#if defined(VK_NV_external_sci_sync2)
+inline VkResult DeviceTable::CreateSemaphoreSciSyncPoolNV(VkDevice device,
+                                                          const VkSemaphoreSciSyncPoolCreateInfoNV *pCreateInfo,
+                                                          const VkAllocationCallbacks *pAllocator,
+                                                          VkSemaphoreSciSyncPoolNV *pSemaphorePool) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateSemaphoreSciSyncPoolNV);
+    return this->vkCreateSemaphoreSciSyncPoolNV(device, pCreateInfo, pAllocator, pSemaphorePool);
+}
+#endif
+#if defined(VK_NV_external_sci_sync2)
+inline void DeviceTable::DestroySemaphoreSciSyncPoolNV(VkDevice device, VkSemaphoreSciSyncPoolNV semaphorePool,
+                                                       const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroySemaphoreSciSyncPoolNV);
+    this->vkDestroySemaphoreSciSyncPoolNV(device, semaphorePool, pAllocator);
+}
+#endif
+#if defined(VK_EXT_display_control)
+inline VkResult DeviceTable::DisplayPowerControlEXT(VkDevice device, VkDisplayKHR display,
+                                                    const VkDisplayPowerInfoEXT *pDisplayPowerInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDisplayPowerControlEXT);
+    return this->vkDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
+}
+#endif
+#if defined(VK_EXT_display_control)
+inline VkResult DeviceTable::RegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT *pDeviceEventInfo,
+                                                    const VkAllocationCallbacks *pAllocator, VkFence *pFence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkRegisterDeviceEventEXT);
+    return this->vkRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
+}
+#endif
+#if defined(VK_EXT_display_control)
+inline VkResult DeviceTable::RegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display,
+                                                     const VkDisplayEventInfoEXT *pDisplayEventInfo,
+                                                     const VkAllocationCallbacks *pAllocator, VkFence *pFence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkRegisterDisplayEventEXT);
+    return this->vkRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
+}
+#endif
+#if defined(VK_EXT_display_control)
+inline VkResult DeviceTable::GetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain,
+                                                    VkSurfaceCounterFlagBitsEXT counter, uint64_t *pCounterValue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSwapchainCounterEXT);
+    return this->vkGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::GetDeviceGroupPeerMemoryFeatures(VkDevice device, uint32_t heapIndex,
+                                                          uint32_t localDeviceIndex, uint32_t remoteDeviceIndex,
+                                                          VkPeerMemoryFeatureFlags *pPeerMemoryFeatures) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceGroupPeerMemoryFeatures);
+    this->vkGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex,
+                                             pPeerMemoryFeatures);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline VkResult DeviceTable::BindBufferMemory2(VkDevice device, uint32_t bindInfoCount,
+                                               const VkBindBufferMemoryInfo *pBindInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindBufferMemory2);
+    return this->vkBindBufferMemory2(device, bindInfoCount, pBindInfos);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline VkResult DeviceTable::BindImageMemory2(VkDevice device, uint32_t bindInfoCount,
+                                              const VkBindImageMemoryInfo *pBindInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindImageMemory2);
+    return this->vkBindImageMemory2(device, bindInfoCount, pBindInfos);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDeviceMask);
+    this->vkCmdSetDeviceMask(commandBuffer, deviceMask);
+}
+#endif
+#if (defined(VK_KHR_swapchain) && defined(VKIT_API_VERSION_1_1)) ||                                                    \
+    (defined(VK_KHR_device_group) && defined(VK_KHR_surface))
+inline VkResult DeviceTable::GetDeviceGroupPresentCapabilitiesKHR(
+    VkDevice device, VkDeviceGroupPresentCapabilitiesKHR *pDeviceGroupPresentCapabilities) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceGroupPresentCapabilitiesKHR);
+    return this->vkGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+}
+#endif
+#if (defined(VK_KHR_swapchain) && defined(VKIT_API_VERSION_1_1)) ||                                                    \
+    (defined(VK_KHR_device_group) && defined(VK_KHR_surface))
+inline VkResult DeviceTable::GetDeviceGroupSurfacePresentModesKHR(VkDevice device, VkSurfaceKHR surface,
+                                                                  VkDeviceGroupPresentModeFlagsKHR *pModes) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceGroupSurfacePresentModesKHR);
+    return this->vkGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+}
+#endif
+#if (defined(VK_KHR_swapchain) && defined(VKIT_API_VERSION_1_1)) ||                                                    \
+    (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain))
+inline VkResult DeviceTable::AcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR *pAcquireInfo,
+                                                  uint32_t *pImageIndex) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAcquireNextImage2KHR);
+    return this->vkAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::CmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
+                                         uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
+                                         uint32_t groupCountZ) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchBase);
+    this->vkCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline VkResult DeviceTable::CreateDescriptorUpdateTemplate(VkDevice device,
+                                                            const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                                                            const VkAllocationCallbacks *pAllocator,
+                                                            VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateDescriptorUpdateTemplate);
+    return this->vkCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::DestroyDescriptorUpdateTemplate(VkDevice device,
+                                                         VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                         const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyDescriptorUpdateTemplate);
+    this->vkDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::UpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
+                                                         VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                         const void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUpdateDescriptorSetWithTemplate);
+    this->vkUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdPushDescriptorSetWithTemplate(VkCommandBuffer commandBuffer,
+                                                          VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                          VkPipelineLayout layout, uint32_t set,
+                                                          const void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSetWithTemplate);
+    this->vkCmdPushDescriptorSetWithTemplate(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+}
+#endif
+#if defined(VK_EXT_hdr_metadata)
+inline void DeviceTable::SetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR *pSwapchains,
+                                           const VkHdrMetadataEXT *pMetadata) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetHdrMetadataEXT);
+    this->vkSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+}
+#endif
+#if defined(VK_KHR_shared_presentable_image)
+inline VkResult DeviceTable::GetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSwapchainStatusKHR);
+    return this->vkGetSwapchainStatusKHR(device, swapchain);
+}
+#endif
+#if defined(VK_GOOGLE_display_timing)
+inline VkResult DeviceTable::GetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain,
+                                                           VkRefreshCycleDurationGOOGLE *pDisplayTimingProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRefreshCycleDurationGOOGLE);
+    return this->vkGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
+}
+#endif
+#if defined(VK_GOOGLE_display_timing)
+inline VkResult DeviceTable::GetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain,
+                                                             uint32_t *pPresentationTimingCount,
+                                                             VkPastPresentationTimingGOOGLE *pPresentationTimings) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPastPresentationTimingGOOGLE);
+    return this->vkGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+}
+#endif
+#if defined(VK_NV_clip_space_w_scaling)
+inline void DeviceTable::CmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport,
+                                                  uint32_t viewportCount,
+                                                  const VkViewportWScalingNV *pViewportWScalings) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetViewportWScalingNV);
+    this->vkCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+}
+#endif
+#if defined(VK_EXT_discard_rectangles)
+inline void DeviceTable::CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle,
+                                                   uint32_t discardRectangleCount,
+                                                   const VkRect2D *pDiscardRectangles) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDiscardRectangleEXT);
+    this->vkCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+}
+#endif
+#if VK_HEADER_VERSION >= 241 && ((defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2))
+inline void DeviceTable::CmdSetDiscardRectangleEnableEXT(VkCommandBuffer commandBuffer,
+                                                         VkBool32 discardRectangleEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDiscardRectangleEnableEXT);
+    this->vkCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable);
+}
+#endif
+#if VK_HEADER_VERSION >= 241 && ((defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2 && \
+                                  VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2))
+inline void DeviceTable::CmdSetDiscardRectangleModeEXT(VkCommandBuffer commandBuffer,
+                                                       VkDiscardRectangleModeEXT discardRectangleMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDiscardRectangleModeEXT);
+    this->vkCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode);
+}
+#endif
+#if defined(VK_EXT_sample_locations)
+inline void DeviceTable::CmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer,
+                                                  const VkSampleLocationsInfoEXT *pSampleLocationsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetSampleLocationsEXT);
+    this->vkCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::GetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2 *pInfo,
+                                                      VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferMemoryRequirements2);
+    this->vkGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::GetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo,
+                                                     VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageMemoryRequirements2);
+    this->vkGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::GetImageSparseMemoryRequirements2(
+    VkDevice device, const VkImageSparseMemoryRequirementsInfo2 *pInfo, uint32_t *pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2 *pSparseMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageSparseMemoryRequirements2);
+    this->vkGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::GetDeviceBufferMemoryRequirements(VkDevice device,
+                                                           const VkDeviceBufferMemoryRequirements *pInfo,
+                                                           VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceBufferMemoryRequirements);
+    this->vkGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::GetDeviceImageMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements *pInfo,
+                                                          VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceImageMemoryRequirements);
+    this->vkGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::GetDeviceImageSparseMemoryRequirements(
+    VkDevice device, const VkDeviceImageMemoryRequirements *pInfo, uint32_t *pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2 *pSparseMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceImageSparseMemoryRequirements);
+    this->vkGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount,
+                                                   pSparseMemoryRequirements);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline VkResult DeviceTable::CreateSamplerYcbcrConversion(VkDevice device,
+                                                          const VkSamplerYcbcrConversionCreateInfo *pCreateInfo,
+                                                          const VkAllocationCallbacks *pAllocator,
+                                                          VkSamplerYcbcrConversion *pYcbcrConversion) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateSamplerYcbcrConversion);
+    return this->vkCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::DestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
+                                                       const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroySamplerYcbcrConversion);
+    this->vkDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::GetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceQueue2);
+    this->vkGetDeviceQueue2(device, pQueueInfo, pQueue);
+}
+#endif
+#if defined(VK_EXT_validation_cache)
+inline VkResult DeviceTable::CreateValidationCacheEXT(VkDevice device,
+                                                      const VkValidationCacheCreateInfoEXT *pCreateInfo,
+                                                      const VkAllocationCallbacks *pAllocator,
+                                                      VkValidationCacheEXT *pValidationCache) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateValidationCacheEXT);
+    return this->vkCreateValidationCacheEXT(device, pCreateInfo, pAllocator, pValidationCache);
+}
+#endif
+#if defined(VK_EXT_validation_cache)
+inline void DeviceTable::DestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache,
+                                                   const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyValidationCacheEXT);
+    this->vkDestroyValidationCacheEXT(device, validationCache, pAllocator);
+}
+#endif
+#if defined(VK_EXT_validation_cache)
+inline VkResult DeviceTable::GetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache,
+                                                       size_t *pDataSize, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetValidationCacheDataEXT);
+    return this->vkGetValidationCacheDataEXT(device, validationCache, pDataSize, pData);
+}
+#endif
+#if defined(VK_EXT_validation_cache)
+inline VkResult DeviceTable::MergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache,
+                                                      uint32_t srcCacheCount,
+                                                      const VkValidationCacheEXT *pSrcCaches) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkMergeValidationCachesEXT);
+    return this->vkMergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_1)
+inline void DeviceTable::GetDescriptorSetLayoutSupport(VkDevice device,
+                                                       const VkDescriptorSetLayoutCreateInfo *pCreateInfo,
+                                                       VkDescriptorSetLayoutSupport *pSupport) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDescriptorSetLayoutSupport);
+    this->vkGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+}
+#endif
+#if defined(VK_ANDROID_native_buffer)
+inline VkResult DeviceTable::GetSwapchainGrallocUsageANDROID(VkDevice device, VkFormat format,
+                                                             VkImageUsageFlags imageUsage, int *grallocUsage) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSwapchainGrallocUsageANDROID);
+    return this->vkGetSwapchainGrallocUsageANDROID(device, format, imageUsage, grallocUsage);
+}
+#endif
+#if defined(VK_ANDROID_native_buffer)
+inline VkResult DeviceTable::GetSwapchainGrallocUsage2ANDROID(VkDevice device, VkFormat format,
+                                                              VkImageUsageFlags imageUsage,
+                                                              VkSwapchainImageUsageFlagsANDROID swapchainImageUsage,
+                                                              uint64_t *grallocConsumerUsage,
+                                                              uint64_t *grallocProducerUsage) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSwapchainGrallocUsage2ANDROID);
+    return this->vkGetSwapchainGrallocUsage2ANDROID(device, format, imageUsage, swapchainImageUsage,
+                                                    grallocConsumerUsage, grallocProducerUsage);
+}
+#endif
+#if defined(VK_ANDROID_native_buffer)
+inline VkResult DeviceTable::AcquireImageANDROID(VkDevice device, VkImage image, int nativeFenceFd,
+                                                 VkSemaphore semaphore, VkFence fence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAcquireImageANDROID);
+    return this->vkAcquireImageANDROID(device, image, nativeFenceFd, semaphore, fence);
+}
+#endif
+#if defined(VK_ANDROID_native_buffer)
+inline VkResult DeviceTable::QueueSignalReleaseImageANDROID(VkQueue queue, uint32_t waitSemaphoreCount,
+                                                            const VkSemaphore *pWaitSemaphores, VkImage image,
+                                                            int *pNativeFenceFd) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueSignalReleaseImageANDROID);
+    return this->vkQueueSignalReleaseImageANDROID(queue, waitSemaphoreCount, pWaitSemaphores, image, pNativeFenceFd);
+}
+#endif
+#if defined(VK_AMD_shader_info)
+inline VkResult DeviceTable::GetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage,
+                                              VkShaderInfoTypeAMD infoType, size_t *pInfoSize, void *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetShaderInfoAMD);
+    return this->vkGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+}
+#endif
+#if defined(VK_AMD_display_native_hdr)
+inline void DeviceTable::SetLocalDimmingAMD(VkDevice device, VkSwapchainKHR swapChain,
+                                            VkBool32 localDimmingEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetLocalDimmingAMD);
+    this->vkSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
+}
+#endif
+#if defined(VK_KHR_calibrated_timestamps)
+inline VkResult DeviceTable::GetCalibratedTimestampsKHR(VkDevice device, uint32_t timestampCount,
+                                                        const VkCalibratedTimestampInfoKHR *pTimestampInfos,
+                                                        uint64_t *pTimestamps, uint64_t *pMaxDeviation) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetCalibratedTimestampsKHR);
+    return this->vkGetCalibratedTimestampsKHR(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline VkResult DeviceTable::SetDebugUtilsObjectNameEXT(VkDevice device,
+                                                        const VkDebugUtilsObjectNameInfoEXT *pNameInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetDebugUtilsObjectNameEXT);
+    return this->vkSetDebugUtilsObjectNameEXT(device, pNameInfo);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline VkResult DeviceTable::SetDebugUtilsObjectTagEXT(VkDevice device,
+                                                       const VkDebugUtilsObjectTagInfoEXT *pTagInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetDebugUtilsObjectTagEXT);
+    return this->vkSetDebugUtilsObjectTagEXT(device, pTagInfo);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline void DeviceTable::QueueBeginDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT *pLabelInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueBeginDebugUtilsLabelEXT);
+    this->vkQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline void DeviceTable::QueueEndDebugUtilsLabelEXT(VkQueue queue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueEndDebugUtilsLabelEXT);
+    this->vkQueueEndDebugUtilsLabelEXT(queue);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline void DeviceTable::QueueInsertDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT *pLabelInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueInsertDebugUtilsLabelEXT);
+    this->vkQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline void DeviceTable::CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
+                                                    const VkDebugUtilsLabelEXT *pLabelInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginDebugUtilsLabelEXT);
+    this->vkCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline void DeviceTable::CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndDebugUtilsLabelEXT);
+    this->vkCmdEndDebugUtilsLabelEXT(commandBuffer);
+}
+#endif
+#if defined(VK_EXT_debug_utils)
+inline void DeviceTable::CmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
+                                                     const VkDebugUtilsLabelEXT *pLabelInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdInsertDebugUtilsLabelEXT);
+    this->vkCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+#endif
+#if defined(VK_EXT_external_memory_host)
+inline VkResult DeviceTable::GetMemoryHostPointerPropertiesEXT(
+    VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void *pHostPointer,
+    VkMemoryHostPointerPropertiesEXT *pMemoryHostPointerProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryHostPointerPropertiesEXT);
+    return this->vkGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+}
+#endif
+#if defined(VK_AMD_buffer_marker)
+inline void DeviceTable::CmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
+                                                 VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteBufferMarkerAMD);
+    this->vkCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline VkResult DeviceTable::CreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
+                                               const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateRenderPass2);
+    return this->vkCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline void DeviceTable::CmdBeginRenderPass2(VkCommandBuffer commandBuffer,
+                                             const VkRenderPassBeginInfo *pRenderPassBegin,
+                                             const VkSubpassBeginInfo *pSubpassBeginInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginRenderPass2);
+    this->vkCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline void DeviceTable::CmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo,
+                                         const VkSubpassEndInfo *pSubpassEndInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdNextSubpass2);
+    this->vkCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline void DeviceTable::CmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndRenderPass2);
+    this->vkCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline VkResult DeviceTable::GetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSemaphoreCounterValue);
+    return this->vkGetSemaphoreCounterValue(device, semaphore, pValue);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline VkResult DeviceTable::WaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo,
+                                            uint64_t timeout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkWaitSemaphores);
+    return this->vkWaitSemaphores(device, pWaitInfo, timeout);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline VkResult DeviceTable::SignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo *pSignalInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSignalSemaphore);
+    return this->vkSignalSemaphore(device, pSignalInfo);
+}
+#endif
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+inline VkResult DeviceTable::GetAndroidHardwareBufferPropertiesANDROID(
+    VkDevice device, const struct AHardwareBuffer *buffer, VkAndroidHardwareBufferPropertiesANDROID *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetAndroidHardwareBufferPropertiesANDROID);
+    return this->vkGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
+}
+#endif
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+inline VkResult DeviceTable::GetMemoryAndroidHardwareBufferANDROID(
+    VkDevice device, const VkMemoryGetAndroidHardwareBufferInfoANDROID *pInfo, struct AHardwareBuffer **pBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryAndroidHardwareBufferANDROID);
+    return this->vkGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline void DeviceTable::CmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                              VkBuffer countBuffer, VkDeviceSize countBufferOffset,
+                                              uint32_t maxDrawCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndirectCount);
+    this->vkCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline void DeviceTable::CmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                     VkDeviceSize offset, VkBuffer countBuffer,
+                                                     VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
+                                                     uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndexedIndirectCount);
+    this->vkCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                        stride);
+}
+#endif
+#if defined(VK_NV_device_diagnostic_checkpoints)
+inline void DeviceTable::CmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void *pCheckpointMarker) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCheckpointNV);
+    this->vkCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
+}
+#endif
+#if defined(VK_NV_device_diagnostic_checkpoints)
+inline void DeviceTable::GetQueueCheckpointDataNV(VkQueue queue, uint32_t *pCheckpointDataCount,
+                                                  VkCheckpointDataNV *pCheckpointData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetQueueCheckpointDataNV);
+    this->vkGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
+}
+#endif
+#if defined(VK_EXT_transform_feedback)
+inline void DeviceTable::CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding,
+                                                            uint32_t bindingCount, const VkBuffer *pBuffers,
+                                                            const VkDeviceSize *pOffsets,
+                                                            const VkDeviceSize *pSizes) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindTransformFeedbackBuffersEXT);
+    this->vkCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+}
+#endif
+#if defined(VK_EXT_transform_feedback)
+inline void DeviceTable::CmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer,
+                                                      uint32_t counterBufferCount, const VkBuffer *pCounterBuffers,
+                                                      const VkDeviceSize *pCounterBufferOffsets) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginTransformFeedbackEXT);
+    this->vkCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers,
+                                         pCounterBufferOffsets);
+}
+#endif
+#if defined(VK_EXT_transform_feedback)
+inline void DeviceTable::CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer,
+                                                    uint32_t counterBufferCount, const VkBuffer *pCounterBuffers,
+                                                    const VkDeviceSize *pCounterBufferOffsets) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndTransformFeedbackEXT);
+    this->vkCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers,
+                                       pCounterBufferOffsets);
+}
+#endif
+#if defined(VK_EXT_transform_feedback)
+inline void DeviceTable::CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
+                                                 VkQueryControlFlags flags, uint32_t index) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginQueryIndexedEXT);
+    this->vkCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
+}
+#endif
+#if defined(VK_EXT_transform_feedback)
+inline void DeviceTable::CmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
+                                               uint32_t index) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndQueryIndexedEXT);
+    this->vkCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
+}
+#endif
+#if defined(VK_EXT_transform_feedback)
+inline void DeviceTable::CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_t instanceCount,
+                                                     uint32_t firstInstance, VkBuffer counterBuffer,
+                                                     VkDeviceSize counterBufferOffset, uint32_t counterOffset,
+                                                     uint32_t vertexStride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndirectByteCountEXT);
+    this->vkCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset,
+                                        counterOffset, vertexStride);
+}
+#endif
+#if (defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2)
+inline void DeviceTable::CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor,
+                                                  uint32_t exclusiveScissorCount,
+                                                  const VkRect2D *pExclusiveScissors) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetExclusiveScissorNV);
+    this->vkCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+}
+#endif
+#if VK_HEADER_VERSION >= 241 && ((defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2))
+inline void DeviceTable::CmdSetExclusiveScissorEnableNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor,
+                                                        uint32_t exclusiveScissorCount,
+                                                        const VkBool32 *pExclusiveScissorEnables) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetExclusiveScissorEnableNV);
+    this->vkCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                           pExclusiveScissorEnables);
+}
+#endif
+#if defined(VK_NV_shading_rate_image)
+inline void DeviceTable::CmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView,
+                                                   VkImageLayout imageLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindShadingRateImageNV);
+    this->vkCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
+}
+#endif
+#if defined(VK_NV_shading_rate_image)
+inline void DeviceTable::CmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport,
+                                                            uint32_t viewportCount,
+                                                            const VkShadingRatePaletteNV *pShadingRatePalettes) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetViewportShadingRatePaletteNV);
+    this->vkCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+}
+#endif
+#if defined(VK_NV_shading_rate_image)
+inline void DeviceTable::CmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer,
+                                                   VkCoarseSampleOrderTypeNV sampleOrderType,
+                                                   uint32_t customSampleOrderCount,
+                                                   const VkCoarseSampleOrderCustomNV *pCustomSampleOrders) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCoarseSampleOrderNV);
+    this->vkCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+}
+#endif
+#if defined(VK_NV_mesh_shader)
+inline void DeviceTable::CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMeshTasksNV);
+    this->vkCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
+}
+#endif
+#if defined(VK_NV_mesh_shader)
+inline void DeviceTable::CmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                    uint32_t drawCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMeshTasksIndirectNV);
+    this->vkCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
+}
+#endif
+#if (defined(VK_NV_mesh_shader) &&                                                                                     \
+     (defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)))
+inline void DeviceTable::CmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                         VkDeviceSize offset, VkBuffer countBuffer,
+                                                         VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
+                                                         uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMeshTasksIndirectCountNV);
+    this->vkCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                            stride);
+}
+#endif
+#if defined(VK_EXT_mesh_shader)
+inline void DeviceTable::CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                             uint32_t groupCountZ) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMeshTasksEXT);
+    this->vkCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+#endif
+#if defined(VK_EXT_mesh_shader)
+inline void DeviceTable::CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                     VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMeshTasksIndirectEXT);
+    this->vkCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
+}
+#endif
+#if (defined(VK_EXT_mesh_shader) &&                                                                                    \
+     (defined(VKIT_API_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)))
+inline void DeviceTable::CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                          VkDeviceSize offset, VkBuffer countBuffer,
+                                                          VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
+                                                          uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawMeshTasksIndirectCountEXT);
+    this->vkCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                             maxDrawCount, stride);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline VkResult DeviceTable::CompileDeferredNV(VkDevice device, VkPipeline pipeline, uint32_t shader) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCompileDeferredNV);
+    return this->vkCompileDeferredNV(device, pipeline, shader);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline VkResult DeviceTable::CreateAccelerationStructureNV(VkDevice device,
+                                                           const VkAccelerationStructureCreateInfoNV *pCreateInfo,
+                                                           const VkAllocationCallbacks *pAllocator,
+                                                           VkAccelerationStructureNV *pAccelerationStructure) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateAccelerationStructureNV);
+    return this->vkCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+#endif
+#if defined(VK_HUAWEI_invocation_mask)
+inline void DeviceTable::CmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView,
+                                                     VkImageLayout imageLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindInvocationMaskHUAWEI);
+    this->vkCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::DestroyAccelerationStructureKHR(VkDevice device,
+                                                         VkAccelerationStructureKHR accelerationStructure,
+                                                         const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyAccelerationStructureKHR);
+    this->vkDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline void DeviceTable::DestroyAccelerationStructureNV(VkDevice device,
+                                                        VkAccelerationStructureNV accelerationStructure,
+                                                        const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyAccelerationStructureNV);
+    this->vkDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline void DeviceTable::GetAccelerationStructureMemoryRequirementsNV(
+    VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV *pInfo,
+    VkMemoryRequirements2KHR *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetAccelerationStructureMemoryRequirementsNV);
+    this->vkGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline VkResult DeviceTable::BindAccelerationStructureMemoryNV(
+    VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV *pBindInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindAccelerationStructureMemoryNV);
+    return this->vkBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline void DeviceTable::CmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst,
+                                                        VkAccelerationStructureNV src,
+                                                        VkCopyAccelerationStructureModeKHR mode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyAccelerationStructureNV);
+    this->vkCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::CmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer,
+                                                         const VkCopyAccelerationStructureInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyAccelerationStructureKHR);
+    this->vkCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline VkResult DeviceTable::CopyAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                                          const VkCopyAccelerationStructureInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyAccelerationStructureKHR);
+    return this->vkCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::CmdCopyAccelerationStructureToMemoryKHR(
+    VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyAccelerationStructureToMemoryKHR);
+    this->vkCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline VkResult DeviceTable::CopyAccelerationStructureToMemoryKHR(
+    VkDevice device, VkDeferredOperationKHR deferredOperation,
+    const VkCopyAccelerationStructureToMemoryInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyAccelerationStructureToMemoryKHR);
+    return this->vkCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::CmdCopyMemoryToAccelerationStructureKHR(
+    VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMemoryToAccelerationStructureKHR);
+    this->vkCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline VkResult DeviceTable::CopyMemoryToAccelerationStructureKHR(
+    VkDevice device, VkDeferredOperationKHR deferredOperation,
+    const VkCopyMemoryToAccelerationStructureInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyMemoryToAccelerationStructureKHR);
+    return this->vkCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::CmdWriteAccelerationStructuresPropertiesKHR(
+    VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount,
+    const VkAccelerationStructureKHR *pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool,
+    uint32_t firstQuery) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteAccelerationStructuresPropertiesKHR);
+    this->vkCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount,
+                                                        pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline void DeviceTable::CmdWriteAccelerationStructuresPropertiesNV(
+    VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount,
+    const VkAccelerationStructureNV *pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool,
+    uint32_t firstQuery) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteAccelerationStructuresPropertiesNV);
+    this->vkCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount,
+                                                       pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline void DeviceTable::CmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer,
+                                                         const VkAccelerationStructureInfoNV *pInfo,
+                                                         VkBuffer instanceData, VkDeviceSize instanceOffset,
+                                                         VkBool32 update, VkAccelerationStructureNV dst,
+                                                         VkAccelerationStructureNV src, VkBuffer scratch,
+                                                         VkDeviceSize scratchOffset) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBuildAccelerationStructureNV);
+    this->vkCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src,
+                                            scratch, scratchOffset);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline VkResult DeviceTable::WriteAccelerationStructuresPropertiesKHR(
+    VkDevice device, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR *pAccelerationStructures,
+    VkQueryType queryType, size_t dataSize, void *pData, size_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkWriteAccelerationStructuresPropertiesKHR);
+    return this->vkWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures,
+                                                            queryType, dataSize, pData, stride);
+}
+#endif
+#if defined(VK_KHR_ray_tracing_pipeline)
+inline void DeviceTable::CmdTraceRaysKHR(VkCommandBuffer commandBuffer,
+                                         const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable,
+                                         const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable,
+                                         const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable,
+                                         const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable,
+                                         uint32_t width, uint32_t height, uint32_t depth) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdTraceRaysKHR);
+    this->vkCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable,
+                            pCallableShaderBindingTable, width, height, depth);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline void DeviceTable::CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer,
+                                        VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer,
+                                        VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride,
+                                        VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset,
+                                        VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer,
+                                        VkDeviceSize callableShaderBindingOffset,
+                                        VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height,
+                                        uint32_t depth) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdTraceRaysNV);
+    this->vkCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
+                           missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride,
+                           hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride,
+                           callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride,
+                           width, height, depth);
+}
+#endif
+#if defined(VK_KHR_ray_tracing_pipeline)
+inline VkResult DeviceTable::GetRayTracingShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline,
+                                                                uint32_t firstGroup, uint32_t groupCount,
+                                                                size_t dataSize, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRayTracingShaderGroupHandlesKHR);
+    return this->vkGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+#endif
+#if defined(VK_KHR_ray_tracing_pipeline)
+inline VkResult DeviceTable::GetRayTracingCaptureReplayShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline,
+                                                                             uint32_t firstGroup, uint32_t groupCount,
+                                                                             size_t dataSize, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    return this->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize,
+                                                                   pData);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline VkResult DeviceTable::GetAccelerationStructureHandleNV(VkDevice device,
+                                                              VkAccelerationStructureNV accelerationStructure,
+                                                              size_t dataSize, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetAccelerationStructureHandleNV);
+    return this->vkGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline VkResult DeviceTable::CreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pipelineCache,
+                                                         uint32_t createInfoCount,
+                                                         const VkRayTracingPipelineCreateInfoNV *pCreateInfos,
+                                                         const VkAllocationCallbacks *pAllocator,
+                                                         VkPipeline *pPipelines) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateRayTracingPipelinesNV);
+    return this->vkCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                               pPipelines);
+}
+#endif
+#if defined(VK_KHR_ray_tracing_pipeline)
+inline VkResult DeviceTable::CreateRayTracingPipelinesKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                                          VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                          const VkRayTracingPipelineCreateInfoKHR *pCreateInfos,
+                                                          const VkAllocationCallbacks *pAllocator,
+                                                          VkPipeline *pPipelines) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateRayTracingPipelinesKHR);
+    return this->vkCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
+                                                pAllocator, pPipelines);
+}
+#endif
+#if defined(VK_KHR_ray_tracing_pipeline)
+inline void DeviceTable::CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer,
+                                                 const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable,
+                                                 const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable,
+                                                 const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable,
+                                                 const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable,
+                                                 VkDeviceAddress indirectDeviceAddress) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdTraceRaysIndirectKHR);
+    this->vkCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                    pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+}
+#endif
+#if (defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline))
+inline void DeviceTable::CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer,
+                                                  VkDeviceAddress indirectDeviceAddress) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdTraceRaysIndirect2KHR);
+    this->vkCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
+}
+#endif
+#if defined(VK_NV_cluster_acceleration_structure)
+inline void DeviceTable::GetClusterAccelerationStructureBuildSizesNV(
+    VkDevice device, const VkClusterAccelerationStructureInputInfoNV *pInfo,
+    VkAccelerationStructureBuildSizesInfoKHR *pSizeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetClusterAccelerationStructureBuildSizesNV);
+    this->vkGetClusterAccelerationStructureBuildSizesNV(device, pInfo, pSizeInfo);
+}
+#endif
+#if defined(VK_NV_cluster_acceleration_structure)
+inline void DeviceTable::CmdBuildClusterAccelerationStructureIndirectNV(
+    VkCommandBuffer commandBuffer, const VkClusterAccelerationStructureCommandsInfoNV *pCommandInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBuildClusterAccelerationStructureIndirectNV);
+    this->vkCmdBuildClusterAccelerationStructureIndirectNV(commandBuffer, pCommandInfos);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::GetDeviceAccelerationStructureCompatibilityKHR(
+    VkDevice device, const VkAccelerationStructureVersionInfoKHR *pVersionInfo,
+    VkAccelerationStructureCompatibilityKHR *pCompatibility) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceAccelerationStructureCompatibilityKHR);
+    this->vkGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
+}
+#endif
+#if defined(VK_KHR_ray_tracing_pipeline)
+inline VkDeviceSize DeviceTable::GetRayTracingShaderGroupStackSizeKHR(VkDevice device, VkPipeline pipeline,
+                                                                      uint32_t group,
+                                                                      VkShaderGroupShaderKHR groupShader) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRayTracingShaderGroupStackSizeKHR);
+    return this->vkGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
+}
+#endif
+#if defined(VK_KHR_ray_tracing_pipeline)
+inline void DeviceTable::CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer,
+                                                              uint32_t pipelineStackSize) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRayTracingPipelineStackSizeKHR);
+    this->vkCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
+}
+#endif
+#if defined(VK_NVX_image_view_handle)
+inline uint32_t DeviceTable::GetImageViewHandleNVX(VkDevice device, const VkImageViewHandleInfoNVX *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageViewHandleNVX);
+    return this->vkGetImageViewHandleNVX(device, pInfo);
+}
+#endif
+#if (defined(VK_NVX_image_view_handle) && VK_NVX_IMAGE_VIEW_HANDLE_SPEC_VERSION >= 3)
+inline uint64_t DeviceTable::GetImageViewHandle64NVX(VkDevice device, const VkImageViewHandleInfoNVX *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageViewHandle64NVX);
+    return this->vkGetImageViewHandle64NVX(device, pInfo);
+}
+#endif
+#if (defined(VK_NVX_image_view_handle) && VK_NVX_IMAGE_VIEW_HANDLE_SPEC_VERSION >= 3 &&                                \
+     VK_NVX_IMAGE_VIEW_HANDLE_SPEC_VERSION >= 2)
+inline VkResult DeviceTable::GetImageViewAddressNVX(VkDevice device, VkImageView imageView,
+                                                    VkImageViewAddressPropertiesNVX *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageViewAddressNVX);
+    return this->vkGetImageViewAddressNVX(device, imageView, pProperties);
+}
+#endif
+#if (defined(VK_EXT_full_screen_exclusive) && (defined(VK_KHR_device_group) || defined(VKIT_API_VERSION_1_1)))
+inline VkResult DeviceTable::GetDeviceGroupSurfacePresentModes2EXT(VkDevice device,
+                                                                   const VkPhysicalDeviceSurfaceInfo2KHR *pSurfaceInfo,
+                                                                   VkDeviceGroupPresentModeFlagsKHR *pModes) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceGroupSurfacePresentModes2EXT);
+    return this->vkGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
+}
+#endif
+#if defined(VK_EXT_full_screen_exclusive)
+inline VkResult DeviceTable::AcquireFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAcquireFullScreenExclusiveModeEXT);
+    return this->vkAcquireFullScreenExclusiveModeEXT(device, swapchain);
+}
+#endif
+#if defined(VK_EXT_full_screen_exclusive)
+inline VkResult DeviceTable::ReleaseFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkReleaseFullScreenExclusiveModeEXT);
+    return this->vkReleaseFullScreenExclusiveModeEXT(device, swapchain);
+}
+#endif
+#if defined(VK_KHR_performance_query)
+inline VkResult DeviceTable::AcquireProfilingLockKHR(VkDevice device, const VkAcquireProfilingLockInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAcquireProfilingLockKHR);
+    return this->vkAcquireProfilingLockKHR(device, pInfo);
+}
+#endif
+#if defined(VK_KHR_performance_query)
+inline void DeviceTable::ReleaseProfilingLockKHR(VkDevice device) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkReleaseProfilingLockKHR);
+    this->vkReleaseProfilingLockKHR(device);
+}
+#endif
+#if defined(VK_EXT_image_drm_format_modifier)
+inline VkResult DeviceTable::GetImageDrmFormatModifierPropertiesEXT(
+    VkDevice device, VkImage image, VkImageDrmFormatModifierPropertiesEXT *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageDrmFormatModifierPropertiesEXT);
+    return this->vkGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline uint64_t DeviceTable::GetBufferOpaqueCaptureAddress(VkDevice device,
+                                                           const VkBufferDeviceAddressInfo *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferOpaqueCaptureAddress);
+    return this->vkGetBufferOpaqueCaptureAddress(device, pInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline VkDeviceAddress DeviceTable::GetBufferDeviceAddress(VkDevice device,
+                                                           const VkBufferDeviceAddressInfo *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferDeviceAddress);
+    return this->vkGetBufferDeviceAddress(device, pInfo);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::InitializePerformanceApiINTEL(
+    VkDevice device, const VkInitializePerformanceApiInfoINTEL *pInitializeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkInitializePerformanceApiINTEL);
+    return this->vkInitializePerformanceApiINTEL(device, pInitializeInfo);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline void DeviceTable::UninitializePerformanceApiINTEL(VkDevice device) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUninitializePerformanceApiINTEL);
+    this->vkUninitializePerformanceApiINTEL(device);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::CmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer,
+                                                          const VkPerformanceMarkerInfoINTEL *pMarkerInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPerformanceMarkerINTEL);
+    return this->vkCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::CmdSetPerformanceStreamMarkerINTEL(
+    VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL *pMarkerInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPerformanceStreamMarkerINTEL);
+    return this->vkCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::CmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer,
+                                                            const VkPerformanceOverrideInfoINTEL *pOverrideInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPerformanceOverrideINTEL);
+    return this->vkCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::AcquirePerformanceConfigurationINTEL(
+    VkDevice device, const VkPerformanceConfigurationAcquireInfoINTEL *pAcquireInfo,
+    VkPerformanceConfigurationINTEL *pConfiguration) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAcquirePerformanceConfigurationINTEL);
+    return this->vkAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::ReleasePerformanceConfigurationINTEL(VkDevice device,
+                                                                  VkPerformanceConfigurationINTEL configuration) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkReleasePerformanceConfigurationINTEL);
+    return this->vkReleasePerformanceConfigurationINTEL(device, configuration);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::QueueSetPerformanceConfigurationINTEL(VkQueue queue,
+                                                                   VkPerformanceConfigurationINTEL configuration) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueSetPerformanceConfigurationINTEL);
+    return this->vkQueueSetPerformanceConfigurationINTEL(queue, configuration);
+}
+#endif
+#if defined(VK_INTEL_performance_query)
+inline VkResult DeviceTable::GetPerformanceParameterINTEL(VkDevice device, VkPerformanceParameterTypeINTEL parameter,
+                                                          VkPerformanceValueINTEL *pValue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPerformanceParameterINTEL);
+    return this->vkGetPerformanceParameterINTEL(device, parameter, pValue);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_2)
+inline uint64_t DeviceTable::GetDeviceMemoryOpaqueCaptureAddress(
+    VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceMemoryOpaqueCaptureAddress);
+    return this->vkGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
+}
+#endif
+#if defined(VK_KHR_pipeline_executable_properties)
+inline VkResult DeviceTable::GetPipelineExecutablePropertiesKHR(VkDevice device, const VkPipelineInfoKHR *pPipelineInfo,
+                                                                uint32_t *pExecutableCount,
+                                                                VkPipelineExecutablePropertiesKHR *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineExecutablePropertiesKHR);
+    return this->vkGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
+}
+#endif
+#if defined(VK_KHR_pipeline_executable_properties)
+inline VkResult DeviceTable::GetPipelineExecutableStatisticsKHR(VkDevice device,
+                                                                const VkPipelineExecutableInfoKHR *pExecutableInfo,
+                                                                uint32_t *pStatisticCount,
+                                                                VkPipelineExecutableStatisticKHR *pStatistics) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineExecutableStatisticsKHR);
+    return this->vkGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
+}
+#endif
+#if defined(VK_KHR_pipeline_executable_properties)
+inline VkResult DeviceTable::GetPipelineExecutableInternalRepresentationsKHR(
+    VkDevice device, const VkPipelineExecutableInfoKHR *pExecutableInfo, uint32_t *pInternalRepresentationCount,
+    VkPipelineExecutableInternalRepresentationKHR *pInternalRepresentations) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineExecutableInternalRepresentationsKHR);
+    return this->vkGetPipelineExecutableInternalRepresentationsKHR(
+        device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdSetLineStipple(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
+                                           uint16_t lineStipplePattern) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLineStipple);
+    this->vkCmdSetLineStipple(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline VkResult DeviceTable::CreateAccelerationStructureKHR(VkDevice device,
+                                                            const VkAccelerationStructureCreateInfoKHR *pCreateInfo,
+                                                            const VkAllocationCallbacks *pAllocator,
+                                                            VkAccelerationStructureKHR *pAccelerationStructure) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateAccelerationStructureKHR);
+    return this->vkCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::CmdBuildAccelerationStructuresKHR(
+    VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
+    const VkAccelerationStructureBuildRangeInfoKHR *const *ppBuildRangeInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBuildAccelerationStructuresKHR);
+    this->vkCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::CmdBuildAccelerationStructuresIndirectKHR(
+    VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
+    const VkDeviceAddress *pIndirectDeviceAddresses, const uint32_t *pIndirectStrides,
+    const uint32_t *const *ppMaxPrimitiveCounts) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBuildAccelerationStructuresIndirectKHR);
+    this->vkCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses,
+                                                      pIndirectStrides, ppMaxPrimitiveCounts);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline VkResult DeviceTable::BuildAccelerationStructuresKHR(
+    VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount,
+    const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
+    const VkAccelerationStructureBuildRangeInfoKHR *const *ppBuildRangeInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBuildAccelerationStructuresKHR);
+    return this->vkBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline VkDeviceAddress DeviceTable::GetAccelerationStructureDeviceAddressKHR(
+    VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetAccelerationStructureDeviceAddressKHR);
+    return this->vkGetAccelerationStructureDeviceAddressKHR(device, pInfo);
+}
+#endif
+#if defined(VK_KHR_deferred_host_operations)
+inline VkResult DeviceTable::CreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                                        VkDeferredOperationKHR *pDeferredOperation) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateDeferredOperationKHR);
+    return this->vkCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
+}
+#endif
+#if defined(VK_KHR_deferred_host_operations)
+inline void DeviceTable::DestroyDeferredOperationKHR(VkDevice device, VkDeferredOperationKHR operation,
+                                                     const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyDeferredOperationKHR);
+    this->vkDestroyDeferredOperationKHR(device, operation, pAllocator);
+}
+#endif
+#if defined(VK_KHR_deferred_host_operations)
+inline uint32_t DeviceTable::GetDeferredOperationMaxConcurrencyKHR(VkDevice device,
+                                                                   VkDeferredOperationKHR operation) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeferredOperationMaxConcurrencyKHR);
+    return this->vkGetDeferredOperationMaxConcurrencyKHR(device, operation);
+}
+#endif
+#if defined(VK_KHR_deferred_host_operations)
+inline VkResult DeviceTable::GetDeferredOperationResultKHR(VkDevice device, VkDeferredOperationKHR operation) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeferredOperationResultKHR);
+    return this->vkGetDeferredOperationResultKHR(device, operation);
+}
+#endif
+#if defined(VK_KHR_deferred_host_operations)
+inline VkResult DeviceTable::DeferredOperationJoinKHR(VkDevice device, VkDeferredOperationKHR operation) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDeferredOperationJoinKHR);
+    return this->vkDeferredOperationJoinKHR(device, operation);
+}
+#endif
+#if defined(VK_NV_device_generated_commands_compute)
+inline void DeviceTable::GetPipelineIndirectMemoryRequirementsNV(VkDevice device,
+                                                                 const VkComputePipelineCreateInfo *pCreateInfo,
+                                                                 VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineIndirectMemoryRequirementsNV);
+    this->vkGetPipelineIndirectMemoryRequirementsNV(device, pCreateInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_NV_device_generated_commands_compute)
+inline VkDeviceAddress DeviceTable::GetPipelineIndirectDeviceAddressNV(
+    VkDevice device, const VkPipelineIndirectDeviceAddressInfoNV *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelineIndirectDeviceAddressNV);
+    return this->vkGetPipelineIndirectDeviceAddressNV(device, pInfo);
+}
+#endif
+#if defined(VK_AMD_anti_lag)
+inline void DeviceTable::AntiLagUpdateAMD(VkDevice device, const VkAntiLagDataAMD *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkAntiLagUpdateAMD);
+    this->vkAntiLagUpdateAMD(device, pData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCullMode);
+    this->vkCmdSetCullMode(commandBuffer, cullMode);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetFrontFace);
+    this->vkCmdSetFrontFace(commandBuffer, frontFace);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer,
+                                                 VkPrimitiveTopology primitiveTopology) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPrimitiveTopology);
+    this->vkCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount,
+                                                 const VkViewport *pViewports) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetViewportWithCount);
+    this->vkCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount,
+                                                const VkRect2D *pScissors) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetScissorWithCount);
+    this->vkCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdBindIndexBuffer2(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                             VkDeviceSize size, VkIndexType indexType) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindIndexBuffer2);
+    this->vkCmdBindIndexBuffer2(commandBuffer, buffer, offset, size, indexType);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding,
+                                               uint32_t bindingCount, const VkBuffer *pBuffers,
+                                               const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
+                                               const VkDeviceSize *pStrides) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindVertexBuffers2);
+    this->vkCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthTestEnable);
+    this->vkCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthWriteEnable);
+    this->vkCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthCompareOp);
+    this->vkCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer,
+                                                     VkBool32 depthBoundsTestEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthBoundsTestEnable);
+    this->vkCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetStencilTestEnable);
+    this->vkCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp,
+                                         VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetStencilOp);
+    this->vkCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state2) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPatchControlPointsEXT);
+    this->vkCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer,
+                                                       VkBool32 rasterizerDiscardEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRasterizerDiscardEnable);
+    this->vkCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthBiasEnable);
+    this->vkCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state2) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLogicOpEXT);
+    this->vkCmdSetLogicOpEXT(commandBuffer, logicOp);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer,
+                                                      VkBool32 primitiveRestartEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPrimitiveRestartEnable);
+    this->vkCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && (defined(VK_KHR_maintenance2) || defined(VKIT_API_VERSION_1_1))) ||    \
+    defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer,
+                                                           VkTessellationDomainOrigin domainOrigin) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetTessellationDomainOriginEXT);
+    this->vkCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClampEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthClampEnableEXT);
+    this->vkCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPolygonModeEXT);
+    this->vkCmdSetPolygonModeEXT(commandBuffer, polygonMode);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer,
+                                                       VkSampleCountFlagBits rasterizationSamples) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRasterizationSamplesEXT);
+    this->vkCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples,
+                                             const VkSampleMask *pSampleMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetSampleMaskEXT);
+    this->vkCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer,
+                                                        VkBool32 alphaToCoverageEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetAlphaToCoverageEnableEXT);
+    this->vkCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetAlphaToOneEnableEXT);
+    this->vkCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLogicOpEnableEXT);
+    this->vkCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
+                                                   uint32_t attachmentCount, const VkBool32 *pColorBlendEnables) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetColorBlendEnableEXT);
+    this->vkCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetColorBlendEquationEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
+                                                     uint32_t attachmentCount,
+                                                     const VkColorBlendEquationEXT *pColorBlendEquations) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetColorBlendEquationEXT);
+    this->vkCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state3) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
+                                                 uint32_t attachmentCount,
+                                                 const VkColorComponentFlags *pColorWriteMasks) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetColorWriteMaskEXT);
+    this->vkCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_transform_feedback)) ||                                 \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_transform_feedback))
+inline void DeviceTable::CmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32_t rasterizationStream) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRasterizationStreamEXT);
+    this->vkCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) ||                         \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization))
+inline void DeviceTable::CmdSetConservativeRasterizationModeEXT(
+    VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetConservativeRasterizationModeEXT);
+    this->vkCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) ||                         \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization))
+inline void DeviceTable::CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandBuffer,
+                                                                   float extraPrimitiveOverestimationSize) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetExtraPrimitiveOverestimationSizeEXT);
+    this->vkCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_enable)) ||                                  \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_enable))
+inline void DeviceTable::CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClipEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthClipEnableEXT);
+    this->vkCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_sample_locations)) ||                                   \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_sample_locations))
+inline void DeviceTable::CmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer,
+                                                        VkBool32 sampleLocationsEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetSampleLocationsEnableEXT);
+    this->vkCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_blend_operation_advanced)) ||                           \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_blend_operation_advanced))
+inline void DeviceTable::CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
+                                                     uint32_t attachmentCount,
+                                                     const VkColorBlendAdvancedEXT *pColorBlendAdvanced) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetColorBlendAdvancedEXT);
+    this->vkCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_provoking_vertex)) ||                                   \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_provoking_vertex))
+inline void DeviceTable::CmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer,
+                                                      VkProvokingVertexModeEXT provokingVertexMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetProvokingVertexModeEXT);
+    this->vkCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) ||                                 \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization))
+inline void DeviceTable::CmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer,
+                                                        VkLineRasterizationModeEXT lineRasterizationMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLineRasterizationModeEXT);
+    this->vkCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) ||                                 \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization))
+inline void DeviceTable::CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLineStippleEnableEXT);
+    this->vkCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_control)) ||                                 \
+    (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_control))
+inline void DeviceTable::CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer,
+                                                            VkBool32 negativeOneToOne) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthClipNegativeOneToOneEXT);
+    this->vkCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_clip_space_w_scaling)) ||                                \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_clip_space_w_scaling))
+inline void DeviceTable::CmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer,
+                                                        VkBool32 viewportWScalingEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetViewportWScalingEnableNV);
+    this->vkCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_viewport_swizzle)) ||                                    \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_viewport_swizzle))
+inline void DeviceTable::CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport,
+                                                 uint32_t viewportCount,
+                                                 const VkViewportSwizzleNV *pViewportSwizzles) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetViewportSwizzleNV);
+    this->vkCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) ||                          \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color))
+inline void DeviceTable::CmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer,
+                                                       VkBool32 coverageToColorEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCoverageToColorEnableNV);
+    this->vkCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) ||                          \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color))
+inline void DeviceTable::CmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer,
+                                                         uint32_t coverageToColorLocation) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCoverageToColorLocationNV);
+    this->vkCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) ||                           \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples))
+inline void DeviceTable::CmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer,
+                                                        VkCoverageModulationModeNV coverageModulationMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCoverageModulationModeNV);
+    this->vkCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) ||                           \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples))
+inline void DeviceTable::CmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffer,
+                                                               VkBool32 coverageModulationTableEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCoverageModulationTableEnableNV);
+    this->vkCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) ||                           \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples))
+inline void DeviceTable::CmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer,
+                                                         uint32_t coverageModulationTableCount,
+                                                         const float *pCoverageModulationTable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCoverageModulationTableNV);
+    this->vkCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_shading_rate_image)) ||                                  \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_shading_rate_image))
+inline void DeviceTable::CmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer,
+                                                        VkBool32 shadingRateImageEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetShadingRateImageEnableNV);
+    this->vkCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_coverage_reduction_mode)) ||                             \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_coverage_reduction_mode))
+inline void DeviceTable::CmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer,
+                                                       VkCoverageReductionModeNV coverageReductionMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCoverageReductionModeNV);
+    this->vkCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
+}
+#endif
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_representative_fragment_test)) ||                        \
+    (defined(VK_EXT_shader_object) && defined(VK_NV_representative_fragment_test))
+inline void DeviceTable::CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBuffer,
+                                                                  VkBool32 representativeFragmentTestEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRepresentativeFragmentTestEnableNV);
+    this->vkCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline VkResult DeviceTable::CreatePrivateDataSlot(VkDevice device, const VkPrivateDataSlotCreateInfo *pCreateInfo,
+                                                   const VkAllocationCallbacks *pAllocator,
+                                                   VkPrivateDataSlot *pPrivateDataSlot) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreatePrivateDataSlot);
+    return this->vkCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::DestroyPrivateDataSlot(VkDevice device, VkPrivateDataSlot privateDataSlot,
+                                                const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyPrivateDataSlot);
+    this->vkDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline VkResult DeviceTable::SetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
+                                            VkPrivateDataSlot privateDataSlot, uint64_t data) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetPrivateData);
+    return this->vkSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::GetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
+                                        VkPrivateDataSlot privateDataSlot, uint64_t *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPrivateData);
+    this->vkGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyBuffer2);
+    this->vkCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2 *pCopyImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyImage2);
+    this->vkCmdCopyImage2(commandBuffer, pCopyImageInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2 *pBlitImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBlitImage2);
+    this->vkCmdBlitImage2(commandBuffer, pBlitImageInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
+                                               const VkCopyBufferToImageInfo2 *pCopyBufferToImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyBufferToImage2);
+    this->vkCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
+                                               const VkCopyImageToBufferInfo2 *pCopyImageToBufferInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyImageToBuffer2);
+    this->vkCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdResolveImage2(VkCommandBuffer commandBuffer,
+                                          const VkResolveImageInfo2 *pResolveImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdResolveImage2);
+    this->vkCmdResolveImage2(commandBuffer, pResolveImageInfo);
+}
+#endif
+#if defined(VK_KHR_object_refresh)
+inline void DeviceTable::CmdRefreshObjectsKHR(VkCommandBuffer commandBuffer,
+                                              const VkRefreshObjectListKHR *pRefreshObjects) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdRefreshObjectsKHR);
+    this->vkCmdRefreshObjectsKHR(commandBuffer, pRefreshObjects);
+}
+#endif
+#if defined(VK_KHR_fragment_shading_rate)
+inline void DeviceTable::CmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D *pFragmentSize,
+                                                      const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetFragmentShadingRateKHR);
+    this->vkCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+}
+#endif
+#if defined(VK_NV_fragment_shading_rate_enums)
+inline void DeviceTable::CmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer,
+                                                         VkFragmentShadingRateNV shadingRate,
+                                                         const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetFragmentShadingRateEnumNV);
+    this->vkCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
+}
+#endif
+#if defined(VK_KHR_acceleration_structure)
+inline void DeviceTable::GetAccelerationStructureBuildSizesKHR(
+    VkDevice device, VkAccelerationStructureBuildTypeKHR buildType,
+    const VkAccelerationStructureBuildGeometryInfoKHR *pBuildInfo, const uint32_t *pMaxPrimitiveCounts,
+    VkAccelerationStructureBuildSizesInfoKHR *pSizeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetAccelerationStructureBuildSizesKHR);
+    this->vkGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+}
+#endif
+#if defined(VK_EXT_vertex_input_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetVertexInputEXT(
+    VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount,
+    const VkVertexInputBindingDescription2EXT *pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount,
+    const VkVertexInputAttributeDescription2EXT *pVertexAttributeDescriptions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetVertexInputEXT);
+    this->vkCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions,
+                                 vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+}
+#endif
+#if defined(VK_EXT_color_write_enable)
+inline void DeviceTable::CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
+                                                   const VkBool32 *pColorWriteEnables) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetColorWriteEnableEXT);
+    this->vkCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
+                                      const VkDependencyInfo *pDependencyInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetEvent2);
+    this->vkCmdSetEvent2(commandBuffer, event, pDependencyInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
+                                        VkPipelineStageFlags2 stageMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdResetEvent2);
+    this->vkCmdResetEvent2(commandBuffer, event, stageMask);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                                        const VkDependencyInfo *pDependencyInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWaitEvents2);
+    this->vkCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdPipelineBarrier2(VkCommandBuffer commandBuffer,
+                                             const VkDependencyInfo *pDependencyInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPipelineBarrier2);
+    this->vkCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline VkResult DeviceTable::QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                          VkFence fence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueSubmit2);
+    return this->vkQueueSubmit2(queue, submitCount, pSubmits, fence);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage,
+                                            VkQueryPool queryPool, uint32_t query) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteTimestamp2);
+    this->vkCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+}
+#endif
+#if (defined(VK_AMD_buffer_marker) && (defined(VKIT_API_VERSION_1_3) || defined(VK_KHR_synchronization2)))
+inline void DeviceTable::CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage,
+                                                  VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteBufferMarker2AMD);
+    this->vkCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+}
+#endif
+#if (defined(VK_NV_device_diagnostic_checkpoints) &&                                                                   \
+     (defined(VKIT_API_VERSION_1_3) || defined(VK_KHR_synchronization2)))
+inline void DeviceTable::GetQueueCheckpointData2NV(VkQueue queue, uint32_t *pCheckpointDataCount,
+                                                   VkCheckpointData2NV *pCheckpointData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetQueueCheckpointData2NV);
+    this->vkGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline VkResult DeviceTable::CopyMemoryToImage(VkDevice device,
+                                               const VkCopyMemoryToImageInfo *pCopyMemoryToImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyMemoryToImage);
+    return this->vkCopyMemoryToImage(device, pCopyMemoryToImageInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline VkResult DeviceTable::CopyImageToMemory(VkDevice device,
+                                               const VkCopyImageToMemoryInfo *pCopyImageToMemoryInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyImageToMemory);
+    return this->vkCopyImageToMemory(device, pCopyImageToMemoryInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline VkResult DeviceTable::CopyImageToImage(VkDevice device,
+                                              const VkCopyImageToImageInfo *pCopyImageToImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyImageToImage);
+    return this->vkCopyImageToImage(device, pCopyImageToImageInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline VkResult DeviceTable::TransitionImageLayout(VkDevice device, uint32_t transitionCount,
+                                                   const VkHostImageLayoutTransitionInfo *pTransitions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkTransitionImageLayout);
+    return this->vkTransitionImageLayout(device, transitionCount, pTransitions);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline VkResult DeviceTable::CreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR *pCreateInfo,
+                                                   const VkAllocationCallbacks *pAllocator,
+                                                   VkVideoSessionKHR *pVideoSession) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateVideoSessionKHR);
+    return this->vkCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline void DeviceTable::DestroyVideoSessionKHR(VkDevice device, VkVideoSessionKHR videoSession,
+                                                const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyVideoSessionKHR);
+    this->vkDestroyVideoSessionKHR(device, videoSession, pAllocator);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline VkResult DeviceTable::CreateVideoSessionParametersKHR(VkDevice device,
+                                                             const VkVideoSessionParametersCreateInfoKHR *pCreateInfo,
+                                                             const VkAllocationCallbacks *pAllocator,
+                                                             VkVideoSessionParametersKHR *pVideoSessionParameters) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateVideoSessionParametersKHR);
+    return this->vkCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline VkResult DeviceTable::UpdateVideoSessionParametersKHR(
+    VkDevice device, VkVideoSessionParametersKHR videoSessionParameters,
+    const VkVideoSessionParametersUpdateInfoKHR *pUpdateInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUpdateVideoSessionParametersKHR);
+    return this->vkUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
+}
+#endif
+#if defined(VK_KHR_video_encode_queue)
+inline VkResult DeviceTable::GetEncodedVideoSessionParametersKHR(
+    VkDevice device, const VkVideoEncodeSessionParametersGetInfoKHR *pVideoSessionParametersInfo,
+    VkVideoEncodeSessionParametersFeedbackInfoKHR *pFeedbackInfo, size_t *pDataSize, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetEncodedVideoSessionParametersKHR);
+    return this->vkGetEncodedVideoSessionParametersKHR(device, pVideoSessionParametersInfo, pFeedbackInfo, pDataSize,
+                                                       pData);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline void DeviceTable::DestroyVideoSessionParametersKHR(VkDevice device,
+                                                          VkVideoSessionParametersKHR videoSessionParameters,
+                                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyVideoSessionParametersKHR);
+    this->vkDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline VkResult DeviceTable::GetVideoSessionMemoryRequirementsKHR(
+    VkDevice device, VkVideoSessionKHR videoSession, uint32_t *pMemoryRequirementsCount,
+    VkVideoSessionMemoryRequirementsKHR *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetVideoSessionMemoryRequirementsKHR);
+    return this->vkGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount,
+                                                        pMemoryRequirements);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline VkResult DeviceTable::BindVideoSessionMemoryKHR(
+    VkDevice device, VkVideoSessionKHR videoSession, uint32_t bindSessionMemoryInfoCount,
+    const VkBindVideoSessionMemoryInfoKHR *pBindSessionMemoryInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindVideoSessionMemoryKHR);
+    return this->vkBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+}
+#endif
+#if defined(VK_KHR_video_decode_queue)
+inline void DeviceTable::CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR *pDecodeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDecodeVideoKHR);
+    this->vkCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline void DeviceTable::CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
+                                                const VkVideoBeginCodingInfoKHR *pBeginInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginVideoCodingKHR);
+    this->vkCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline void DeviceTable::CmdControlVideoCodingKHR(VkCommandBuffer commandBuffer,
+                                                  const VkVideoCodingControlInfoKHR *pCodingControlInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdControlVideoCodingKHR);
+    this->vkCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
+}
+#endif
+#if defined(VK_KHR_video_queue)
+inline void DeviceTable::CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer,
+                                              const VkVideoEndCodingInfoKHR *pEndCodingInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndVideoCodingKHR);
+    this->vkCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
+}
+#endif
+#if defined(VK_KHR_video_encode_queue)
+inline void DeviceTable::CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR *pEncodeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEncodeVideoKHR);
+    this->vkCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
+}
+#endif
+#if defined(VK_NV_memory_decompression)
+inline void DeviceTable::CmdDecompressMemoryNV(VkCommandBuffer commandBuffer, uint32_t decompressRegionCount,
+                                               const VkDecompressMemoryRegionNV *pDecompressMemoryRegions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDecompressMemoryNV);
+    this->vkCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+}
+#endif
+#if defined(VK_NV_memory_decompression)
+inline void DeviceTable::CmdDecompressMemoryIndirectCountNV(VkCommandBuffer commandBuffer,
+                                                            VkDeviceAddress indirectCommandsAddress,
+                                                            VkDeviceAddress indirectCommandsCountAddress,
+                                                            uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDecompressMemoryIndirectCountNV);
+    this->vkCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress,
+                                               stride);
+}
+#endif
+#if defined(VK_NV_partitioned_acceleration_structure)
+inline void DeviceTable::GetPartitionedAccelerationStructuresBuildSizesNV(
+    VkDevice device, const VkPartitionedAccelerationStructureInstancesInputNV *pInfo,
+    VkAccelerationStructureBuildSizesInfoKHR *pSizeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPartitionedAccelerationStructuresBuildSizesNV);
+    this->vkGetPartitionedAccelerationStructuresBuildSizesNV(device, pInfo, pSizeInfo);
+}
+#endif
+#if defined(VK_NV_partitioned_acceleration_structure)
+inline void DeviceTable::CmdBuildPartitionedAccelerationStructuresNV(
+    VkCommandBuffer commandBuffer, const VkBuildPartitionedAccelerationStructureInfoNV *pBuildInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBuildPartitionedAccelerationStructuresNV);
+    this->vkCmdBuildPartitionedAccelerationStructuresNV(commandBuffer, pBuildInfo);
+}
+#endif
+#if defined(VK_NVX_binary_import)
+inline VkResult DeviceTable::CreateCuModuleNVX(VkDevice device, const VkCuModuleCreateInfoNVX *pCreateInfo,
+                                               const VkAllocationCallbacks *pAllocator, VkCuModuleNVX *pModule) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateCuModuleNVX);
+    return this->vkCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
+}
+#endif
+#if defined(VK_NVX_binary_import)
+inline VkResult DeviceTable::CreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX *pCreateInfo,
+                                                 const VkAllocationCallbacks *pAllocator,
+                                                 VkCuFunctionNVX *pFunction) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateCuFunctionNVX);
+    return this->vkCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
+}
+#endif
+#if defined(VK_NVX_binary_import)
+inline void DeviceTable::DestroyCuModuleNVX(VkDevice device, VkCuModuleNVX module,
+                                            const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyCuModuleNVX);
+    this->vkDestroyCuModuleNVX(device, module, pAllocator);
+}
+#endif
+#if defined(VK_NVX_binary_import)
+inline void DeviceTable::DestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX function,
+                                              const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyCuFunctionNVX);
+    this->vkDestroyCuFunctionNVX(device, function, pAllocator);
+}
+#endif
+#if defined(VK_NVX_binary_import)
+inline void DeviceTable::CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX *pLaunchInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCuLaunchKernelNVX);
+    this->vkCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline void DeviceTable::GetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout,
+                                                       VkDeviceSize *pLayoutSizeInBytes) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDescriptorSetLayoutSizeEXT);
+    this->vkGetDescriptorSetLayoutSizeEXT(device, layout, pLayoutSizeInBytes);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline void DeviceTable::GetDescriptorSetLayoutBindingOffsetEXT(VkDevice device, VkDescriptorSetLayout layout,
+                                                                uint32_t binding, VkDeviceSize *pOffset) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    this->vkGetDescriptorSetLayoutBindingOffsetEXT(device, layout, binding, pOffset);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline void DeviceTable::GetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT *pDescriptorInfo,
+                                          size_t dataSize, void *pDescriptor) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDescriptorEXT);
+    this->vkGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline void DeviceTable::CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
+                                                     const VkDescriptorBufferBindingInfoEXT *pBindingInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindDescriptorBuffersEXT);
+    this->vkCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline void DeviceTable::CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer,
+                                                          VkPipelineBindPoint pipelineBindPoint,
+                                                          VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
+                                                          const uint32_t *pBufferIndices,
+                                                          const VkDeviceSize *pOffsets) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDescriptorBufferOffsetsEXT);
+    this->vkCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
+                                             pBufferIndices, pOffsets);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline void DeviceTable::CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandBuffer commandBuffer,
+                                                                    VkPipelineBindPoint pipelineBindPoint,
+                                                                    VkPipelineLayout layout, uint32_t set) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindDescriptorBufferEmbeddedSamplersEXT);
+    this->vkCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline VkResult DeviceTable::GetBufferOpaqueCaptureDescriptorDataEXT(VkDevice device,
+                                                                     const VkBufferCaptureDescriptorDataInfoEXT *pInfo,
+                                                                     void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferOpaqueCaptureDescriptorDataEXT);
+    return this->vkGetBufferOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline VkResult DeviceTable::GetImageOpaqueCaptureDescriptorDataEXT(VkDevice device,
+                                                                    const VkImageCaptureDescriptorDataInfoEXT *pInfo,
+                                                                    void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageOpaqueCaptureDescriptorDataEXT);
+    return this->vkGetImageOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline VkResult DeviceTable::GetImageViewOpaqueCaptureDescriptorDataEXT(
+    VkDevice device, const VkImageViewCaptureDescriptorDataInfoEXT *pInfo, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageViewOpaqueCaptureDescriptorDataEXT);
+    return this->vkGetImageViewOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+}
+#endif
+#if defined(VK_EXT_descriptor_buffer)
+inline VkResult DeviceTable::GetSamplerOpaqueCaptureDescriptorDataEXT(
+    VkDevice device, const VkSamplerCaptureDescriptorDataInfoEXT *pInfo, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSamplerOpaqueCaptureDescriptorDataEXT);
+    return this->vkGetSamplerOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+}
+#endif
+#if (defined(VK_EXT_descriptor_buffer) && (defined(VK_KHR_acceleration_structure) || defined(VK_NV_ray_tracing)))
+inline VkResult DeviceTable::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT(
+    VkDevice device, const VkAccelerationStructureCaptureDescriptorDataInfoEXT *pInfo, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
+    return this->vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+}
+#endif
+#if defined(VK_EXT_pageable_device_local_memory)
+inline void DeviceTable::SetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetDeviceMemoryPriorityEXT);
+    this->vkSetDeviceMemoryPriorityEXT(device, memory, priority);
+}
+#endif
+#if defined(VK_KHR_present_wait2)
+inline VkResult DeviceTable::WaitForPresent2KHR(VkDevice device, VkSwapchainKHR swapchain,
+                                                const VkPresentWait2InfoKHR *pPresentWait2Info) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkWaitForPresent2KHR);
+    return this->vkWaitForPresent2KHR(device, swapchain, pPresentWait2Info);
+}
+#endif
+#if defined(VK_KHR_present_wait)
+inline VkResult DeviceTable::WaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId,
+                                               uint64_t timeout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkWaitForPresentKHR);
+    return this->vkWaitForPresentKHR(device, swapchain, presentId, timeout);
+}
+#endif
+#if defined(VK_FUCHSIA_buffer_collection)
+inline VkResult DeviceTable::CreateBufferCollectionFUCHSIA(VkDevice device,
+                                                           const VkBufferCollectionCreateInfoFUCHSIA *pCreateInfo,
+                                                           const VkAllocationCallbacks *pAllocator,
+                                                           VkBufferCollectionFUCHSIA *pCollection) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateBufferCollectionFUCHSIA);
+    return this->vkCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
+}
+#endif
+#if defined(VK_FUCHSIA_buffer_collection)
+inline VkResult DeviceTable::SetBufferCollectionBufferConstraintsFUCHSIA(
+    VkDevice device, VkBufferCollectionFUCHSIA collection,
+    const VkBufferConstraintsInfoFUCHSIA *pBufferConstraintsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetBufferCollectionBufferConstraintsFUCHSIA);
+    return this->vkSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
+}
+#endif
+#if defined(VK_FUCHSIA_buffer_collection)
+inline VkResult DeviceTable::SetBufferCollectionImageConstraintsFUCHSIA(
+    VkDevice device, VkBufferCollectionFUCHSIA collection,
+    const VkImageConstraintsInfoFUCHSIA *pImageConstraintsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetBufferCollectionImageConstraintsFUCHSIA);
+    return this->vkSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
+}
+#endif
+#if defined(VK_FUCHSIA_buffer_collection)
+inline void DeviceTable::DestroyBufferCollectionFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection,
+                                                        const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyBufferCollectionFUCHSIA);
+    this->vkDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
+}
+#endif
+#if defined(VK_FUCHSIA_buffer_collection)
+inline VkResult DeviceTable::GetBufferCollectionPropertiesFUCHSIA(
+    VkDevice device, VkBufferCollectionFUCHSIA collection, VkBufferCollectionPropertiesFUCHSIA *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferCollectionPropertiesFUCHSIA);
+    return this->vkGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
+}
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+inline VkResult DeviceTable::CreateCudaModuleNV(VkDevice device, const VkCudaModuleCreateInfoNV *pCreateInfo,
+                                                const VkAllocationCallbacks *pAllocator, VkCudaModuleNV *pModule) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateCudaModuleNV);
+    return this->vkCreateCudaModuleNV(device, pCreateInfo, pAllocator, pModule);
+}
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+inline VkResult DeviceTable::GetCudaModuleCacheNV(VkDevice device, VkCudaModuleNV module, size_t *pCacheSize,
+                                                  void *pCacheData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetCudaModuleCacheNV);
+    return this->vkGetCudaModuleCacheNV(device, module, pCacheSize, pCacheData);
+}
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+inline VkResult DeviceTable::CreateCudaFunctionNV(VkDevice device, const VkCudaFunctionCreateInfoNV *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator,
+                                                  VkCudaFunctionNV *pFunction) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateCudaFunctionNV);
+    return this->vkCreateCudaFunctionNV(device, pCreateInfo, pAllocator, pFunction);
+}
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+inline void DeviceTable::DestroyCudaModuleNV(VkDevice device, VkCudaModuleNV module,
+                                             const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyCudaModuleNV);
+    this->vkDestroyCudaModuleNV(device, module, pAllocator);
+}
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+inline void DeviceTable::DestroyCudaFunctionNV(VkDevice device, VkCudaFunctionNV function,
+                                               const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyCudaFunctionNV);
+    this->vkDestroyCudaFunctionNV(device, function, pAllocator);
+}
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+inline void DeviceTable::CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer,
+                                               const VkCudaLaunchInfoNV *pLaunchInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCudaLaunchKernelNV);
+    this->vkCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginRendering);
+    this->vkCmdBeginRendering(commandBuffer, pRenderingInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_3)
+inline void DeviceTable::CmdEndRendering(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndRendering);
+    this->vkCmdEndRendering(commandBuffer);
+}
+#endif
+#if defined(VK_EXT_fragment_density_map_offset)
+inline void DeviceTable::CmdEndRendering2EXT(VkCommandBuffer commandBuffer,
+                                             const VkRenderingEndInfoEXT *pRenderingEndInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndRendering2EXT);
+    this->vkCmdEndRendering2EXT(commandBuffer, pRenderingEndInfo);
+}
+#endif
+#if defined(VK_VALVE_descriptor_set_host_mapping)
+inline void DeviceTable::GetDescriptorSetLayoutHostMappingInfoVALVE(
+    VkDevice device, const VkDescriptorSetBindingReferenceVALVE *pBindingReference,
+    VkDescriptorSetLayoutHostMappingInfoVALVE *pHostMapping) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDescriptorSetLayoutHostMappingInfoVALVE);
+    this->vkGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
+}
+#endif
+#if defined(VK_VALVE_descriptor_set_host_mapping)
+inline void DeviceTable::GetDescriptorSetHostMappingVALVE(VkDevice device, VkDescriptorSet descriptorSet,
+                                                          void **ppData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDescriptorSetHostMappingVALVE);
+    this->vkGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline VkResult DeviceTable::CreateMicromapEXT(VkDevice device, const VkMicromapCreateInfoEXT *pCreateInfo,
+                                               const VkAllocationCallbacks *pAllocator, VkMicromapEXT *pMicromap) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateMicromapEXT);
+    return this->vkCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount,
+                                              const VkMicromapBuildInfoEXT *pInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBuildMicromapsEXT);
+    this->vkCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline VkResult DeviceTable::BuildMicromapsEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                               uint32_t infoCount, const VkMicromapBuildInfoEXT *pInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBuildMicromapsEXT);
+    return this->vkBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::DestroyMicromapEXT(VkDevice device, VkMicromapEXT micromap,
+                                            const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyMicromapEXT);
+    this->vkDestroyMicromapEXT(device, micromap, pAllocator);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMicromapEXT);
+    this->vkCmdCopyMicromapEXT(commandBuffer, pInfo);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline VkResult DeviceTable::CopyMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                             const VkCopyMicromapInfoEXT *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyMicromapEXT);
+    return this->vkCopyMicromapEXT(device, deferredOperation, pInfo);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer,
+                                                    const VkCopyMicromapToMemoryInfoEXT *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMicromapToMemoryEXT);
+    this->vkCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline VkResult DeviceTable::CopyMicromapToMemoryEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                                     const VkCopyMicromapToMemoryInfoEXT *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyMicromapToMemoryEXT);
+    return this->vkCopyMicromapToMemoryEXT(device, deferredOperation, pInfo);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::CmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer,
+                                                    const VkCopyMemoryToMicromapInfoEXT *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyMemoryToMicromapEXT);
+    this->vkCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline VkResult DeviceTable::CopyMemoryToMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                                     const VkCopyMemoryToMicromapInfoEXT *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyMemoryToMicromapEXT);
+    return this->vkCopyMemoryToMicromapEXT(device, deferredOperation, pInfo);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::CmdWriteMicromapsPropertiesEXT(VkCommandBuffer commandBuffer, uint32_t micromapCount,
+                                                        const VkMicromapEXT *pMicromaps, VkQueryType queryType,
+                                                        VkQueryPool queryPool, uint32_t firstQuery) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteMicromapsPropertiesEXT);
+    this->vkCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline VkResult DeviceTable::WriteMicromapsPropertiesEXT(VkDevice device, uint32_t micromapCount,
+                                                         const VkMicromapEXT *pMicromaps, VkQueryType queryType,
+                                                         size_t dataSize, void *pData, size_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkWriteMicromapsPropertiesEXT);
+    return this->vkWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::GetDeviceMicromapCompatibilityEXT(
+    VkDevice device, const VkMicromapVersionInfoEXT *pVersionInfo,
+    VkAccelerationStructureCompatibilityKHR *pCompatibility) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceMicromapCompatibilityEXT);
+    this->vkGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
+}
+#endif
+#if defined(VK_EXT_opacity_micromap)
+inline void DeviceTable::GetMicromapBuildSizesEXT(VkDevice device, VkAccelerationStructureBuildTypeKHR buildType,
+                                                  const VkMicromapBuildInfoEXT *pBuildInfo,
+                                                  VkMicromapBuildSizesInfoEXT *pSizeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMicromapBuildSizesEXT);
+    this->vkGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
+}
+#endif
+#if defined(VK_EXT_shader_module_identifier)
+inline void DeviceTable::GetShaderModuleIdentifierEXT(VkDevice device, VkShaderModule shaderModule,
+                                                      VkShaderModuleIdentifierEXT *pIdentifier) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetShaderModuleIdentifierEXT);
+    this->vkGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
+}
+#endif
+#if defined(VK_EXT_shader_module_identifier)
+inline void DeviceTable::GetShaderModuleCreateInfoIdentifierEXT(VkDevice device,
+                                                                const VkShaderModuleCreateInfo *pCreateInfo,
+                                                                VkShaderModuleIdentifierEXT *pIdentifier) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetShaderModuleCreateInfoIdentifierEXT);
+    this->vkGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::GetImageSubresourceLayout2(VkDevice device, VkImage image,
+                                                    const VkImageSubresource2 *pSubresource,
+                                                    VkSubresourceLayout2 *pLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageSubresourceLayout2);
+    this->vkGetImageSubresourceLayout2(device, image, pSubresource, pLayout);
+}
+#endif
+#if defined(VK_EXT_pipeline_properties)
+inline VkResult DeviceTable::GetPipelinePropertiesEXT(VkDevice device, const VkPipelineInfoEXT *pPipelineInfo,
+                                                      VkBaseOutStructure *pPipelineProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPipelinePropertiesEXT);
+    return this->vkGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
+}
+#endif
+#if defined(VK_EXT_metal_objects)
+inline void DeviceTable::ExportMetalObjectsEXT(VkDevice device, VkExportMetalObjectsInfoEXT *pMetalObjectsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkExportMetalObjectsEXT);
+    this->vkExportMetalObjectsEXT(device, pMetalObjectsInfo);
+}
+#endif
+#if defined(VK_QCOM_tile_memory_heap)
+inline void DeviceTable::CmdBindTileMemoryQCOM(VkCommandBuffer commandBuffer,
+                                               const VkTileMemoryBindInfoQCOM *pTileMemoryBindInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindTileMemoryQCOM);
+    this->vkCmdBindTileMemoryQCOM(commandBuffer, pTileMemoryBindInfo);
+}
+#endif
+#if defined(VK_QCOM_tile_properties)
+inline VkResult DeviceTable::GetFramebufferTilePropertiesQCOM(VkDevice device, VkFramebuffer framebuffer,
+                                                              uint32_t *pPropertiesCount,
+                                                              VkTilePropertiesQCOM *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetFramebufferTilePropertiesQCOM);
+    return this->vkGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
+}
+#endif
+#if defined(VK_QCOM_tile_properties)
+inline VkResult DeviceTable::GetDynamicRenderingTilePropertiesQCOM(VkDevice device,
+                                                                   const VkRenderingInfo *pRenderingInfo,
+                                                                   VkTilePropertiesQCOM *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDynamicRenderingTilePropertiesQCOM);
+    return this->vkGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
+}
+#endif
+#if defined(VK_NV_optical_flow)
+inline VkResult DeviceTable::CreateOpticalFlowSessionNV(VkDevice device,
+                                                        const VkOpticalFlowSessionCreateInfoNV *pCreateInfo,
+                                                        const VkAllocationCallbacks *pAllocator,
+                                                        VkOpticalFlowSessionNV *pSession) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateOpticalFlowSessionNV);
+    return this->vkCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
+}
+#endif
+#if defined(VK_NV_optical_flow)
+inline void DeviceTable::DestroyOpticalFlowSessionNV(VkDevice device, VkOpticalFlowSessionNV session,
+                                                     const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyOpticalFlowSessionNV);
+    this->vkDestroyOpticalFlowSessionNV(device, session, pAllocator);
+}
+#endif
+#if defined(VK_NV_optical_flow)
+inline VkResult DeviceTable::BindOpticalFlowSessionImageNV(VkDevice device, VkOpticalFlowSessionNV session,
+                                                           VkOpticalFlowSessionBindingPointNV bindingPoint,
+                                                           VkImageView view, VkImageLayout layout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindOpticalFlowSessionImageNV);
+    return this->vkBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
+}
+#endif
+#if defined(VK_NV_optical_flow)
+inline void DeviceTable::CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session,
+                                                 const VkOpticalFlowExecuteInfoNV *pExecuteInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdOpticalFlowExecuteNV);
+    this->vkCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
+}
+#endif
+#if defined(VK_EXT_device_fault)
+inline VkResult DeviceTable::GetDeviceFaultInfoEXT(VkDevice device, VkDeviceFaultCountsEXT *pFaultCounts,
+                                                   VkDeviceFaultInfoEXT *pFaultInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceFaultInfoEXT);
+    return this->vkGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
+}
+#endif
+#if defined(VK_EXT_depth_bias_control)
+inline void DeviceTable::CmdSetDepthBias2EXT(VkCommandBuffer commandBuffer,
+                                             const VkDepthBiasInfoEXT *pDepthBiasInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthBias2EXT);
+    this->vkCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo);
+}
+#endif
+#if defined(VK_KHR_swapchain_maintenance1)
+inline VkResult DeviceTable::ReleaseSwapchainImagesKHR(VkDevice device,
+                                                       const VkReleaseSwapchainImagesInfoKHR *pReleaseInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkReleaseSwapchainImagesKHR);
+    return this->vkReleaseSwapchainImagesKHR(device, pReleaseInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::GetDeviceImageSubresourceLayout(VkDevice device, const VkDeviceImageSubresourceInfo *pInfo,
+                                                         VkSubresourceLayout2 *pLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceImageSubresourceLayout);
+    this->vkGetDeviceImageSubresourceLayout(device, pInfo, pLayout);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline VkResult DeviceTable::MapMemory2(VkDevice device, const VkMemoryMapInfo *pMemoryMapInfo, void **ppData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkMapMemory2);
+    return this->vkMapMemory2(device, pMemoryMapInfo, ppData);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline VkResult DeviceTable::UnmapMemory2(VkDevice device, const VkMemoryUnmapInfo *pMemoryUnmapInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUnmapMemory2);
+    return this->vkUnmapMemory2(device, pMemoryUnmapInfo);
+}
+#endif
+#if defined(VK_EXT_shader_object)
+inline VkResult DeviceTable::CreateShadersEXT(VkDevice device, uint32_t createInfoCount,
+                                              const VkShaderCreateInfoEXT *pCreateInfos,
+                                              const VkAllocationCallbacks *pAllocator, VkShaderEXT *pShaders) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateShadersEXT);
+    return this->vkCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders);
+}
+#endif
+#if defined(VK_EXT_shader_object)
+inline void DeviceTable::DestroyShaderEXT(VkDevice device, VkShaderEXT shader,
+                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyShaderEXT);
+    this->vkDestroyShaderEXT(device, shader, pAllocator);
+}
+#endif
+#if defined(VK_EXT_shader_object)
+inline VkResult DeviceTable::GetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t *pDataSize,
+                                                    void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetShaderBinaryDataEXT);
+    return this->vkGetShaderBinaryDataEXT(device, shader, pDataSize, pData);
+}
+#endif
+#if defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount,
+                                           const VkShaderStageFlagBits *pStages, const VkShaderEXT *pShaders) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindShadersEXT);
+    this->vkCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders);
+}
+#endif
+#if defined(VK_QNX_external_memory_screen_buffer)
+inline VkResult DeviceTable::GetScreenBufferPropertiesQNX(VkDevice device, const struct _screen_buffer *buffer,
+                                                          VkScreenBufferPropertiesQNX *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetScreenBufferPropertiesQNX);
+    return this->vkGetScreenBufferPropertiesQNX(device, buffer, pProperties);
+}
+#endif
+#if defined(VK_AMDX_shader_enqueue)
+inline VkResult DeviceTable::GetExecutionGraphPipelineScratchSizeAMDX(
+    VkDevice device, VkPipeline executionGraph, VkExecutionGraphPipelineScratchSizeAMDX *pSizeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetExecutionGraphPipelineScratchSizeAMDX);
+    return this->vkGetExecutionGraphPipelineScratchSizeAMDX(device, executionGraph, pSizeInfo);
+}
+#endif
+#if defined(VK_AMDX_shader_enqueue)
+inline VkResult DeviceTable::GetExecutionGraphPipelineNodeIndexAMDX(
+    VkDevice device, VkPipeline executionGraph, const VkPipelineShaderStageNodeCreateInfoAMDX *pNodeInfo,
+    uint32_t *pNodeIndex) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetExecutionGraphPipelineNodeIndexAMDX);
+    return this->vkGetExecutionGraphPipelineNodeIndexAMDX(device, executionGraph, pNodeInfo, pNodeIndex);
+}
+#endif
+#if defined(VK_AMDX_shader_enqueue)
+inline VkResult DeviceTable::CreateExecutionGraphPipelinesAMDX(
+    VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+    const VkExecutionGraphPipelineCreateInfoAMDX *pCreateInfos, const VkAllocationCallbacks *pAllocator,
+    VkPipeline *pPipelines) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateExecutionGraphPipelinesAMDX);
+    return this->vkCreateExecutionGraphPipelinesAMDX(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                                     pPipelines);
+}
+#endif
+#if VK_HEADER_VERSION >= 298 && (defined(VK_AMDX_shader_enqueue))
+inline void DeviceTable::CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer commandBuffer, VkPipeline executionGraph,
+                                                             VkDeviceAddress scratch, VkDeviceSize scratchSize) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdInitializeGraphScratchMemoryAMDX);
+    this->vkCmdInitializeGraphScratchMemoryAMDX(commandBuffer, executionGraph, scratch, scratchSize);
+}
+#endif
+#if VK_HEADER_VERSION >= 298 && (defined(VK_AMDX_shader_enqueue))
+inline void DeviceTable::CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
+                                              VkDeviceSize scratchSize,
+                                              const VkDispatchGraphCountInfoAMDX *pCountInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchGraphAMDX);
+    this->vkCmdDispatchGraphAMDX(commandBuffer, scratch, scratchSize, pCountInfo);
+}
+#endif
+#if VK_HEADER_VERSION >= 298 && (defined(VK_AMDX_shader_enqueue))
+inline void DeviceTable::CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
+                                                      VkDeviceSize scratchSize,
+                                                      const VkDispatchGraphCountInfoAMDX *pCountInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchGraphIndirectAMDX);
+    this->vkCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, scratchSize, pCountInfo);
+}
+#endif
+#if VK_HEADER_VERSION >= 298 && (defined(VK_AMDX_shader_enqueue))
+inline void DeviceTable::CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
+                                                           VkDeviceSize scratchSize, VkDeviceAddress countInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchGraphIndirectCountAMDX);
+    this->vkCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, scratchSize, countInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdBindDescriptorSets2(VkCommandBuffer commandBuffer,
+                                                const VkBindDescriptorSetsInfo *pBindDescriptorSetsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindDescriptorSets2);
+    this->vkCmdBindDescriptorSets2(commandBuffer, pBindDescriptorSetsInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdPushConstants2(VkCommandBuffer commandBuffer,
+                                           const VkPushConstantsInfo *pPushConstantsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushConstants2);
+    this->vkCmdPushConstants2(commandBuffer, pPushConstantsInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdPushDescriptorSet2(VkCommandBuffer commandBuffer,
+                                               const VkPushDescriptorSetInfo *pPushDescriptorSetInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSet2);
+    this->vkCmdPushDescriptorSet2(commandBuffer, pPushDescriptorSetInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdPushDescriptorSetWithTemplate2(
+    VkCommandBuffer commandBuffer, const VkPushDescriptorSetWithTemplateInfo *pPushDescriptorSetWithTemplateInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSetWithTemplate2);
+    this->vkCmdPushDescriptorSetWithTemplate2(commandBuffer, pPushDescriptorSetWithTemplateInfo);
+}
+#endif
+#if (defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer))
+inline void DeviceTable::CmdSetDescriptorBufferOffsets2EXT(
+    VkCommandBuffer commandBuffer, const VkSetDescriptorBufferOffsetsInfoEXT *pSetDescriptorBufferOffsetsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDescriptorBufferOffsets2EXT);
+    this->vkCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo);
+}
+#endif
+#if (defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer))
+inline void DeviceTable::CmdBindDescriptorBufferEmbeddedSamplers2EXT(
+    VkCommandBuffer commandBuffer,
+    const VkBindDescriptorBufferEmbeddedSamplersInfoEXT *pBindDescriptorBufferEmbeddedSamplersInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindDescriptorBufferEmbeddedSamplers2EXT);
+    this->vkCmdBindDescriptorBufferEmbeddedSamplers2EXT(commandBuffer, pBindDescriptorBufferEmbeddedSamplersInfo);
+}
+#endif
+#if defined(VK_NV_low_latency2)
+inline VkResult DeviceTable::SetLatencySleepModeNV(VkDevice device, VkSwapchainKHR swapchain,
+                                                   const VkLatencySleepModeInfoNV *pSleepModeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetLatencySleepModeNV);
+    return this->vkSetLatencySleepModeNV(device, swapchain, pSleepModeInfo);
+}
+#endif
+#if defined(VK_NV_low_latency2)
+inline VkResult DeviceTable::LatencySleepNV(VkDevice device, VkSwapchainKHR swapchain,
+                                            const VkLatencySleepInfoNV *pSleepInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkLatencySleepNV);
+    return this->vkLatencySleepNV(device, swapchain, pSleepInfo);
+}
+#endif
+#if defined(VK_NV_low_latency2)
+inline void DeviceTable::SetLatencyMarkerNV(VkDevice device, VkSwapchainKHR swapchain,
+                                            const VkSetLatencyMarkerInfoNV *pLatencyMarkerInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetLatencyMarkerNV);
+    this->vkSetLatencyMarkerNV(device, swapchain, pLatencyMarkerInfo);
+}
+#endif
+#if VK_HEADER_VERSION >= 271 && (defined(VK_NV_low_latency2))
+inline void DeviceTable::GetLatencyTimingsNV(VkDevice device, VkSwapchainKHR swapchain,
+                                             VkGetLatencyMarkerInfoNV *pLatencyMarkerInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetLatencyTimingsNV);
+    this->vkGetLatencyTimingsNV(device, swapchain, pLatencyMarkerInfo);
+}
+#endif
+#if defined(VK_NV_low_latency2)
+inline void DeviceTable::QueueNotifyOutOfBandNV(VkQueue queue, const VkOutOfBandQueueTypeInfoNV *pQueueTypeInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueNotifyOutOfBandNV);
+    this->vkQueueNotifyOutOfBandNV(queue, pQueueTypeInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdSetRenderingAttachmentLocations(
+    VkCommandBuffer commandBuffer, const VkRenderingAttachmentLocationInfo *pLocationInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRenderingAttachmentLocations);
+    this->vkCmdSetRenderingAttachmentLocations(commandBuffer, pLocationInfo);
+}
+#endif
+#if defined(VKIT_API_VERSION_1_4)
+inline void DeviceTable::CmdSetRenderingInputAttachmentIndices(
+    VkCommandBuffer commandBuffer, const VkRenderingInputAttachmentIndexInfo *pInputAttachmentIndexInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRenderingInputAttachmentIndices);
+    this->vkCmdSetRenderingInputAttachmentIndices(commandBuffer, pInputAttachmentIndexInfo);
+}
+#endif
+#if (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clamp_control)) || defined(VK_EXT_depth_clamp_control)
+inline void DeviceTable::CmdSetDepthClampRangeEXT(VkCommandBuffer commandBuffer, VkDepthClampModeEXT depthClampMode,
+                                                  const VkDepthClampRangeEXT *pDepthClampRange) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthClampRangeEXT);
+    this->vkCmdSetDepthClampRangeEXT(commandBuffer, depthClampMode, pDepthClampRange);
+}
+#endif
+#if defined(VK_EXT_external_memory_metal)
+inline VkResult DeviceTable::GetMemoryMetalHandleEXT(VkDevice device,
+                                                     const VkMemoryGetMetalHandleInfoEXT *pGetMetalHandleInfo,
+                                                     void **pHandle) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryMetalHandleEXT);
+    return this->vkGetMemoryMetalHandleEXT(device, pGetMetalHandleInfo, pHandle);
+}
+#endif
+#if defined(VK_EXT_external_memory_metal)
+inline VkResult DeviceTable::GetMemoryMetalHandlePropertiesEXT(
+    VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void *pHandle,
+    VkMemoryMetalHandlePropertiesEXT *pMemoryMetalHandleProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetMemoryMetalHandlePropertiesEXT);
+    return this->vkGetMemoryMetalHandlePropertiesEXT(device, handleType, pHandle, pMemoryMetalHandleProperties);
+}
+#endif
+#if defined(VK_NV_cooperative_vector)
+inline VkResult DeviceTable::ConvertCooperativeVectorMatrixNV(VkDevice device,
+                                                              const VkConvertCooperativeVectorMatrixInfoNV *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkConvertCooperativeVectorMatrixNV);
+    return this->vkConvertCooperativeVectorMatrixNV(device, pInfo);
+}
+#endif
+#if defined(VK_NV_cooperative_vector)
+inline void DeviceTable::CmdConvertCooperativeVectorMatrixNV(VkCommandBuffer commandBuffer, uint32_t infoCount,
+                                                             const VkConvertCooperativeVectorMatrixInfoNV *pInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdConvertCooperativeVectorMatrixNV);
+    this->vkCmdConvertCooperativeVectorMatrixNV(commandBuffer, infoCount, pInfos);
+}
+#endif
+#if defined(VK_QCOM_tile_shading)
+inline void DeviceTable::CmdDispatchTileQCOM(VkCommandBuffer commandBuffer,
+                                             const VkDispatchTileInfoQCOM *pDispatchTileInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchTileQCOM);
+    this->vkCmdDispatchTileQCOM(commandBuffer, pDispatchTileInfo);
+}
+#endif
+#if defined(VK_QCOM_tile_shading)
+inline void DeviceTable::CmdBeginPerTileExecutionQCOM(VkCommandBuffer commandBuffer,
+                                                      const VkPerTileBeginInfoQCOM *pPerTileBeginInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginPerTileExecutionQCOM);
+    this->vkCmdBeginPerTileExecutionQCOM(commandBuffer, pPerTileBeginInfo);
+}
+#endif
+#if defined(VK_QCOM_tile_shading)
+inline void DeviceTable::CmdEndPerTileExecutionQCOM(VkCommandBuffer commandBuffer,
+                                                    const VkPerTileEndInfoQCOM *pPerTileEndInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndPerTileExecutionQCOM);
+    this->vkCmdEndPerTileExecutionQCOM(commandBuffer, pPerTileEndInfo);
+}
+#endif
+#if defined(VK_NV_external_compute_queue)
+inline VkResult DeviceTable::CreateExternalComputeQueueNV(VkDevice device,
+                                                          const VkExternalComputeQueueCreateInfoNV *pCreateInfo,
+                                                          const VkAllocationCallbacks *pAllocator,
+                                                          VkExternalComputeQueueNV *pExternalQueue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateExternalComputeQueueNV);
+    return this->vkCreateExternalComputeQueueNV(device, pCreateInfo, pAllocator, pExternalQueue);
+}
+#endif
+#if defined(VK_NV_external_compute_queue)
+inline void DeviceTable::DestroyExternalComputeQueueNV(VkDevice device, VkExternalComputeQueueNV externalQueue,
+                                                       const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyExternalComputeQueueNV);
+    this->vkDestroyExternalComputeQueueNV(device, externalQueue, pAllocator);
+}
+#endif
+#if defined(VK_NV_external_compute_queue)
+inline void DeviceTable::GetExternalComputeQueueDataNV(VkExternalComputeQueueNV externalQueue,
+                                                       VkExternalComputeQueueDataParamsNV *params, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetExternalComputeQueueDataNV);
+    this->vkGetExternalComputeQueueDataNV(externalQueue, params, pData);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline VkResult DeviceTable::CreateTensorARM(VkDevice device, const VkTensorCreateInfoARM *pCreateInfo,
+                                             const VkAllocationCallbacks *pAllocator, VkTensorARM *pTensor) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateTensorARM);
+    return this->vkCreateTensorARM(device, pCreateInfo, pAllocator, pTensor);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline void DeviceTable::DestroyTensorARM(VkDevice device, VkTensorARM tensor,
+                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyTensorARM);
+    this->vkDestroyTensorARM(device, tensor, pAllocator);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline VkResult DeviceTable::CreateTensorViewARM(VkDevice device, const VkTensorViewCreateInfoARM *pCreateInfo,
+                                                 const VkAllocationCallbacks *pAllocator, VkTensorViewARM *pView) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateTensorViewARM);
+    return this->vkCreateTensorViewARM(device, pCreateInfo, pAllocator, pView);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline void DeviceTable::DestroyTensorViewARM(VkDevice device, VkTensorViewARM tensorView,
+                                              const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyTensorViewARM);
+    this->vkDestroyTensorViewARM(device, tensorView, pAllocator);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline void DeviceTable::GetTensorMemoryRequirementsARM(VkDevice device, const VkTensorMemoryRequirementsInfoARM *pInfo,
+                                                        VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetTensorMemoryRequirementsARM);
+    this->vkGetTensorMemoryRequirementsARM(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline VkResult DeviceTable::BindTensorMemoryARM(VkDevice device, uint32_t bindInfoCount,
+                                                 const VkBindTensorMemoryInfoARM *pBindInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindTensorMemoryARM);
+    return this->vkBindTensorMemoryARM(device, bindInfoCount, pBindInfos);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline void DeviceTable::GetDeviceTensorMemoryRequirementsARM(VkDevice device,
+                                                              const VkDeviceTensorMemoryRequirementsARM *pInfo,
+                                                              VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceTensorMemoryRequirementsARM);
+    this->vkGetDeviceTensorMemoryRequirementsARM(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_ARM_tensors)
+inline void DeviceTable::CmdCopyTensorARM(VkCommandBuffer commandBuffer,
+                                          const VkCopyTensorInfoARM *pCopyTensorInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyTensorARM);
+    this->vkCmdCopyTensorARM(commandBuffer, pCopyTensorInfo);
+}
+#endif
+#if (defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer))
+inline VkResult DeviceTable::GetTensorOpaqueCaptureDescriptorDataARM(VkDevice device,
+                                                                     const VkTensorCaptureDescriptorDataInfoARM *pInfo,
+                                                                     void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetTensorOpaqueCaptureDescriptorDataARM);
+    return this->vkGetTensorOpaqueCaptureDescriptorDataARM(device, pInfo, pData);
+}
+#endif
+#if (defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer))
+inline VkResult DeviceTable::GetTensorViewOpaqueCaptureDescriptorDataARM(
+    VkDevice device, const VkTensorViewCaptureDescriptorDataInfoARM *pInfo, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetTensorViewOpaqueCaptureDescriptorDataARM);
+    return this->vkGetTensorViewOpaqueCaptureDescriptorDataARM(device, pInfo, pData);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline VkResult DeviceTable::CreateDataGraphPipelinesARM(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                                         VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                         const VkDataGraphPipelineCreateInfoARM *pCreateInfos,
+                                                         const VkAllocationCallbacks *pAllocator,
+                                                         VkPipeline *pPipelines) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateDataGraphPipelinesARM);
+    return this->vkCreateDataGraphPipelinesARM(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
+                                               pAllocator, pPipelines);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline VkResult DeviceTable::CreateDataGraphPipelineSessionARM(
+    VkDevice device, const VkDataGraphPipelineSessionCreateInfoARM *pCreateInfo,
+    const VkAllocationCallbacks *pAllocator, VkDataGraphPipelineSessionARM *pSession) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateDataGraphPipelineSessionARM);
+    return this->vkCreateDataGraphPipelineSessionARM(device, pCreateInfo, pAllocator, pSession);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline VkResult DeviceTable::GetDataGraphPipelineSessionBindPointRequirementsARM(
+    VkDevice device, const VkDataGraphPipelineSessionBindPointRequirementsInfoARM *pInfo,
+    uint32_t *pBindPointRequirementCount,
+    VkDataGraphPipelineSessionBindPointRequirementARM *pBindPointRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDataGraphPipelineSessionBindPointRequirementsARM);
+    return this->vkGetDataGraphPipelineSessionBindPointRequirementsARM(device, pInfo, pBindPointRequirementCount,
+                                                                       pBindPointRequirements);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline void DeviceTable::GetDataGraphPipelineSessionMemoryRequirementsARM(
+    VkDevice device, const VkDataGraphPipelineSessionMemoryRequirementsInfoARM *pInfo,
+    VkMemoryRequirements2 *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDataGraphPipelineSessionMemoryRequirementsARM);
+    this->vkGetDataGraphPipelineSessionMemoryRequirementsARM(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline VkResult DeviceTable::BindDataGraphPipelineSessionMemoryARM(
+    VkDevice device, uint32_t bindInfoCount, const VkBindDataGraphPipelineSessionMemoryInfoARM *pBindInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindDataGraphPipelineSessionMemoryARM);
+    return this->vkBindDataGraphPipelineSessionMemoryARM(device, bindInfoCount, pBindInfos);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline void DeviceTable::DestroyDataGraphPipelineSessionARM(VkDevice device, VkDataGraphPipelineSessionARM session,
+                                                            const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyDataGraphPipelineSessionARM);
+    this->vkDestroyDataGraphPipelineSessionARM(device, session, pAllocator);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline void DeviceTable::CmdDispatchDataGraphARM(VkCommandBuffer commandBuffer, VkDataGraphPipelineSessionARM session,
+                                                 const VkDataGraphPipelineDispatchInfoARM *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchDataGraphARM);
+    this->vkCmdDispatchDataGraphARM(commandBuffer, session, pInfo);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline VkResult DeviceTable::GetDataGraphPipelineAvailablePropertiesARM(
+    VkDevice device, const VkDataGraphPipelineInfoARM *pPipelineInfo, uint32_t *pPropertiesCount,
+    VkDataGraphPipelinePropertyARM *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDataGraphPipelineAvailablePropertiesARM);
+    return this->vkGetDataGraphPipelineAvailablePropertiesARM(device, pPipelineInfo, pPropertiesCount, pProperties);
+}
+#endif
+#if defined(VK_ARM_data_graph)
+inline VkResult DeviceTable::GetDataGraphPipelinePropertiesARM(
+    VkDevice device, const VkDataGraphPipelineInfoARM *pPipelineInfo, uint32_t propertiesCount,
+    VkDataGraphPipelinePropertyQueryResultARM *pProperties) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDataGraphPipelinePropertiesARM);
+    return this->vkGetDataGraphPipelinePropertiesARM(device, pPipelineInfo, propertiesCount, pProperties);
+}
+#endif
+#if defined(VK_EXT_host_query_reset)
+inline void DeviceTable::ResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
+                                           uint32_t queryCount) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkResetQueryPoolEXT);
+    this->vkResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
+}
+#endif
+#if defined(VK_KHR_maintenance5)
+inline void DeviceTable::GetRenderingAreaGranularityKHR(VkDevice device,
+                                                        const VkRenderingAreaInfoKHR *pRenderingAreaInfo,
+                                                        VkExtent2D *pGranularity) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRenderingAreaGranularityKHR);
+    this->vkGetRenderingAreaGranularityKHR(device, pRenderingAreaInfo, pGranularity);
+}
+#endif
+#if defined(VK_KHR_push_descriptor)
+inline void DeviceTable::CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                                 VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount,
+                                                 const VkWriteDescriptorSet *pDescriptorWrites) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSetKHR);
+    this->vkCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
+                                    pDescriptorWrites);
+}
+#endif
+#if defined(VK_KHR_maintenance1)
+inline void DeviceTable::TrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool,
+                                            VkCommandPoolTrimFlagsKHR flags) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkTrimCommandPoolKHR);
+    this->vkTrimCommandPoolKHR(device, commandPool, flags);
+}
+#endif
+#if defined(VK_KHR_device_group)
+inline void DeviceTable::GetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device, uint32_t heapIndex,
+                                                             uint32_t localDeviceIndex, uint32_t remoteDeviceIndex,
+                                                             VkPeerMemoryFeatureFlagsKHR *pPeerMemoryFeatures) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceGroupPeerMemoryFeaturesKHR);
+    this->vkGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex,
+                                                pPeerMemoryFeatures);
+}
+#endif
+#if defined(VK_KHR_bind_memory2)
+inline VkResult DeviceTable::BindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount,
+                                                  const VkBindBufferMemoryInfoKHR *pBindInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindBufferMemory2KHR);
+    return this->vkBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+}
+#endif
+#if defined(VK_KHR_bind_memory2)
+inline VkResult DeviceTable::BindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount,
+                                                 const VkBindImageMemoryInfoKHR *pBindInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkBindImageMemory2KHR);
+    return this->vkBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+}
+#endif
+#if defined(VK_KHR_device_group)
+inline void DeviceTable::CmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDeviceMaskKHR);
+    this->vkCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
+}
+#endif
+#if defined(VK_KHR_device_group)
+inline void DeviceTable::CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
+                                            uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
+                                            uint32_t groupCountZ) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDispatchBaseKHR);
+    this->vkCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY,
+                               groupCountZ);
+}
+#endif
+#if defined(VK_KHR_descriptor_update_template)
+inline VkResult DeviceTable::CreateDescriptorUpdateTemplateKHR(
+    VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR *pCreateInfo,
+    const VkAllocationCallbacks *pAllocator, VkDescriptorUpdateTemplateKHR *pDescriptorUpdateTemplate) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateDescriptorUpdateTemplateKHR);
+    return this->vkCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+#endif
+#if defined(VK_KHR_descriptor_update_template)
+inline void DeviceTable::DestroyDescriptorUpdateTemplateKHR(VkDevice device,
+                                                            VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
+                                                            const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyDescriptorUpdateTemplateKHR);
+    this->vkDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
+}
+#endif
+#if defined(VK_KHR_descriptor_update_template)
+inline void DeviceTable::UpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet,
+                                                            VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
+                                                            const void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUpdateDescriptorSetWithTemplateKHR);
+    this->vkUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+#endif
+#if (defined(VK_KHR_push_descriptor) &&                                                                                \
+     (defined(VKIT_API_VERSION_1_1) || defined(VK_KHR_descriptor_update_template))) ||                                 \
+    (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor))
+inline void DeviceTable::CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
+                                                             VkDescriptorUpdateTemplateKHR descriptorUpdateTemplate,
+                                                             VkPipelineLayout layout, uint32_t set,
+                                                             const void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSetWithTemplateKHR);
+    this->vkCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+}
+#endif
+#if defined(VK_KHR_get_memory_requirements2)
+inline void DeviceTable::GetBufferMemoryRequirements2KHR(VkDevice device,
+                                                         const VkBufferMemoryRequirementsInfo2KHR *pInfo,
+                                                         VkMemoryRequirements2KHR *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferMemoryRequirements2KHR);
+    this->vkGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_KHR_get_memory_requirements2)
+inline void DeviceTable::GetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2KHR *pInfo,
+                                                        VkMemoryRequirements2KHR *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageMemoryRequirements2KHR);
+    this->vkGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_KHR_get_memory_requirements2)
+inline void DeviceTable::GetImageSparseMemoryRequirements2KHR(
+    VkDevice device, const VkImageSparseMemoryRequirementsInfo2KHR *pInfo, uint32_t *pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2KHR *pSparseMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageSparseMemoryRequirements2KHR);
+    this->vkGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount,
+                                                 pSparseMemoryRequirements);
+}
+#endif
+#if defined(VK_KHR_maintenance4)
+inline void DeviceTable::GetDeviceBufferMemoryRequirementsKHR(VkDevice device,
+                                                              const VkDeviceBufferMemoryRequirementsKHR *pInfo,
+                                                              VkMemoryRequirements2KHR *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceBufferMemoryRequirementsKHR);
+    this->vkGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_KHR_maintenance4)
+inline void DeviceTable::GetDeviceImageMemoryRequirementsKHR(VkDevice device,
+                                                             const VkDeviceImageMemoryRequirementsKHR *pInfo,
+                                                             VkMemoryRequirements2KHR *pMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceImageMemoryRequirementsKHR);
+    this->vkGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+}
+#endif
+#if defined(VK_KHR_maintenance4)
+inline void DeviceTable::GetDeviceImageSparseMemoryRequirementsKHR(
+    VkDevice device, const VkDeviceImageMemoryRequirementsKHR *pInfo, uint32_t *pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2KHR *pSparseMemoryRequirements) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceImageSparseMemoryRequirementsKHR);
+    this->vkGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount,
+                                                      pSparseMemoryRequirements);
+}
+#endif
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+inline VkResult DeviceTable::CreateSamplerYcbcrConversionKHR(VkDevice device,
+                                                             const VkSamplerYcbcrConversionCreateInfoKHR *pCreateInfo,
+                                                             const VkAllocationCallbacks *pAllocator,
+                                                             VkSamplerYcbcrConversionKHR *pYcbcrConversion) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateSamplerYcbcrConversionKHR);
+    return this->vkCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+#endif
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+inline void DeviceTable::DestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversionKHR ycbcrConversion,
+                                                          const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroySamplerYcbcrConversionKHR);
+    this->vkDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
+}
+#endif
+#if defined(VK_KHR_maintenance3)
+inline void DeviceTable::GetDescriptorSetLayoutSupportKHR(VkDevice device,
+                                                          const VkDescriptorSetLayoutCreateInfo *pCreateInfo,
+                                                          VkDescriptorSetLayoutSupportKHR *pSupport) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDescriptorSetLayoutSupportKHR);
+    this->vkGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
+}
+#endif
+#if defined(VK_EXT_calibrated_timestamps)
+inline VkResult DeviceTable::GetCalibratedTimestampsEXT(VkDevice device, uint32_t timestampCount,
+                                                        const VkCalibratedTimestampInfoEXT *pTimestampInfos,
+                                                        uint64_t *pTimestamps, uint64_t *pMaxDeviation) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetCalibratedTimestampsEXT);
+    return this->vkGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+}
+#endif
+#if defined(VK_KHR_create_renderpass2)
+inline VkResult DeviceTable::CreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator,
+                                                  VkRenderPass *pRenderPass) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreateRenderPass2KHR);
+    return this->vkCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+}
+#endif
+#if defined(VK_KHR_create_renderpass2)
+inline void DeviceTable::CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
+                                                const VkRenderPassBeginInfo *pRenderPassBegin,
+                                                const VkSubpassBeginInfoKHR *pSubpassBeginInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginRenderPass2KHR);
+    this->vkCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+#endif
+#if defined(VK_KHR_create_renderpass2)
+inline void DeviceTable::CmdNextSubpass2KHR(VkCommandBuffer commandBuffer,
+                                            const VkSubpassBeginInfoKHR *pSubpassBeginInfo,
+                                            const VkSubpassEndInfoKHR *pSubpassEndInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdNextSubpass2KHR);
+    this->vkCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+#endif
+#if defined(VK_KHR_create_renderpass2)
+inline void DeviceTable::CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer,
+                                              const VkSubpassEndInfoKHR *pSubpassEndInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndRenderPass2KHR);
+    this->vkCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+}
+#endif
+#if defined(VK_KHR_timeline_semaphore)
+inline VkResult DeviceTable::GetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t *pValue) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetSemaphoreCounterValueKHR);
+    return this->vkGetSemaphoreCounterValueKHR(device, semaphore, pValue);
+}
+#endif
+#if defined(VK_KHR_timeline_semaphore)
+inline VkResult DeviceTable::WaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfoKHR *pWaitInfo,
+                                               uint64_t timeout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkWaitSemaphoresKHR);
+    return this->vkWaitSemaphoresKHR(device, pWaitInfo, timeout);
+}
+#endif
+#if defined(VK_KHR_timeline_semaphore)
+inline VkResult DeviceTable::SignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfoKHR *pSignalInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSignalSemaphoreKHR);
+    return this->vkSignalSemaphoreKHR(device, pSignalInfo);
+}
+#endif
+#if defined(VK_KHR_draw_indirect_count)
+inline void DeviceTable::CmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                 VkBuffer countBuffer, VkDeviceSize countBufferOffset,
+                                                 uint32_t maxDrawCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndirectCountKHR);
+    this->vkCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                    stride);
+}
+#endif
+#if defined(VK_AMD_draw_indirect_count)
+inline void DeviceTable::CmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                 VkBuffer countBuffer, VkDeviceSize countBufferOffset,
+                                                 uint32_t maxDrawCount, uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndirectCountAMD);
+    this->vkCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                    stride);
+}
+#endif
+#if defined(VK_KHR_draw_indirect_count)
+inline void DeviceTable::CmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                        VkDeviceSize offset, VkBuffer countBuffer,
+                                                        VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
+                                                        uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndexedIndirectCountKHR);
+    this->vkCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                           stride);
+}
+#endif
+#if defined(VK_AMD_draw_indirect_count)
+inline void DeviceTable::CmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer,
+                                                        VkDeviceSize offset, VkBuffer countBuffer,
+                                                        VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
+                                                        uint32_t stride) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdDrawIndexedIndirectCountAMD);
+    this->vkCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                           stride);
+}
+#endif
+#if defined(VK_NV_ray_tracing)
+inline VkResult DeviceTable::GetRayTracingShaderGroupHandlesNV(VkDevice device, VkPipeline pipeline,
+                                                               uint32_t firstGroup, uint32_t groupCount,
+                                                               size_t dataSize, void *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetRayTracingShaderGroupHandlesNV);
+    return this->vkGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+#endif
+#if defined(VK_KHR_buffer_device_address)
+inline uint64_t DeviceTable::GetBufferOpaqueCaptureAddressKHR(VkDevice device,
+                                                              const VkBufferDeviceAddressInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferOpaqueCaptureAddressKHR);
+    return this->vkGetBufferOpaqueCaptureAddressKHR(device, pInfo);
+}
+#endif
+#if defined(VK_KHR_buffer_device_address)
+inline VkDeviceAddress DeviceTable::GetBufferDeviceAddressKHR(VkDevice device,
+                                                              const VkBufferDeviceAddressInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferDeviceAddressKHR);
+    return this->vkGetBufferDeviceAddressKHR(device, pInfo);
+}
+#endif
+#if defined(VK_EXT_buffer_device_address)
+inline VkDeviceAddress DeviceTable::GetBufferDeviceAddressEXT(VkDevice device,
+                                                              const VkBufferDeviceAddressInfoEXT *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetBufferDeviceAddressEXT);
+    return this->vkGetBufferDeviceAddressEXT(device, pInfo);
+}
+#endif
+#if defined(VK_KHR_buffer_device_address)
+inline uint64_t DeviceTable::GetDeviceMemoryOpaqueCaptureAddressKHR(
+    VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfoKHR *pInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceMemoryOpaqueCaptureAddressKHR);
+    return this->vkGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
+}
+#endif
+#if defined(VK_KHR_line_rasterization)
+inline void DeviceTable::CmdSetLineStippleKHR(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
+                                              uint16_t lineStipplePattern) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLineStippleKHR);
+    this->vkCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+#endif
+#if defined(VK_EXT_line_rasterization)
+inline void DeviceTable::CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
+                                              uint16_t lineStipplePattern) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetLineStippleEXT);
+    this->vkCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetCullModeEXT);
+    this->vkCmdSetCullModeEXT(commandBuffer, cullMode);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetFrontFaceEXT);
+    this->vkCmdSetFrontFaceEXT(commandBuffer, frontFace);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer,
+                                                    VkPrimitiveTopology primitiveTopology) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPrimitiveTopologyEXT);
+    this->vkCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount,
+                                                    const VkViewport *pViewports) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetViewportWithCountEXT);
+    this->vkCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount,
+                                                   const VkRect2D *pScissors) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetScissorWithCountEXT);
+    this->vkCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
+}
+#endif
+#if defined(VK_KHR_maintenance5)
+inline void DeviceTable::CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                VkDeviceSize size, VkIndexType indexType) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindIndexBuffer2KHR);
+    this->vkCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding,
+                                                  uint32_t bindingCount, const VkBuffer *pBuffers,
+                                                  const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes,
+                                                  const VkDeviceSize *pStrides) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindVertexBuffers2EXT);
+    this->vkCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthTestEnableEXT);
+    this->vkCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthWriteEnableEXT);
+    this->vkCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthCompareOpEXT);
+    this->vkCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer,
+                                                        VkBool32 depthBoundsTestEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthBoundsTestEnableEXT);
+    this->vkCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetStencilTestEnableEXT);
+    this->vkCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
+                                            VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp,
+                                            VkCompareOp compareOp) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetStencilOpEXT);
+    this->vkCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state2) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer,
+                                                          VkBool32 rasterizerDiscardEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRasterizerDiscardEnableEXT);
+    this->vkCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state2) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetDepthBiasEnableEXT);
+    this->vkCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
+}
+#endif
+#if defined(VK_EXT_extended_dynamic_state2) || defined(VK_EXT_shader_object)
+inline void DeviceTable::CmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer,
+                                                         VkBool32 primitiveRestartEnable) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetPrimitiveRestartEnableEXT);
+    this->vkCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
+}
+#endif
+#if defined(VK_EXT_private_data)
+inline VkResult DeviceTable::CreatePrivateDataSlotEXT(VkDevice device,
+                                                      const VkPrivateDataSlotCreateInfoEXT *pCreateInfo,
+                                                      const VkAllocationCallbacks *pAllocator,
+                                                      VkPrivateDataSlotEXT *pPrivateDataSlot) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCreatePrivateDataSlotEXT);
+    return this->vkCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+}
+#endif
+#if defined(VK_EXT_private_data)
+inline void DeviceTable::DestroyPrivateDataSlotEXT(VkDevice device, VkPrivateDataSlotEXT privateDataSlot,
+                                                   const VkAllocationCallbacks *pAllocator) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkDestroyPrivateDataSlotEXT);
+    this->vkDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
+}
+#endif
+#if defined(VK_EXT_private_data)
+inline VkResult DeviceTable::SetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
+                                               VkPrivateDataSlotEXT privateDataSlot, uint64_t data) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkSetPrivateDataEXT);
+    return this->vkSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
+}
+#endif
+#if defined(VK_EXT_private_data)
+inline void DeviceTable::GetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
+                                           VkPrivateDataSlotEXT privateDataSlot, uint64_t *pData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetPrivateDataEXT);
+    this->vkGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
+}
+#endif
+#if defined(VK_KHR_copy_commands2)
+inline void DeviceTable::CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer,
+                                           const VkCopyBufferInfo2KHR *pCopyBufferInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyBuffer2KHR);
+    this->vkCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
+}
+#endif
+#if defined(VK_KHR_copy_commands2)
+inline void DeviceTable::CmdCopyImage2KHR(VkCommandBuffer commandBuffer,
+                                          const VkCopyImageInfo2KHR *pCopyImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyImage2KHR);
+    this->vkCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
+}
+#endif
+#if defined(VK_KHR_copy_commands2)
+inline void DeviceTable::CmdBlitImage2KHR(VkCommandBuffer commandBuffer,
+                                          const VkBlitImageInfo2KHR *pBlitImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBlitImage2KHR);
+    this->vkCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
+}
+#endif
+#if defined(VK_KHR_copy_commands2)
+inline void DeviceTable::CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer,
+                                                  const VkCopyBufferToImageInfo2KHR *pCopyBufferToImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyBufferToImage2KHR);
+    this->vkCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
+}
+#endif
+#if defined(VK_KHR_copy_commands2)
+inline void DeviceTable::CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer,
+                                                  const VkCopyImageToBufferInfo2KHR *pCopyImageToBufferInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdCopyImageToBuffer2KHR);
+    this->vkCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
+}
+#endif
+#if defined(VK_KHR_copy_commands2)
+inline void DeviceTable::CmdResolveImage2KHR(VkCommandBuffer commandBuffer,
+                                             const VkResolveImageInfo2KHR *pResolveImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdResolveImage2KHR);
+    this->vkCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
+}
+#endif
+#if defined(VK_KHR_synchronization2)
+inline void DeviceTable::CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event,
+                                         const VkDependencyInfoKHR *pDependencyInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetEvent2KHR);
+    this->vkCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
+}
+#endif
+#if defined(VK_KHR_synchronization2)
+inline void DeviceTable::CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event,
+                                           VkPipelineStageFlags2KHR stageMask) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdResetEvent2KHR);
+    this->vkCmdResetEvent2KHR(commandBuffer, event, stageMask);
+}
+#endif
+#if defined(VK_KHR_synchronization2)
+inline void DeviceTable::CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
+                                           const VkDependencyInfoKHR *pDependencyInfos) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWaitEvents2KHR);
+    this->vkCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+}
+#endif
+#if defined(VK_KHR_synchronization2)
+inline void DeviceTable::CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer,
+                                                const VkDependencyInfoKHR *pDependencyInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPipelineBarrier2KHR);
+    this->vkCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+}
+#endif
+#if defined(VK_KHR_synchronization2)
+inline VkResult DeviceTable::QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                             VkFence fence) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkQueueSubmit2KHR);
+    return this->vkQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+}
+#endif
+#if defined(VK_KHR_synchronization2)
+inline void DeviceTable::CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage,
+                                               VkQueryPool queryPool, uint32_t query) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdWriteTimestamp2KHR);
+    this->vkCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
+}
+#endif
+#if defined(VK_EXT_host_image_copy)
+inline VkResult DeviceTable::CopyMemoryToImageEXT(VkDevice device,
+                                                  const VkCopyMemoryToImageInfoEXT *pCopyMemoryToImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyMemoryToImageEXT);
+    return this->vkCopyMemoryToImageEXT(device, pCopyMemoryToImageInfo);
+}
+#endif
+#if defined(VK_EXT_host_image_copy)
+inline VkResult DeviceTable::CopyImageToMemoryEXT(VkDevice device,
+                                                  const VkCopyImageToMemoryInfoEXT *pCopyImageToMemoryInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyImageToMemoryEXT);
+    return this->vkCopyImageToMemoryEXT(device, pCopyImageToMemoryInfo);
+}
+#endif
+#if defined(VK_EXT_host_image_copy)
+inline VkResult DeviceTable::CopyImageToImageEXT(VkDevice device,
+                                                 const VkCopyImageToImageInfoEXT *pCopyImageToImageInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCopyImageToImageEXT);
+    return this->vkCopyImageToImageEXT(device, pCopyImageToImageInfo);
+}
+#endif
+#if defined(VK_EXT_host_image_copy)
+inline VkResult DeviceTable::TransitionImageLayoutEXT(VkDevice device, uint32_t transitionCount,
+                                                      const VkHostImageLayoutTransitionInfoEXT *pTransitions) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkTransitionImageLayoutEXT);
+    return this->vkTransitionImageLayoutEXT(device, transitionCount, pTransitions);
+}
+#endif
+#if defined(VK_KHR_dynamic_rendering)
+inline void DeviceTable::CmdBeginRenderingKHR(VkCommandBuffer commandBuffer,
+                                              const VkRenderingInfoKHR *pRenderingInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBeginRenderingKHR);
+    this->vkCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
+}
+#endif
+#if defined(VK_KHR_dynamic_rendering)
+inline void DeviceTable::CmdEndRenderingKHR(VkCommandBuffer commandBuffer) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdEndRenderingKHR);
+    this->vkCmdEndRenderingKHR(commandBuffer);
+}
+#endif
+#if defined(VK_KHR_maintenance5)
+inline void DeviceTable::GetImageSubresourceLayout2KHR(VkDevice device, VkImage image,
+                                                       const VkImageSubresource2KHR *pSubresource,
+                                                       VkSubresourceLayout2KHR *pLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageSubresourceLayout2KHR);
+    this->vkGetImageSubresourceLayout2KHR(device, image, pSubresource, pLayout);
+}
+#endif
+#if defined(VK_EXT_host_image_copy) || defined(VK_EXT_image_compression_control)
+inline void DeviceTable::GetImageSubresourceLayout2EXT(VkDevice device, VkImage image,
+                                                       const VkImageSubresource2EXT *pSubresource,
+                                                       VkSubresourceLayout2EXT *pLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetImageSubresourceLayout2EXT);
+    this->vkGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
+}
+#endif
+#if defined(VK_EXT_swapchain_maintenance1)
+inline VkResult DeviceTable::ReleaseSwapchainImagesEXT(VkDevice device,
+                                                       const VkReleaseSwapchainImagesInfoEXT *pReleaseInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkReleaseSwapchainImagesEXT);
+    return this->vkReleaseSwapchainImagesEXT(device, pReleaseInfo);
+}
+#endif
+#if defined(VK_KHR_maintenance5)
+inline void DeviceTable::GetDeviceImageSubresourceLayoutKHR(VkDevice device,
+                                                            const VkDeviceImageSubresourceInfoKHR *pInfo,
+                                                            VkSubresourceLayout2KHR *pLayout) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkGetDeviceImageSubresourceLayoutKHR);
+    this->vkGetDeviceImageSubresourceLayoutKHR(device, pInfo, pLayout);
+}
+#endif
+#if defined(VK_KHR_map_memory2)
+inline VkResult DeviceTable::MapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR *pMemoryMapInfo,
+                                           void **ppData) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkMapMemory2KHR);
+    return this->vkMapMemory2KHR(device, pMemoryMapInfo, ppData);
+}
+#endif
+#if defined(VK_KHR_map_memory2)
+inline VkResult DeviceTable::UnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR *pMemoryUnmapInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkUnmapMemory2KHR);
+    return this->vkUnmapMemory2KHR(device, pMemoryUnmapInfo);
+}
+#endif
+#if defined(VK_KHR_maintenance6)
+inline void DeviceTable::CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuffer,
+                                                   const VkBindDescriptorSetsInfoKHR *pBindDescriptorSetsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdBindDescriptorSets2KHR);
+    this->vkCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo);
+}
+#endif
+#if defined(VK_KHR_maintenance6)
+inline void DeviceTable::CmdPushConstants2KHR(VkCommandBuffer commandBuffer,
+                                              const VkPushConstantsInfoKHR *pPushConstantsInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushConstants2KHR);
+    this->vkCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo);
+}
+#endif
+#if (defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor))
+inline void DeviceTable::CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffer,
+                                                  const VkPushDescriptorSetInfoKHR *pPushDescriptorSetInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSet2KHR);
+    this->vkCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo);
+}
+#endif
+#if (defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor))
+inline void DeviceTable::CmdPushDescriptorSetWithTemplate2KHR(
+    VkCommandBuffer commandBuffer,
+    const VkPushDescriptorSetWithTemplateInfoKHR *pPushDescriptorSetWithTemplateInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdPushDescriptorSetWithTemplate2KHR);
+    this->vkCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo);
+}
+#endif
+#if defined(VK_KHR_dynamic_rendering_local_read)
+inline void DeviceTable::CmdSetRenderingAttachmentLocationsKHR(
+    VkCommandBuffer commandBuffer, const VkRenderingAttachmentLocationInfoKHR *pLocationInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRenderingAttachmentLocationsKHR);
+    this->vkCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo);
+}
+#endif
+#if defined(VK_KHR_dynamic_rendering_local_read)
+inline void DeviceTable::CmdSetRenderingInputAttachmentIndicesKHR(
+    VkCommandBuffer commandBuffer, const VkRenderingInputAttachmentIndexInfoKHR *pInputAttachmentIndexInfo) const
+{
+    VKIT_CHECK_DEVICE_FUNCTION(vkCmdSetRenderingInputAttachmentIndicesKHR);
+    this->vkCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pInputAttachmentIndexInfo);
+}
+#endif
 } // namespace VKit::Vulkan
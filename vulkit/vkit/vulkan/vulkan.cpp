@@ -70,6 +70,8 @@ const char *ErrorCodeToString(const ErrorCode code)
         return "BadImageCount";
     case Error_FileNotFound:
         return "FileNotFound";
+    case Error_FileWriteFailed:
+        return "FileWriteFailed";
     default:
         return "Unknown";
     }
@@ -173,6 +173,7 @@ enum ErrorCode : u8
     Error_NoFormatSupported,
     Error_BadImageCount,
     Error_FileNotFound,
+    Error_FileWriteFailed,
     Error_Unknown,
     Error_Count
 };